@@ -190,4 +190,32 @@ pylith::faults::AuxiliaryFactoryKinematic::addSlipRate(void) {
 } // addSlipRate
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Add slip impulse amplitude subfield to auxiliary fields.
+void
+pylith::faults::AuxiliaryFactoryKinematic::addImpulseAmplitude(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("addImpulseAmplitude(void)");
+
+    const char* subfieldName = "impulse_amplitude";
+
+    const PylithReal lengthScale = _normalizer->getLengthScale();
+
+    pylith::topology::Field::Description description;
+    description.label = subfieldName;
+    description.alias = subfieldName;
+    description.vectorFieldType = pylith::topology::Field::SCALAR;
+    description.numComponents = 1;
+    description.componentNames.resize(1);
+    description.componentNames[0] = subfieldName;
+    description.scale = lengthScale;
+    description.validator = NULL;
+
+    _field->subfieldAdd(description, getSubfieldDiscretization(subfieldName));
+    this->setSubfieldQuery(subfieldName);
+
+    PYLITH_METHOD_END;
+} // addImpulseAmplitude
+
+
 // End of file
@@ -54,6 +54,9 @@ public:
     /// Add slip rate subfield to auxiliary field.
     void addSlipRate(void);
 
+    /// Add slip impulse amplitude subfield to auxiliary field.
+    void addImpulseAmplitude(void);
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
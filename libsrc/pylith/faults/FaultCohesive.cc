@@ -21,12 +21,14 @@
 #include "FaultCohesive.hh" // implementation of object methods
 
 #include "pylith/faults/TopologyOps.hh" // USES TopologyOps
+#include "pylith/feassemble/ConstraintSimple.hh" // USES ConstraintSimple
 
 #include "pylith/topology/Field.hh" // USES Field
 #include "pylith/topology/MeshOps.hh" // USES MeshOps::checkTopology()
 
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
 
+#include <cstring> // USES strlen()
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
@@ -216,4 +218,80 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh) {
 } // adjustTopology
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Create constraint for Lagrange multipliers on buried edges of fault.
+pylith::feassemble::Constraint*
+pylith::faults::FaultCohesive::_createConstraintBuriedEdges(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createConstraintBuriedEdges(solution="<<solution.getLabel()<<")");
+
+    if (0 == strlen(getBuriedEdgesMarkerLabel())) {
+        PYLITH_METHOD_RETURN(NULL);
+    } // if
+
+    const char* lagrangeName = "lagrange_multiplier_fault";
+    // const PylithInt numComponents = solution.subfieldInfo(lagrangeName).fe.numComponents;
+    const PylithInt numComponents = solution.getSpaceDim();
+
+    pylith::int_array constrainedDOF;
+    constrainedDOF.resize(numComponents);
+    for (int c = 0; c < numComponents; ++c) {
+        constrainedDOF[c] = c;
+    }
+    // Make new label for cohesive edges and faces
+    PetscDM dm = solution.dmMesh();
+    PetscDMLabel buriedLabel = NULL;
+    PetscDMLabel buriedCohesiveLabel = NULL;
+    PetscIS pointIS = NULL;
+    const PetscInt *points = NULL;
+    PetscInt n;
+    std::ostringstream labelstream;
+    labelstream << getBuriedEdgesMarkerLabel() << "_cohesive";
+    std::string labelname = labelstream.str();
+    PetscErrorCode err;
+
+    err = DMCreateLabel(dm, labelname.c_str());PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, getBuriedEdgesMarkerLabel(), &buriedLabel);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dm, labelname.c_str(), &buriedCohesiveLabel);PYLITH_CHECK_ERROR(err);
+    err = DMLabelGetStratumIS(buriedLabel, 1, &pointIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(pointIS, &n);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+    for (int p = 0; p < n; ++p) {
+        const PetscInt *support = NULL;
+        PetscInt supportSize;
+
+        err = DMPlexGetSupportSize(dm, points[p], &supportSize);PYLITH_CHECK_ERROR(err);
+        err = DMPlexGetSupport(dm, points[p], &support);PYLITH_CHECK_ERROR(err);
+        for (int s = 0; s < supportSize; ++s) {
+            DMPolytopeType ct;
+            const PetscInt spoint = support[s];
+
+            err = DMPlexGetCellType(dm, spoint, &ct);PYLITH_CHECK_ERROR(err);
+            if ((ct == DM_POLYTOPE_SEG_PRISM_TENSOR) || (ct == DM_POLYTOPE_POINT_PRISM_TENSOR)) {
+                const PetscInt *cone = NULL;
+                PetscInt coneSize;
+
+                err = DMPlexGetConeSize(dm, spoint, &coneSize);PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetCone(dm, spoint, &cone);PYLITH_CHECK_ERROR(err);
+                for (int c = 0; c < coneSize; ++c) {
+                    PetscInt val;
+                    err = DMLabelGetValue(buriedLabel, cone[c], &val);PYLITH_CHECK_ERROR(err);
+                    if (val >= 0) {err = DMLabelSetValue(buriedCohesiveLabel, spoint, 1);PYLITH_CHECK_ERROR(err);break;}
+                } // for
+            } // if
+        } // for
+    } // for
+
+    pylith::feassemble::ConstraintSimple *constraint = new pylith::feassemble::ConstraintSimple(this);assert(constraint);
+    constraint->setMarkerLabel(labelname.c_str());
+    err = PetscObjectViewFromOptions((PetscObject) buriedLabel, NULL, "-buried_edge_label_view");
+    err = PetscObjectViewFromOptions((PetscObject) buriedCohesiveLabel, NULL, "-buried_cohesive_edge_label_view");
+    constraint->setConstrainedDOF(&constrainedDOF[0], constrainedDOF.size());
+    constraint->setSubfieldName(lagrangeName);
+    constraint->setUserFn(_zero);
+
+    PYLITH_METHOD_RETURN(constraint);
+} // _createConstraintBuriedEdges
+
+
 // End of file
@@ -101,6 +101,16 @@ public:
      */
     void adjustTopology(pylith::topology::Mesh* const mesh);
 
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Create constraint for Lagrange multipliers on buried edges of fault.
+     *
+     * @param[in] solution Solution field.
+     * @returns Constraint if fault has buried edges, otherwise NULL.
+     */
+    pylith::feassemble::Constraint* _createConstraintBuriedEdges(const pylith::topology::Field& solution);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -120,6 +130,18 @@ private:
     FaultCohesive(const FaultCohesive&); ///< Not implemented
     const FaultCohesive& operator=(const FaultCohesive&); ///< Not implemented
 
+    static PetscErrorCode _zero(PetscInt dim,
+                                PetscReal t,
+                                const PetscReal x[],
+                                PetscInt Nc,
+                                PetscScalar *u,
+                                void *ctx) {
+        for (int c = 0; c < Nc; ++c) {
+            u[c] = 0.0;
+        }
+        return 0;
+    }
+
 }; // class FaultCohesive
 
 #endif // pylith_faults_faultcohesive_hh
@@ -0,0 +1,512 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "FaultCohesiveImpulses.hh" // implementation of object methods
+
+#include "pylith/faults/AuxiliaryFactoryKinematic.hh" // USES AuxiliaryFactoryKinematic
+#include "pylith/feassemble/IntegratorInterface.hh" // USES IntegratorInterface
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps::checkDiscretization()
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/fekernels/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensionalizer
+
+#include <cmath> // USES fabs(), floor()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <typeinfo> // USES typeid()
+
+// ---------------------------------------------------------------------------------------------------------------------
+typedef pylith::feassemble::IntegratorInterface::ResidualKernels ResidualKernels;
+typedef pylith::feassemble::IntegratorInterface::JacobianKernels JacobianKernels;
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace faults {
+        class _FaultCohesiveImpulses {
+            // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /** Set kernels for LHS residual.
+             *
+             * @param[out] integrator Integrator for interface.
+             * @param[in] fault Fault object for slip impulses.
+             * @param[in] solution Solution field.
+             */
+            static
+            void setKernelsLHSResidual(pylith::feassemble::IntegratorInterface* integrator,
+                                       const pylith::faults::FaultCohesiveImpulses& fault,
+                                       const pylith::topology::Field& solution);
+
+            /** Set kernels for LHS Jacobian.
+             *
+             * @param[out] integrator Integrator for interface.
+             * @param[in] fault Fault object for slip impulses.
+             * @param[in] solution Solution field.
+             */
+            static
+            void setKernelsLHSJacobian(pylith::feassemble::IntegratorInterface* integrator,
+                                       const pylith::faults::FaultCohesiveImpulses& fault,
+                                       const pylith::topology::Field& solution);
+
+            static const char* pyreComponent;
+
+        };
+        const char* _FaultCohesiveImpulses::pyreComponent = "faultcohesiveimpulses";
+
+        // _FaultCohesiveImpulses
+
+    } // faults
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Default constructor.
+pylith::faults::FaultCohesiveImpulses::FaultCohesiveImpulses(void) :
+    _auxiliaryFactory(new pylith::faults::AuxiliaryFactoryKinematic),
+    _threshold(1.0e-6),
+    _numImpulses(0),
+    _impulseOffset(0) {
+    pylith::utils::PyreComponent::setName(_FaultCohesiveImpulses::pyreComponent);
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor.
+pylith::faults::FaultCohesiveImpulses::~FaultCohesiveImpulses(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::faults::FaultCohesiveImpulses::deallocate(void) {
+    FaultCohesive::deallocate();
+
+    delete _auxiliaryFactory;_auxiliaryFactory = NULL;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set indices of slip components for impulses.
+void
+pylith::faults::FaultCohesiveImpulses::setImpulseDOF(const int* flags,
+                                                     const int size) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setImpulseDOF(flags="<<flags<<", size="<<size<<")");
+
+    assert((flags && size > 0) || (!flags && 0 == size));
+    _impulseDOF.resize(size);
+    for (int i = 0; i < size; ++i) {
+        if ((flags[i] < 0) || (flags[i] > 2)) {
+            std::ostringstream msg;
+            msg << "Index of slip component for impulses (" << flags[i] << ") for fault '"
+                << PyreComponent::getIdentifier() << "' must be 0 (opening), 1 (left-lateral), or 2 (reverse).";
+            throw std::runtime_error(msg.str());
+        } // if
+        _impulseDOF[i] = flags[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // setImpulseDOF
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of slip components for impulses.
+int
+pylith::faults::FaultCohesiveImpulses::getNumImpulseDOF(void) const {
+    return _impulseDOF.size();
+} // getNumImpulseDOF
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set threshold for nonzero impulse amplitude.
+void
+pylith::faults::FaultCohesiveImpulses::setThreshold(const double value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setThreshold(value="<<value<<")");
+
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Threshold for nonzero impulse amplitude (" << value << ") for fault '"
+            << PyreComponent::getIdentifier() << "' must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _threshold = value;
+
+    PYLITH_METHOD_END;
+} // setThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get threshold for nonzero impulse amplitude.
+double
+pylith::faults::FaultCohesiveImpulses::getThreshold(void) const {
+    return _threshold;
+} // getThreshold
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of impulses over all processes.
+size_t
+pylith::faults::FaultCohesiveImpulses::getNumImpulses(void) const {
+    return _numImpulses;
+} // getNumImpulses
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify configuration is acceptable.
+void
+pylith::faults::FaultCohesiveImpulses::verifyConfiguration(const pylith::topology::Field& solution) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("verifyConfiguration(solution="<<solution.getLabel()<<")");
+
+    if (!solution.hasSubfield("lagrange_multiplier_fault")) {
+        std::ostringstream msg;
+        msg << "Cannot find 'lagrange_multiplier_fault' subfield in solution field for fault implementation in component '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    if (QUASISTATIC != _formulation) {
+        std::ostringstream msg;
+        msg << "Fault implementation with slip impulses in component '" << PyreComponent::getIdentifier()
+            << "' is only compatible with the 'quasistatic' formulation.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (!solution.hasSubfield("displacement")) {
+        std::ostringstream msg;
+        msg << "Cannot find 'displacement' subfield in solution field for fault implementation in component '"
+            << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    if (0 == _impulseDOF.size()) {
+        std::ostringstream msg;
+        msg << "No slip components specified for impulses on fault '" << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+    const int spaceDim = solution.getSpaceDim();
+    for (size_t i = 0; i < _impulseDOF.size(); ++i) {
+        if (_impulseDOF[i] >= spaceDim) {
+            std::ostringstream msg;
+            msg << "Index of slip component for impulses (" << _impulseDOF[i] << ") for fault '"
+                << PyreComponent::getIdentifier() << "' must be less than the spatial dimension (" << spaceDim << ").";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create integrator and set kernels.
+pylith::feassemble::Integrator*
+pylith::faults::FaultCohesiveImpulses::createIntegrator(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createIntegrator(solution="<<solution.getLabel()<<")");
+
+    pylith::feassemble::IntegratorInterface* integrator = new pylith::feassemble::IntegratorInterface(this);assert(integrator);
+    integrator->setLabelValue(getInterfaceId());
+    integrator->setSurfaceMarkerLabel(getSurfaceMarkerLabel());
+
+    _FaultCohesiveImpulses::setKernelsLHSResidual(integrator, *this, solution);
+    _FaultCohesiveImpulses::setKernelsLHSJacobian(integrator, *this, solution);
+
+    PYLITH_METHOD_RETURN(integrator);
+} // createIntegrator
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create constraint for buried fault edges and faces.
+pylith::feassemble::Constraint*
+pylith::faults::FaultCohesiveImpulses::createConstraint(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createConstraint(solution="<<solution.getLabel()<<")");
+
+    PYLITH_METHOD_RETURN(_createConstraintBuriedEdges(solution));
+} // createConstraint
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create auxiliary field.
+pylith::topology::Field*
+pylith::faults::FaultCohesiveImpulses::createAuxiliaryField(const pylith::topology::Field& solution,
+                                                            const pylith::topology::Mesh& domainMesh) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("createAuxiliaryField(solution="<<solution.getLabel()<<", domainMesh=)"<<typeid(domainMesh).name()<<")");
+
+    assert(_normalizer);
+
+    pylith::topology::Field* auxiliaryField = new pylith::topology::Field(domainMesh);assert(auxiliaryField);
+    auxiliaryField->setLabel("FaultCohesiveImpulses auxiliary field");
+
+    // Set default discretization of auxiliary subfields to match lagrange_multiplier_fault subfield in solution.
+    assert(_auxiliaryFactory);
+    const pylith::topology::FieldBase::Discretization& discretization = solution.subfieldInfo("lagrange_multiplier_fault").fe;
+    _auxiliaryFactory->setSubfieldDiscretization("default", discretization.basisOrder, discretization.quadOrder, -1,
+                                                 discretization.cellBasis, discretization.isBasisContinuous, discretization.feSpace);
+
+    assert(_auxiliaryFactory);
+    assert(_normalizer);
+    _auxiliaryFactory->initialize(auxiliaryField, *_normalizer, solution.getSpaceDim());
+
+    // :ATTENTION: The order for adding subfields must match the order of the auxiliary fields in the FE kernels. The
+    // kernels use the last auxiliary subfield for slip.
+    _auxiliaryFactory->addImpulseAmplitude(); // 0
+    _auxiliaryFactory->addSlip(); // 1
+
+    auxiliaryField->subfieldsSetup();
+    auxiliaryField->createDiscretization();
+    pylith::topology::FieldOps::checkDiscretization(solution, *auxiliaryField);
+    auxiliaryField->allocate();
+    auxiliaryField->zeroLocal();
+    auxiliaryField->createGlobalVector();
+    auxiliaryField->createOutputVector();
+
+    assert(_auxiliaryFactory);
+    _auxiliaryFactory->setValuesFromDB();
+
+    _setupImpulses(*auxiliaryField);
+
+    PYLITH_METHOD_RETURN(auxiliaryField);
+} // createAuxiliaryField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create derived field.
+pylith::topology::Field*
+pylith::faults::FaultCohesiveImpulses::createDerivedField(const pylith::topology::Field& solution,
+                                                          const pylith::topology::Mesh& domainMesh) {
+    return NULL;
+} // createDerivedField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update auxiliary fields for impulse.
+void
+pylith::faults::FaultCohesiveImpulses::updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
+                                                            const double t) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("updateAuxiliaryField(auxiliaryField="<<auxiliaryField<<", t="<<t<<")");
+
+    assert(auxiliaryField);
+    assert(_normalizer);
+
+    const size_t impulse = size_t(floor(t * _normalizer->getTimeScale() + 0.5));
+    const size_t numImpulseDOF = _impulseDOF.size();
+    const size_t numImpulsesLocal = _impulsePoints.size() * numImpulseDOF;
+
+    { // Zero slip everywhere and set slip for the impulse if this process owns it.
+        pylith::topology::VecVisitorMesh slipVisitor(*auxiliaryField, "slip");
+        PylithScalar* slipArray = slipVisitor.localArray();
+
+        PetscInt pStart = 0, pEnd = 0;
+        PetscErrorCode err = PetscSectionGetChart(auxiliaryField->localSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        for (PetscInt p = pStart; p < pEnd; ++p) {
+            const PetscInt slipDof = slipVisitor.sectionDof(p);
+            const PetscInt slipOff = slipVisitor.sectionOffset(p);
+            for (PetscInt iDof = 0; iDof < slipDof; ++iDof) {
+                slipArray[slipOff+iDof] = 0.0;
+            } // for
+        } // for
+
+        if ((impulse >= _impulseOffset) && (impulse < _impulseOffset + numImpulsesLocal)) {
+            const size_t iImpulse = impulse - _impulseOffset;
+            const PetscInt point = _impulsePoints[iImpulse / numImpulseDOF];
+            const int component = _impulseDOF[iImpulse % numImpulseDOF];
+
+            pylith::topology::VecVisitorMesh amplitudeVisitor(*auxiliaryField, "impulse_amplitude");
+            const PylithScalar* amplitudeArray = amplitudeVisitor.localArray();
+            const PetscInt amplitudeOff = amplitudeVisitor.sectionOffset(point);
+            const PetscInt slipOff = slipVisitor.sectionOffset(point);
+            assert(component < slipVisitor.sectionDof(point));
+            slipArray[slipOff+component] = amplitudeArray[amplitudeOff];
+        } // if
+    } // Zero slip
+
+    // Update values at points shared with other processes.
+    auxiliaryField->scatterLocalToVector(auxiliaryField->globalVector());
+    auxiliaryField->scatterVectorToLocal(auxiliaryField->globalVector());
+
+    pythia::journal::debug_t debug(pylith::utils::PyreComponent::getName());
+    if (debug.state()) {
+        auxiliaryField->view("Fault auxiliary field after setting slip impulse.");
+    } // if
+
+    PYLITH_METHOD_END;
+} // updateAuxiliaryField
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get auxiliary factory associated with physics.
+pylith::feassemble::AuxiliaryFactory*
+pylith::faults::FaultCohesiveImpulses::_getAuxiliaryFactory(void) {
+    return _auxiliaryFactory;
+} // _getAuxiliaryFactory
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update kernel constants.
+void
+pylith::faults::FaultCohesiveImpulses::_updateKernelConstants(const PylithReal dt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setKernelConstants(dt="<<dt<<")");
+
+    if (6 != _kernelConstants.size()) { _kernelConstants.resize(6);}
+    _kernelConstants[0] = _refDir1[0];
+    _kernelConstants[1] = _refDir1[1];
+    _kernelConstants[2] = _refDir1[2];
+    _kernelConstants[3] = _refDir2[0];
+    _kernelConstants[4] = _refDir2[1];
+    _kernelConstants[5] = _refDir2[2];
+
+    PYLITH_METHOD_END;
+} // _updateKernelConstants
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Find points with impulses and number impulses across processes.
+void
+pylith::faults::FaultCohesiveImpulses::_setupImpulses(const pylith::topology::Field& auxiliaryField) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupImpulses(auxiliaryField="<<auxiliaryField.getLabel()<<")");
+
+    assert(_normalizer);
+    const PylithReal thresholdNondim = _threshold / _normalizer->getLengthScale();
+
+    pylith::topology::VecVisitorMesh amplitudeVisitor(auxiliaryField, "impulse_amplitude");
+    const PylithScalar* amplitudeArray = amplitudeVisitor.localArray();
+    pylith::topology::VecVisitorMesh slipVisitor(auxiliaryField, "slip");
+
+    PetscSection globalSection = auxiliaryField.globalSection();assert(globalSection);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(auxiliaryField.localSection(), &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    // Only count impulses at points owned by this process, so each impulse is applied exactly once.
+    _impulsePoints.clear();
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        if ((amplitudeVisitor.sectionDof(p) <= 0) || (slipVisitor.sectionDof(p) <= 0)) {
+            continue;
+        } // if
+        PetscInt globalDof = 0;
+        err = PetscSectionGetDof(globalSection, p, &globalDof);PYLITH_CHECK_ERROR(err);
+        if (globalDof <= 0) {
+            continue;
+        } // if
+        if (fabs(amplitudeArray[amplitudeVisitor.sectionOffset(p)]) > thresholdNondim) {
+            _impulsePoints.push_back(p);
+        } // if
+    } // for
+
+    // Impulses are numbered by process.
+    PetscInt numImpulsesLocal = _impulsePoints.size() * _impulseDOF.size();
+    PetscInt numImpulsesScan = 0;
+    PetscInt numImpulses = 0;
+    MPI_Comm comm = auxiliaryField.mesh().comm();
+    err = MPI_Scan(&numImpulsesLocal, &numImpulsesScan, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&numImpulsesLocal, &numImpulses, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    _impulseOffset = numImpulsesScan - numImpulsesLocal;
+    _numImpulses = numImpulses;
+
+    PYLITH_COMPONENT_INFO("Fault '" << PyreComponent::getIdentifier() << "' has " << _numImpulses << " slip impulses.");
+
+    PYLITH_METHOD_END;
+} // _setupImpulses
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set kernels for LHS residual.
+void
+pylith::faults::_FaultCohesiveImpulses::setKernelsLHSResidual(pylith::feassemble::IntegratorInterface* integrator,
+                                                              const pylith::faults::FaultCohesiveImpulses& fault,
+                                                              const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_FaultCohesiveImpulses::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "setKernelsLHSResidual(integrator="<<integrator<<", fault="<<typeid(fault).name()
+          <<", solution="<<solution.getLabel()<<")"
+          << pythia::journal::endl;
+
+    std::vector<ResidualKernels> kernels(2);
+
+    // Elasticity equation (displacement).
+    const PetscBdPointFunc f0u = pylith::fekernels::FaultCohesiveKin::f0u;
+    const PetscBdPointFunc f1u = NULL;
+
+    // Fault slip constraint equation.
+    const PetscBdPointFunc f0l = pylith::fekernels::FaultCohesiveKin::f0l_u;
+    const PetscBdPointFunc f1l = NULL;
+
+    kernels[0] = ResidualKernels("displacement", f0u, f1u);
+    kernels[1] = ResidualKernels("lagrange_multiplier_fault", f0l, f1l);
+
+    assert(integrator);
+    integrator->setKernelsLHSResidual(kernels);
+
+    PYLITH_METHOD_END;
+} // setKernelsLHSResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set kernels for LHS Jacobian.
+void
+pylith::faults::_FaultCohesiveImpulses::setKernelsLHSJacobian(pylith::feassemble::IntegratorInterface* integrator,
+                                                              const pylith::faults::FaultCohesiveImpulses& fault,
+                                                              const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_FaultCohesiveImpulses::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "setKernelsLHSJacobian(integrator="<<integrator<<", fault="<<typeid(fault).name()
+          << ", solution="<<solution.getLabel()<<")" << pythia::journal::endl;
+
+    std::vector<JacobianKernels> kernels(2);
+
+    const PetscBdPointJac Jf0ul = pylith::fekernels::FaultCohesiveKin::Jf0ul;
+    const PetscBdPointJac Jf1ul = NULL;
+    const PetscBdPointJac Jf2ul = NULL;
+    const PetscBdPointJac Jf3ul = NULL;
+
+    const PetscBdPointJac Jf0lu = pylith::fekernels::FaultCohesiveKin::Jf0lu;
+    const PetscBdPointJac Jf1lu = NULL;
+    const PetscBdPointJac Jf2lu = NULL;
+    const PetscBdPointJac Jf3lu = NULL;
+
+    const char* nameDisp = "displacement";
+    const char* nameLagrangeMultiplier = "lagrange_multiplier_fault";
+    kernels[0] = JacobianKernels(nameDisp, nameLagrangeMultiplier, Jf0ul, Jf1ul, Jf2ul, Jf3ul);
+    kernels[1] = JacobianKernels(nameLagrangeMultiplier, nameDisp, Jf0lu, Jf1lu, Jf2lu, Jf3lu);
+
+    assert(integrator);
+    integrator->setKernelsLHSJacobian(kernels);
+
+    PYLITH_METHOD_END;
+} // setKernelsLHSJacobian
+
+
+// End of file
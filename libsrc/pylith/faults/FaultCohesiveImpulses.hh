@@ -0,0 +1,184 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/faults/FaultCohesiveImpulses.hh
+ *
+ * @brief C++ implementation for a fault surface with slip impulses for Green's functions implemented with cohesive
+ * elements.
+ *
+ * The impulses are the points in the fault auxiliary field with an impulse amplitude above the threshold, combined
+ * with each of the slip components selected for impulses. Impulses are numbered by process, then by point, and then
+ * by slip component. The time t passed to updateAuxiliaryField() is the (nondimensional) index of the impulse.
+ */
+
+#if !defined(pylith_faults_faultcohesiveimpulses_hh)
+#define pylith_faults_faultcohesiveimpulses_hh
+
+#include "FaultCohesive.hh" // ISA FaultCohesive
+
+#include "pylith/utils/array.hh" // HASA int_array, int_vector
+
+namespace pylith {
+    namespace problems {
+        class TestGreensFns;
+    } // problems
+} // pylith
+
+class pylith::faults::FaultCohesiveImpulses : public pylith::faults::FaultCohesive {
+    friend class TestFaultCohesiveImpulses; // unit testing
+    friend class pylith::problems::TestGreensFns; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Default constructor.
+    FaultCohesiveImpulses(void);
+
+    /// Destructor.
+    ~FaultCohesiveImpulses(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set indices of slip components for impulses.
+     *
+     * @param[in] flags Array of indices of slip components (0=opening, 1=left-lateral, 2=reverse).
+     * @param[in] size Size of array.
+     */
+    void setImpulseDOF(const int* flags,
+                       const int size);
+
+    /** Get number of slip components for impulses.
+     *
+     * @returns Number of slip components.
+     */
+    int getNumImpulseDOF(void) const;
+
+    /** Set threshold for nonzero impulse amplitude.
+     *
+     * @param[in] value Threshold for nonzero amplitude (dimensional).
+     */
+    void setThreshold(const double value);
+
+    /** Get threshold for nonzero impulse amplitude.
+     *
+     * @returns Threshold for nonzero amplitude (dimensional).
+     */
+    double getThreshold(void) const;
+
+    /** Get number of impulses over all processes.
+     *
+     * Number of impulses is not known until the auxiliary field has been created.
+     *
+     * @returns Number of impulses.
+     */
+    size_t getNumImpulses(void) const;
+
+    /** Verify configuration is acceptable.
+     *
+     * @param[in] solution Solution field.
+     */
+    void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+    /** Create integrator and set kernels.
+     *
+     * @param[in] solution Solution field.
+     * @returns Integrator if applicable, otherwise NULL.
+     */
+    pylith::feassemble::Integrator* createIntegrator(const pylith::topology::Field& solution);
+
+    /** Create constraint and set kernels.
+     *
+     * @param[in] solution Solution field.
+     * @returns Constraint if applicable, otherwise NULL.
+     */
+    pylith::feassemble::Constraint* createConstraint(const pylith::topology::Field& solution);
+
+    /** Create auxiliary field.
+     *
+     * @param[in] solution Solution field.
+     * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+     *
+     * @returns Auxiliary field if applicable, otherwise NULL.
+     */
+    pylith::topology::Field* createAuxiliaryField(const pylith::topology::Field& solution,
+                                                  const pylith::topology::Mesh& domainMesh);
+
+    /** Create derived field.
+     *
+     * @param[in] solution Solution field.
+     * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+     *
+     * @returns Derived field if applicable, otherwise NULL.
+     */
+    pylith::topology::Field* createDerivedField(const pylith::topology::Field& solution,
+                                                const pylith::topology::Mesh& domainMesh);
+
+    /** Update auxiliary subfields for impulse.
+     *
+     * @param[out] auxiliaryField Auxiliary field.
+     * @param[in] t Nondimensional time corresponding to index of impulse.
+     */
+    void updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
+                              const double t);
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Get auxiliary factory associated with physics.
+     *
+     * @return Auxiliary factory for physics object.
+     */
+    pylith::feassemble::AuxiliaryFactory* _getAuxiliaryFactory(void);
+
+    /** Update kernel constants.
+     *
+     * @param[in] dt Current time step.
+     */
+    void _updateKernelConstants(const PylithReal dt);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Find points with impulses and number impulses across processes.
+     *
+     * @param[in] auxiliaryField Auxiliary field with impulse amplitude.
+     */
+    void _setupImpulses(const pylith::topology::Field& auxiliaryField);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::faults::AuxiliaryFactoryKinematic* _auxiliaryFactory; ///< Factory for auxiliary subfields.
+    pylith::int_array _impulseDOF; ///< Indices of slip components for impulses.
+    pylith::int_vector _impulsePoints; ///< Local points with impulses (owned by this process).
+    PylithReal _threshold; ///< Threshold for nonzero impulse amplitude (dimensional).
+    size_t _numImpulses; ///< Number of impulses over all processes.
+    size_t _impulseOffset; ///< Index of first impulse on this process.
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    FaultCohesiveImpulses(const FaultCohesiveImpulses&); ///< Not implemented
+    const FaultCohesiveImpulses& operator=(const FaultCohesiveImpulses&); ///< Not implemented.
+
+}; // class FaultCohesiveImpulses
+
+#endif // pylith_faults_faultcohesiveimpulses_hh
+
+// End of file
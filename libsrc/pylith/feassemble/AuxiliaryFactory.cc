@@ -33,7 +33,8 @@
 // Default constructor.
 pylith::feassemble::AuxiliaryFactory::AuxiliaryFactory(void) :
     _queryDB(NULL),
-    _fieldQuery(NULL) {
+    _fieldQuery(NULL),
+    _skipQueryDB(false) {
     GenericComponent::setName("auxiliaryfactory");
 } // constructor
 
@@ -63,6 +64,22 @@ pylith::feassemble::AuxiliaryFactory::getQueryDB(void) const {
 } // getQueryDB
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for skipping query of spatial database when filling auxiliary subfields.
+void
+pylith::feassemble::AuxiliaryFactory::setSkipQueryDB(const bool value) {
+    _skipQueryDB = value;
+} // setSkipQueryDB
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag for skipping query of spatial database when filling auxiliary subfields.
+bool
+pylith::feassemble::AuxiliaryFactory::getSkipQueryDB(void) const {
+    return _skipQueryDB;
+} // getSkipQueryDB
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialie factory for setting up auxiliary subfields.
 void
@@ -89,7 +106,9 @@ pylith::feassemble::AuxiliaryFactory::setValuesFromDB(void) {
 
     assert(_normalizer);
 
-    if (_queryDB) {
+    if (_skipQueryDB) {
+        PYLITH_JOURNAL_DEBUG("Skipping query of spatial database for auxiliary subfields.");
+    } else if (_queryDB) {
         assert(_fieldQuery);
         _fieldQuery->openDB(_queryDB, _normalizer->getLengthScale());
         _fieldQuery->queryDB();
@@ -57,6 +57,20 @@ public:
      */
     const spatialdata::spatialdb::SpatialDB* getQueryDB(void) const;
 
+    /** Set flag for skipping query of spatial database when filling auxiliary subfields.
+     *
+     * Used when restarting from a checkpoint, which supplies the auxiliary subfield values.
+     *
+     * @param[in] value True if query should be skipped, false otherwise.
+     */
+    void setSkipQueryDB(const bool value);
+
+    /** Get flag for skipping query of spatial database when filling auxiliary subfields.
+     *
+     * @returns True if query is skipped, false otherwise.
+     */
+    bool getSkipQueryDB(void) const;
+
     /** Initialize factory for setting up auxiliary subfields.
      *
      * @param[inout] field Auxiliary field for which subfields are to be created.
@@ -99,6 +113,8 @@ protected:
     /// Field query for filling subfield values via spatial database.
     pylith::topology::FieldQuery* _fieldQuery;
 
+    bool _skipQueryDB; ///< True if auxiliary subfields are left at zero rather than filled from database.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -169,6 +169,7 @@ pylith::feassemble::Constraint::initialize(const pylith::topology::Field& soluti
         _observers->setPhysicsImplementation(this);
         _observers->setTimeScale(_physics->getNormalizer().getTimeScale());
     } // if
+    _initializeLogger();
 
     PYLITH_METHOD_END;
 } // initialize
@@ -66,6 +66,7 @@ pylith::feassemble::ConstraintSimple::initialize(const pylith::topology::Field&
 
     assert(_physics);
     _observers = NULL;
+    _initializeLogger();
 
     PetscErrorCode err = 0;
     PetscDM dm = solution.dmMesh();
@@ -150,10 +151,12 @@ pylith::feassemble::ConstraintSimple::setSolution(pylith::topology::Field* solut
     const int fieldIndex = solution->subfieldInfo(_subfieldName.c_str()).index;
     const PylithInt numConstrained = _constrainedDOF.size();
     assert(solution->localVector());
+    _eventBegin(EVENT_SET_SOLUTION);
     err = DMPlexLabelAddCells(dmSoln, dmLabel);PYLITH_CHECK_ERROR(err);
     err = DMPlexInsertBoundaryValuesEssential(dmSoln, t, fieldIndex, numConstrained, &_constrainedDOF[0], dmLabel, 1,
                                               &labelId, _fn, context, solution->localVector());PYLITH_CHECK_ERROR(err);
     err = DMPlexLabelClearCells(dmSoln, dmLabel);PYLITH_CHECK_ERROR(err);
+    _eventEnd(EVENT_SET_SOLUTION);
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
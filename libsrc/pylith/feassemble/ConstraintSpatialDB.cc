@@ -144,11 +144,13 @@ pylith::feassemble::ConstraintSpatialDB::setSolution(pylith::topology::Field* so
     const int fieldIndex = solution->subfieldInfo(_subfieldName.c_str()).index;
     const PylithInt numConstrained = _constrainedDOF.size();
     assert(solution->localVector());
+    _eventBegin(EVENT_SET_SOLUTION);
     err = DMPlexLabelAddFaceCells(dmSoln, dmLabel);PYLITH_CHECK_ERROR(err);
     err = DMPlexInsertBoundaryValuesEssentialBdField(dmSoln, t, solution->localVector(), fieldIndex,
                                                      numConstrained, &_constrainedDOF[0], dmLabel, 1, &labelId,
                                                      _kernelConstraint, context, solution->localVector());PYLITH_CHECK_ERROR(err);
     err = DMPlexLabelClearCells(dmSoln, dmLabel);PYLITH_CHECK_ERROR(err);
+    _eventEnd(EVENT_SET_SOLUTION);
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
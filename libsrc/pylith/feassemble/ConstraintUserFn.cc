@@ -117,10 +117,12 @@ pylith::feassemble::ConstraintUserFn::setSolution(pylith::topology::Field* solut
     const int fieldIndex = solution->subfieldInfo(_subfieldName.c_str()).index;
     const PylithInt numConstrained = _constrainedDOF.size();
     assert(solution->localVector());
+    _eventBegin(EVENT_SET_SOLUTION);
     err = DMPlexLabelAddCells(dmSoln, dmLabel);PYLITH_CHECK_ERROR(err);
     err = DMPlexInsertBoundaryValuesEssential(dmSoln, t, fieldIndex, numConstrained, &_constrainedDOF[0], dmLabel, 1,
                                               &labelId, _fn, context, solution->localVector());PYLITH_CHECK_ERROR(err);
     err = DMPlexLabelClearCells(dmSoln, dmLabel);PYLITH_CHECK_ERROR(err);
+    _eventEnd(EVENT_SET_SOLUTION);
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
@@ -26,6 +26,7 @@
 #include "pylith/problems/Physics.hh" // USES Physics
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
@@ -42,8 +43,12 @@ pylith::feassemble::Integrator::Integrator(pylith::problems::Physics* const phys
     _labelValue(1),
     _lhsJacobianTriggers(NEW_JACOBIAN_NEVER),
     _lhsJacobianLumpedTriggers(NEW_JACOBIAN_NEVER),
+    _lhsJacobianLinearInShift(false),
+    _multirateBin(MULTIRATE_ALL),
+    _haloPart(HALO_ALL),
     _needNewLHSJacobian(true),
-    _needNewLHSJacobianLumped(true)
+    _needNewLHSJacobianLumped(true),
+    _solutionDotEmpty(NULL)
 {}
 
 
@@ -54,6 +59,20 @@ pylith::feassemble::Integrator::~Integrator(void) {
 } // destructor
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::feassemble::Integrator::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PhysicsImplementation::deallocate();
+
+    delete _solutionDotEmpty;_solutionDotEmpty = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set name of label used to identify integration domain.
 void
@@ -129,6 +148,14 @@ pylith::feassemble::Integrator::setLHSJacobianTriggers(const int value) {
 } // setLHSJacobianTriggers
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get LHS Jacobian triggers.
+int
+pylith::feassemble::Integrator::getLHSJacobianTriggers(void) const {
+    return _lhsJacobianTriggers;
+} // getLHSJacobianTriggers
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set LHS lumped Jacobian trigger.
 void
@@ -137,6 +164,88 @@ pylith::feassemble::Integrator::setLHSJacobianLumpedTriggers(const int value) {
 } // setLHSJacobianLumpedTriggers
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag indicating LHS Jacobian depends on time step only through s_tshift.
+void
+pylith::feassemble::Integrator::setLHSJacobianLinearInShift(const bool value) {
+    _lhsJacobianLinearInShift = value;
+} // setLHSJacobianLinearInShift
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag indicating LHS Jacobian depends on time step only through s_tshift.
+bool
+pylith::feassemble::Integrator::isLHSJacobianLinearInShift(void) const {
+    return _lhsJacobianLinearInShift;
+} // isLHSJacobianLinearInShift
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set memory budget for caching cell geometry.
+void
+pylith::feassemble::Integrator::setGeometryCacheBudget(const size_t value) {} // setGeometryCacheBudget
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get memory reserved for cached cell geometry.
+size_t
+pylith::feassemble::Integrator::getGeometryCacheSize(void) const {
+    return 0;
+} // getGeometryCacheSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Mark points in closure of cells that need a time step smaller than the slow time step.
+PylithReal
+pylith::feassemble::Integrator::markMultirateFastPoints(pylith::int_array* fastPoints,
+                                                        const PylithReal dt,
+                                                        const pylith::topology::Field& solution) {
+    return pylith::PYLITH_MAXSCALAR;
+} // markMultirateFastPoints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set cells used in RHS residual evaluations for each multirate bin.
+void
+pylith::feassemble::Integrator::setMultirateFastPoints(const pylith::int_array& fastPoints,
+                                                       const pylith::topology::Field& solution) {} // setMultirateFastPoints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set multirate bin for subsequent RHS residual evaluations.
+void
+pylith::feassemble::Integrator::setMultirateBin(const MultirateBin value) {
+    PYLITH_JOURNAL_DEBUG("setMultirateBin(value="<<value<<")");
+
+    _multirateBin = value;
+} // setMultirateBin
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Split cells into those with and without points shared with other processes.
+void
+pylith::feassemble::Integrator::setHaloSharedPoints(const pylith::int_array& sharedPoints,
+                                                    const pylith::topology::Field& solution) {} // setHaloSharedPoints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether integrator has a separate set of cells without points shared with other processes.
+bool
+pylith::feassemble::Integrator::hasHaloInteriorCells(void) const {
+    return false;
+} // hasHaloInteriorCells
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set part of cells for subsequent residual evaluations.
+void
+pylith::feassemble::Integrator::setHaloPart(const HaloPart value) {
+    PYLITH_JOURNAL_DEBUG("setHaloPart(value="<<value<<")");
+
+    _haloPart = value;
+} // setHaloPart
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize integration domain, auxiliary field, and derived field. Update observers.
 void
@@ -150,6 +259,7 @@ pylith::feassemble::Integrator::initialize(const pylith::topology::Field& soluti
     delete _derivedField;_derivedField = _physics->createDerivedField(solution, physicsDomainMesh);
     _observers = _physics->getObservers();assert(_observers); // Memory managed by Physics
     _observers->setPhysicsImplementation(this);
+    _initializeLogger();
 
     const bool infoOnly = true;
     _observers->notifyObservers(0.0, 0, solution, infoOnly);
@@ -184,7 +294,10 @@ pylith::feassemble::Integrator::poststep(const PylithReal t,
 
     _updateStateVars(t, dt, solution);
 
-    _computeDerivedField(t, dt, solution);
+    // Derived field is only used for output, so skip computing it unless an observer will write it.
+    if (_observers && _observers->willWrite(t, tindex)) {
+        _computeDerivedField(t, dt, solution);
+    } // if
     notifyObservers(t, tindex, solution);
 
     PYLITH_METHOD_END;
@@ -221,6 +334,19 @@ pylith::feassemble::Integrator::_setKernelConstants(const pylith::topology::Fiel
 } // _setKernelConstants
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get empty time derivative of solution for residuals that do not depend on it.
+const pylith::topology::Field&
+pylith::feassemble::Integrator::_getSolutionDotEmpty(const pylith::topology::Field& solution) {
+    if (!_solutionDotEmpty || (&_solutionDotEmpty->mesh() != &solution.mesh())) {
+        delete _solutionDotEmpty;_solutionDotEmpty = new pylith::topology::Field(solution.mesh());assert(_solutionDotEmpty);
+        _solutionDotEmpty->setLabel("solution_dot");
+    } // if
+
+    return *_solutionDotEmpty;
+} // _getSolutionDotEmpty
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Update state variables as needed.
 void
@@ -30,7 +30,8 @@
 #include "pylith/problems/problemsfwd.hh" // HASA Physics
 #include "pylith/topology/topologyfwd.hh" // USES Field
 
-#include "pylith/utils/petscfwd.h" // USES PetscMat, PetscVec
+#include "pylith/utils/arrayfwd.hh" // USES int_array
+#include "pylith/utils/petscfwd.h" // USES PetscMat, PetscVec, PetscViewer
 #include "pylith/utils/utilsfwd.hh" // HOLDSA Logger
 
 class pylith::feassemble::Integrator : public pylith::feassemble::PhysicsImplementation {
@@ -56,6 +57,18 @@ public:
         NEW_JACOBIAN_UPDATE_STATE_VARS=0x4, // Needs new Jacobian after updating state variables.
     };
 
+    enum MultirateBin {
+        MULTIRATE_ALL=0, // All cells.
+        MULTIRATE_SLOW=1, // Cells contributing to degrees of freedom advanced at the slow rate.
+        MULTIRATE_FAST=2, // Cells contributing to degrees of freedom advanced at the fast rate.
+    };
+
+    enum HaloPart {
+        HALO_ALL=0, // All cells.
+        HALO_BOUNDARY=1, // Cells with a point in their closure shared with another process.
+        HALO_INTERIOR=2, // Cells without any points in their closure shared with another process.
+    };
+
     // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -68,6 +81,10 @@ public:
     /// Destructor
     virtual ~Integrator(void);
 
+    /// Deallocate PETSc and local data structures.
+    virtual
+    void deallocate(void);
+
     /** Set name of label used to identify integration domain.
      *
      * @param name Name of label.
@@ -112,12 +129,104 @@ public:
      */
     void setLHSJacobianTriggers(const int value);
 
+    /** Get LHS Jacobian triggers.
+     *
+     * @returns Triggers for needing new LHS Jacobian.
+     */
+    int getLHSJacobianTriggers(void) const;
+
     /** Set LHS lumped Jacobian trigger.
      *
      * @param[in] value Triggers for needing new LHS lumped Jacobian.
      */
     void setLHSJacobianLumpedTriggers(const int value);
 
+    /** Set flag indicating LHS Jacobian depends on time step only through s_tshift.
+     *
+     * The LHS Jacobian has the form J = K + s_tshift M, so when only the time step changes the Jacobian can be
+     * recombined from K and M rather than reassembled.
+     *
+     * @param[in] value True if LHS Jacobian depends on time step only through s_tshift, false otherwise.
+     */
+    void setLHSJacobianLinearInShift(const bool value);
+
+    /** Get flag indicating LHS Jacobian depends on time step only through s_tshift.
+     *
+     * @returns True if LHS Jacobian depends on time step only through s_tshift, false otherwise.
+     */
+    bool isLHSJacobianLinearInShift(void) const;
+
+    /** Set memory budget for caching cell geometry between residual and Jacobian evaluations.
+     *
+     * Integrators that do not integrate over cells ignore the budget.
+     *
+     * @param[in] value Maximum number of bytes for cached geometry.
+     */
+    virtual
+    void setGeometryCacheBudget(const size_t value);
+
+    /** Get memory reserved for cached cell geometry.
+     *
+     * @returns Estimated number of bytes used by cached geometry.
+     */
+    virtual
+    size_t getGeometryCacheSize(void) const;
+
+    /** Mark points in the closure of cells that need a time step smaller than the slow time step for stable explicit
+     * time stepping.
+     *
+     * Integrators that do not integrate over cells do not limit the time step.
+     *
+     * @param[inout] fastPoints Flags for points in solution mesh (1 if advanced at the fast rate, 0 otherwise).
+     * @param[in] dt Time step for the slow rate.
+     * @param[in] solution Solution field.
+     * @returns Minimum stable time step over cells in integration domain.
+     */
+    virtual
+    PylithReal markMultirateFastPoints(pylith::int_array* fastPoints,
+                                       const PylithReal dt,
+                                       const pylith::topology::Field& solution);
+
+    /** Set cells used in RHS residual evaluations for each multirate bin.
+     *
+     * @param[in] fastPoints Flags for points in solution mesh (consistent across processes).
+     * @param[in] solution Solution field.
+     */
+    virtual
+    void setMultirateFastPoints(const pylith::int_array& fastPoints,
+                                const pylith::topology::Field& solution);
+
+    /** Set multirate bin for subsequent RHS residual evaluations.
+     *
+     * @param[in] value Multirate bin.
+     */
+    void setMultirateBin(const MultirateBin value);
+
+    /** Split cells into those with and without points shared with other processes, so that residual contributions
+     * from shared points can be communicated while the other cells are integrated.
+     *
+     * Integrators that do not split their cells integrate all of them with the cells that have shared points.
+     *
+     * @param[in] sharedPoints Flags for points in solution mesh (1 if shared with another process, 0 otherwise).
+     * @param[in] solution Solution field.
+     */
+    virtual
+    void setHaloSharedPoints(const pylith::int_array& sharedPoints,
+                             const pylith::topology::Field& solution);
+
+    /** Check whether integrator has a separate set of cells without points shared with other processes.
+     *
+     * @returns True if residual evaluations for HALO_INTERIOR integrate cells, false otherwise.
+     */
+    virtual
+    bool hasHaloInteriorCells(void) const;
+
+    /** Set part of cells for subsequent residual evaluations.
+     *
+     * @param[in] value Part of cells relative to points shared with other processes.
+     */
+    void setHaloPart(const HaloPart value);
+
     /** Initialize integration domain, auxiliary field, and derived field. Update observers.
      *
      * @param[in] solution Solution field (layout).
@@ -192,6 +301,27 @@ public:
                             const pylith::topology::Field& solution,
                             const pylith::topology::Field& solutionDot) = 0;
 
+    /** Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector for matrix-free implicit time-stepping.
+     *
+     * The action is added to the local vector of the action field.
+     *
+     * @param[inout] action Field for action of Jacobian.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] s_tshift Scale for time derivative.
+     * @param[in] solution Field with trial solution at which Jacobian is evaluated.
+     * @param[in] solutionDot Field with time derivative of trial solution at which Jacobian is evaluated.
+     * @param[in] inputVec PETSc Vec (local) that Jacobian acts on.
+     */
+    virtual
+    void computeLHSJacobianAction(pylith::topology::Field* action,
+                                  const PylithReal t,
+                                  const PylithReal dt,
+                                  const PylithReal s_tshift,
+                                  const pylith::topology::Field& solution,
+                                  const pylith::topology::Field& solutionDot,
+                                  PetscVec inputVec) = 0;
+
     /** Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}) with explicit time-stepping.
      *
      * @param[out] jacobianInv Inverse of lumped Jacobian as a field.
@@ -219,6 +349,15 @@ protected:
     void _setKernelConstants(const pylith::topology::Field& solution,
                              const PylithReal dt) const;
 
+    /** Get empty time derivative of solution for residuals that do not depend on it.
+     *
+     * The field is created on first use and reused for all later residual evaluations.
+     *
+     * @param[in] solution Field with current trial solution.
+     * @returns Field without values over the same mesh as the solution.
+     */
+    const pylith::topology::Field& _getSolutionDotEmpty(const pylith::topology::Field& solution);
+
     /** Update state variables as needed.
      *
      * @param[in] t Current time.
@@ -249,12 +388,17 @@ protected:
 
     int _lhsJacobianTriggers; // Triggers for needing new LHS Jacobian.
     int _lhsJacobianLumpedTriggers; // Triggers for needing new LHS lumped Jacobian.
+    bool _lhsJacobianLinearInShift; ///< True if LHS Jacobian depends on time step only through s_tshift.
+    MultirateBin _multirateBin; ///< Bin of cells used in RHS residual evaluations.
+    HaloPart _haloPart; ///< Part of cells used in residual evaluations.
 
     /// True if we need to recompute Jacobian for operator, false otherwise.
     /// Default is false;
     bool _needNewLHSJacobian;
     bool _needNewLHSJacobianLumped;
 
+    pylith::topology::Field* _solutionDotEmpty; ///< Empty time derivative of solution for RHS residual.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -29,8 +29,10 @@
 #include "spatialdata/spatialdb/GravityField.hh" // HASA GravityField
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/array.hh" // USES scalar_array
 
 #include "petscds.h" // USES PetscDS
+#include "petscdmfield.h" // USES DMField
 
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
@@ -61,6 +63,61 @@ public:
                                  const pylith::topology::Field& solution,
                                  const pylith::topology::Field& solutionDot);
 
+            /** Compute residual for all kernels in a single traversal of the boundary faces.
+             *
+             * @param[out] residual Field for residual.
+             * @param[in] integrator Integrator for boundary.
+             * @param[in] kernels Kernels for computing residual.
+             * @param[in] t Current time.
+             * @param[in] solution Field with current trial solution.
+             * @param[in] solutionDot Field with time derivative of current trial solution.
+             */
+            static
+            void computeResidualFused(pylith::topology::Field* residual,
+                                      const pylith::feassemble::IntegratorBoundary* integrator,
+                                      const std::vector<pylith::feassemble::IntegratorBoundary::ResidualKernels>& kernels,
+                                      const PylithReal t,
+                                      const pylith::topology::Field& solution,
+                                      const pylith::topology::Field& solutionDot);
+
+            /** Create boundary faces and their geometry for fused residual computation.
+             *
+             * The geometry is left NULL if the kernels use different face quadratures on non-affine cells, in which
+             * case the kernels are integrated one field at a time.
+             *
+             * @param[inout] integrator Integrator for boundary.
+             * @param[in] solution Solution field (layout).
+             */
+            static
+            void setupFaces(pylith::feassemble::IntegratorBoundary* integrator,
+                            const pylith::topology::Field& solution);
+
+            /** Register kernels with weak form and set auxiliary field for boundary.
+             *
+             * @param[in] integrator Integrator for boundary.
+             * @param[in] kernels Kernels for computing residual.
+             * @param[in] solution Solution field (layout).
+             */
+            static
+            void setWeakFormKernels(const pylith::feassemble::IntegratorBoundary* integrator,
+                                    const std::vector<pylith::feassemble::IntegratorBoundary::ResidualKernels>& kernels,
+                                    const pylith::topology::Field& solution);
+
+            /** Check whether weak form holds kernels and auxiliary field for boundary.
+             *
+             * Integrators over the same boundary (label and label value) share the same weak form key, so the
+             * registration from another integrator may have replaced the kernels for this integrator.
+             *
+             * @param[in] integrator Integrator for boundary.
+             * @param[in] kernels Kernels for computing residual.
+             * @param[in] solution Solution field (layout).
+             * @returns True if weak form holds kernels and auxiliary field for boundary, false otherwise.
+             */
+            static
+            bool hasWeakFormKernels(const pylith::feassemble::IntegratorBoundary* integrator,
+                                    const std::vector<pylith::feassemble::IntegratorBoundary::ResidualKernels>& kernels,
+                                    const pylith::topology::Field& solution);
+
             static const char* genericComponent;
         }; // _IntegratorBoundary
         const char* _IntegratorBoundary::genericComponent = "integratorboundary";
@@ -73,7 +130,11 @@ public:
 pylith::feassemble::IntegratorBoundary::IntegratorBoundary(pylith::problems::Physics* const physics) :
     Integrator(physics),
     _boundaryMesh(NULL),
-    _boundarySurfaceLabel("") {
+    _boundarySurfaceLabel(""),
+    _boundaryDMLabel(NULL),
+    _boundaryFacesIS(NULL),
+    _boundaryFacesQuadrature(NULL),
+    _boundaryFacesGeom(NULL) {
     GenericComponent::setName(_IntegratorBoundary::genericComponent);
 } // constructor
 
@@ -94,6 +155,11 @@ pylith::feassemble::IntegratorBoundary::deallocate(void) {
     Integrator::deallocate();
 
     delete _boundaryMesh;_boundaryMesh = NULL;
+    _boundaryDMLabel = NULL; // Memory managed by solution DM.
+
+    PetscErrorCode err = PetscFEGeomDestroy(&_boundaryFacesGeom);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureDestroy(&_boundaryFacesQuadrature);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_boundaryFacesIS);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -168,6 +234,14 @@ pylith::feassemble::IntegratorBoundary::initialize(const pylith::topology::Field
 
     Integrator::initialize(solution);
 
+    PetscErrorCode err = DMGetLabel(solution.dmMesh(), _boundarySurfaceLabel.c_str(), &_boundaryDMLabel);PYLITH_CHECK_ERROR(err);
+    if (_kernelsLHSResidual.size() > 0) {
+        _IntegratorBoundary::setWeakFormKernels(this, _kernelsLHSResidual, solution);
+    } else if (_kernelsRHSResidual.size() > 0) {
+        _IntegratorBoundary::setWeakFormKernels(this, _kernelsRHSResidual, solution);
+    } // if/else
+    _IntegratorBoundary::setupFaces(this, solution);
+
     PYLITH_METHOD_END;
 } // initialize
 
@@ -209,11 +283,13 @@ pylith::feassemble::IntegratorBoundary::computeRHSResidual(pylith::topology::Fie
 
     if (0 == _kernelsRHSResidual.size()) { PYLITH_METHOD_END;}
 
+    _eventBegin(EVENT_COMPUTE_RHS_RESIDUAL);
     _setKernelConstants(solution, dt);
 
-    pylith::topology::Field solutionDot(solution.mesh()); // No dependence on time derivative of solution in RHS.
-    solutionDot.setLabel("solution_dot");
+    // No dependence on time derivative of solution in RHS.
+    const pylith::topology::Field& solutionDot = _getSolutionDotEmpty(solution);
     _IntegratorBoundary::computeResidual(residual, this, _kernelsRHSResidual, t, dt, solution, solutionDot);
+    _eventEnd(EVENT_COMPUTE_RHS_RESIDUAL);
 
     PYLITH_METHOD_END;
 } // computeRHSResidual
@@ -232,9 +308,13 @@ pylith::feassemble::IntegratorBoundary::computeLHSResidual(pylith::topology::Fie
 
     if (0 == _kernelsLHSResidual.size()) { PYLITH_METHOD_END;}
 
+    _eventBegin(EVENT_COMPUTE_LHS_RESIDUAL);
     _setKernelConstants(solution, dt);
 
     _IntegratorBoundary::computeResidual(residual, this, _kernelsLHSResidual, t, dt, solution, solutionDot);
+    _eventEnd(EVENT_COMPUTE_LHS_RESIDUAL);
+
+    PYLITH_METHOD_END;
 } // computeLHSResidual
 
 
@@ -258,6 +338,25 @@ pylith::feassemble::IntegratorBoundary::computeLHSJacobian(PetscMat jacobianMat,
 } // computeLHSJacobian
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector.
+void
+pylith::feassemble::IntegratorBoundary::computeLHSJacobianAction(pylith::topology::Field* action,
+                                                                 const PylithReal t,
+                                                                 const PylithReal dt,
+                                                                 const PylithReal s_tshift,
+                                                                 const pylith::topology::Field& solution,
+                                                                 const pylith::topology::Field& solutionDot,
+                                                                 PetscVec inputVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("computeLHSJacobianAction(action="<<action<<", t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solution="<<solution.getLabel()<<", solutionDot="<<solutionDot.getLabel()<<", inputVec="<<inputVec<<") empty method");
+
+    // Boundary conditions only have residual kernels, so they add nothing to the action, as in computeLHSJacobian().
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Compute LHS Jacobian for F(t,s,\dot{s}).
 void
@@ -298,6 +397,15 @@ pylith::feassemble::_IntegratorBoundary::computeResidual(pylith::topology::Field
     assert(residual);
     PetscErrorCode err;
 
+    if (!hasWeakFormKernels(integrator, kernels, solution)) {
+        setWeakFormKernels(integrator, kernels, solution);
+    } // if
+
+    if (integrator->_boundaryFacesGeom) {
+        computeResidualFused(residual, integrator, kernels, t, solution, solutionDot);
+        PYLITH_METHOD_END;
+    } // if
+
     // :KLUDGE: Potentially we may have multiple PetscDS objects. This assumes that the first one (with a NULL label) is
     // the correct one.
     PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
@@ -306,26 +414,9 @@ pylith::feassemble::_IntegratorBoundary::computeResidual(pylith::topology::Field
     PetscWeakForm weakForm = NULL;
     err = PetscDSGetWeakForm(dsSoln, &weakForm);PYLITH_CHECK_ERROR(err);
 
-    PetscDMLabel dmLabel = NULL;
-    err = DMGetLabel(dmSoln, integrator->getMarkerLabel(), &dmLabel);PYLITH_CHECK_ERROR(err);
+    PetscDMLabel dmLabel = integrator->_boundaryDMLabel;assert(dmLabel);
     const PetscInt labelValue = integrator->getLabelValue();
 
-    { // :TODO: Move to initialization phase
-      // Must use PetscWeakFormAddBdResidual() when moved to initialization.
-        for (size_t i = 0; i < kernels.size(); ++i) {
-            const PetscInt i_field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
-            const PetscInt i_part = pylith::feassemble::Integrator::RESIDUAL_LHS;
-            err = PetscWeakFormSetIndexBdResidual(weakForm, dmLabel, labelValue, i_field, i_part,
-                                                  0, kernels[i].r0, 0, kernels[i].r1);PYLITH_CHECK_ERROR(err);
-        } // for
-        if (debug.state()) {
-            err = PetscDSView(dsSoln, PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
-        } // if
-
-        const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
-        err = DMSetAuxiliaryVec(dmSoln, dmLabel, labelValue, auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
-    } // Move to initialization phase
-
     // Compute the local residual
     // solution.mesh().view(":mesh.txt:ascii_info_detail"); // :DEBUG:
     assert(solution.localVector());
@@ -342,4 +433,294 @@ pylith::feassemble::_IntegratorBoundary::computeResidual(pylith::topology::Field
 } // _computeResidual
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute residual for all kernels in a single traversal of the boundary faces.
+void
+pylith::feassemble::_IntegratorBoundary::computeResidualFused(pylith::topology::Field* residual,
+                                                              const pylith::feassemble::IntegratorBoundary* integrator,
+                                                              const std::vector<pylith::feassemble::IntegratorBoundary::ResidualKernels>& kernels,
+                                                              const PylithReal t,
+                                                              const pylith::topology::Field& solution,
+                                                              const pylith::topology::Field& solutionDot) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_IntegratorBoundary::genericComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "_IntegratorBoundary::computeResidualFused(residual="<<residual<<", integrator="<<integrator
+          <<", # kernels="<<kernels.size()<<", t="<<t<<", solution="<<solution.getLabel()
+          <<", solutionDot="<<solutionDot.getLabel()<<")"
+          << pythia::journal::endl;
+
+    assert(integrator);
+    assert(integrator->_boundaryFacesIS);
+    assert(integrator->_boundaryFacesGeom);
+    assert(residual);
+    PetscErrorCode err;
+
+    PetscInt numFaces = 0;
+    err = ISGetLocalSize(integrator->_boundaryFacesIS, &numFaces);PYLITH_CHECK_ERROR(err);
+    if (!numFaces) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscSection solnSection = solution.localSection();assert(solnSection);
+    PetscVec solnVec = solution.localVector();assert(solnVec);
+    PetscVec solnDotVec = solutionDot.localVector(); // NULL for RHS residual.
+    PetscDS dsSoln = NULL;
+    err = DMGetDS(dmSoln, &dsSoln);PYLITH_CHECK_ERROR(err);assert(dsSoln);
+    PetscWeakForm weakForm = NULL;
+    err = PetscDSGetWeakForm(dsSoln, &weakForm);PYLITH_CHECK_ERROR(err);
+    PetscInt solnTotalDim = 0;
+    err = PetscDSGetTotalDimension(dsSoln, &solnTotalDim);PYLITH_CHECK_ERROR(err);
+
+    const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
+    PetscDM dmAux = auxiliaryField->dmMesh();assert(dmAux);
+    PetscSection auxSection = auxiliaryField->localSection();assert(auxSection);
+    PetscVec auxVec = auxiliaryField->localVector();assert(auxVec);
+    PetscDS dsAux = NULL;
+    err = DMGetDS(dmAux, &dsAux);PYLITH_CHECK_ERROR(err);assert(dsAux);
+    PetscInt auxTotalDim = 0;
+    err = PetscDSGetTotalDimension(dsAux, &auxTotalDim);PYLITH_CHECK_ERROR(err);
+    DMEnclosureType auxEnclosure;
+    err = DMGetEnclosureRelation(dmAux, dmSoln, &auxEnclosure);PYLITH_CHECK_ERROR(err);
+
+    pylith::scalar_array solnCells(numFaces*solnTotalDim);
+    pylith::scalar_array solnDotCells(solnDotVec ? numFaces*solnTotalDim : 0);
+    pylith::scalar_array auxCells(numFaces*auxTotalDim);
+    pylith::scalar_array residualCells(0.0, numFaces*solnTotalDim);
+
+    // Gather closures of the cells adjacent to the boundary faces once for all kernels.
+    const PetscInt* faces = NULL;
+    err = ISGetIndices(integrator->_boundaryFacesIS, &faces);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iFace = 0; iFace < numFaces; ++iFace) {
+        const PetscInt* support = NULL;
+        err = DMPlexGetSupport(dmSoln, faces[iFace], &support);PYLITH_CHECK_ERROR(err);
+
+        PetscScalar* closure = NULL;
+        err = DMPlexVecGetClosure(dmSoln, solnSection, solnVec, support[0], NULL, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < solnTotalDim; ++i) {
+            solnCells[iFace*solnTotalDim+i] = closure[i];
+        } // for
+        err = DMPlexVecRestoreClosure(dmSoln, solnSection, solnVec, support[0], NULL, &closure);PYLITH_CHECK_ERROR(err);
+
+        if (solnDotVec) {
+            err = DMPlexVecGetClosure(dmSoln, solnSection, solnDotVec, support[0], NULL, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt i = 0; i < solnTotalDim; ++i) {
+                solnDotCells[iFace*solnTotalDim+i] = closure[i];
+            } // for
+            err = DMPlexVecRestoreClosure(dmSoln, solnSection, solnDotVec, support[0], NULL, &closure);PYLITH_CHECK_ERROR(err);
+        } // if
+
+        PetscInt auxPoint = -1;
+        err = DMGetEnclosurePoint(dmAux, dmSoln, auxEnclosure, faces[iFace], &auxPoint);PYLITH_CHECK_ERROR(err);
+        err = DMPlexVecGetClosure(dmAux, auxSection, auxVec, auxPoint, NULL, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < auxTotalDim; ++i) {
+            auxCells[iFace*auxTotalDim+i] = closure[i];
+        } // for
+        err = DMPlexVecRestoreClosure(dmAux, auxSection, auxVec, auxPoint, NULL, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Integrate kernels for all subfields into the same element vectors.
+    PetscFormKey key;
+    key.label = integrator->_boundaryDMLabel;
+    key.value = integrator->getLabelValue();
+    key.part = pylith::feassemble::Integrator::RESIDUAL_LHS;
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        key.field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
+        err = PetscFEIntegrateBdResidual(dsSoln, weakForm, key, numFaces, integrator->_boundaryFacesGeom,
+                                         &solnCells[0], solnDotVec ? &solnDotCells[0] : NULL,
+                                         dsAux, &auxCells[0], t, &residualCells[0]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    for (PetscInt iFace = 0; iFace < numFaces; ++iFace) {
+        const PetscInt* support = NULL;
+        err = DMPlexGetSupport(dmSoln, faces[iFace], &support);PYLITH_CHECK_ERROR(err);
+        err = DMPlexVecSetClosure(dmSoln, NULL, residual->localVector(), support[0], &residualCells[iFace*solnTotalDim],
+                                  ADD_ALL_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(integrator->_boundaryFacesIS, &faces);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // computeResidualFused
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create boundary faces and their geometry for fused residual computation.
+void
+pylith::feassemble::_IntegratorBoundary::setupFaces(pylith::feassemble::IntegratorBoundary* integrator,
+                                                    const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_IntegratorBoundary::genericComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "_IntegratorBoundary::setupFaces(integrator="<<integrator<<", solution="<<solution.getLabel()<<")"
+          << pythia::journal::endl;
+
+    assert(integrator);
+    PetscErrorCode err;
+
+    err = PetscFEGeomDestroy(&integrator->_boundaryFacesGeom);PYLITH_CHECK_ERROR(err);
+    err = PetscQuadratureDestroy(&integrator->_boundaryFacesQuadrature);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&integrator->_boundaryFacesIS);PYLITH_CHECK_ERROR(err);
+
+    const std::vector<pylith::feassemble::IntegratorBoundary::ResidualKernels>& kernels =
+        (integrator->_kernelsLHSResidual.size() > 0) ? integrator->_kernelsLHSResidual : integrator->_kernelsRHSResidual;
+    if (0 == kernels.size()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Boundary faces are the faces (height 1) marked by the boundary label.
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscDMLabel dmLabel = integrator->_boundaryDMLabel;assert(dmLabel);
+    PetscInt dim = 0;
+    err = DMGetDimension(dmSoln, &dim);PYLITH_CHECK_ERROR(err);
+    PetscDMLabel depthLabel = NULL;
+    err = DMPlexGetDepthLabel(dmSoln, &depthLabel);PYLITH_CHECK_ERROR(err);
+    PetscIS facetsIS = NULL;
+    err = DMLabelGetStratumIS(depthLabel, dim-1, &facetsIS);PYLITH_CHECK_ERROR(err);
+    PetscIS pointsIS = NULL;
+    err = DMLabelGetStratumIS(dmLabel, integrator->getLabelValue(), &pointsIS);PYLITH_CHECK_ERROR(err);
+    if (facetsIS && pointsIS) {
+        err = ISIntersect(facetsIS, pointsIS, &integrator->_boundaryFacesIS);PYLITH_CHECK_ERROR(err);
+    } else { // No boundary faces on this process.
+        err = ISCreateStride(PETSC_COMM_SELF, 0, 0, 1, &integrator->_boundaryFacesIS);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = ISDestroy(&facetsIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    PetscInt numFaces = 0;
+    err = ISGetLocalSize(integrator->_boundaryFacesIS, &numFaces);PYLITH_CHECK_ERROR(err);
+    if (!numFaces) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Affine faces use the default quadrature of the coordinate field for all subfields. Otherwise the geometry is
+    // computed at the face quadrature points, so all subfields with kernels must use the same face quadrature.
+    PetscDS dsSoln = NULL;
+    err = DMGetDS(dmSoln, &dsSoln);PYLITH_CHECK_ERROR(err);assert(dsSoln);
+    DMField coordField = NULL;
+    err = DMGetCoordinateField(dmSoln, &coordField);PYLITH_CHECK_ERROR(err);
+    PetscInt maxDegree = 0;
+    err = DMFieldGetDegree(coordField, integrator->_boundaryFacesIS, NULL, &maxDegree);PYLITH_CHECK_ERROR(err);
+    PetscQuadrature quadrature = NULL;
+    if (maxDegree <= 1) {
+        err = DMFieldCreateDefaultQuadrature(coordField, integrator->_boundaryFacesIS, &quadrature);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (!quadrature) {
+        PetscInt numPoints = -1;
+        for (size_t i = 0; i < kernels.size(); ++i) {
+            const PetscInt i_field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
+            PetscObject discretization = NULL;
+            err = PetscDSGetDiscretization(dsSoln, i_field, &discretization);PYLITH_CHECK_ERROR(err);
+            PetscQuadrature faceQuadrature = NULL;
+            err = PetscFEGetFaceQuadrature((PetscFE)discretization, &faceQuadrature);PYLITH_CHECK_ERROR(err);
+            PetscInt faceNumPoints = 0;
+            err = PetscQuadratureGetData(faceQuadrature, NULL, NULL, &faceNumPoints, NULL, NULL);PYLITH_CHECK_ERROR(err);
+            if ((numPoints >= 0) && (faceNumPoints != numPoints)) {
+                err = PetscQuadratureDestroy(&quadrature);PYLITH_CHECK_ERROR(err);
+                debug << pythia::journal::at(__HERE__)
+                      << "Face quadrature differs among subfields; integrating boundary kernels one field at a time."
+                      << pythia::journal::endl;
+                PYLITH_METHOD_END;
+            } // if
+            if (!quadrature) {
+                quadrature = faceQuadrature;
+                err = PetscObjectReference((PetscObject)quadrature);PYLITH_CHECK_ERROR(err);
+                numPoints = faceNumPoints;
+            } // if
+        } // for
+    } // if
+    integrator->_boundaryFacesQuadrature = quadrature;
+    err = DMFieldCreateFEGeom(coordField, integrator->_boundaryFacesIS, quadrature, PETSC_TRUE,
+                              &integrator->_boundaryFacesGeom);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setupFaces
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Register kernels with weak form and set auxiliary field for boundary.
+void
+pylith::feassemble::_IntegratorBoundary::setWeakFormKernels(const pylith::feassemble::IntegratorBoundary* integrator,
+                                                            const std::vector<pylith::feassemble::IntegratorBoundary::ResidualKernels>& kernels,
+                                                            const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_IntegratorBoundary::genericComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "_IntegratorBoundary::setWeakFormKernels(integrator="<<integrator<<", # kernels="<<kernels.size()
+          <<", solution="<<solution.getLabel()<<")"
+          << pythia::journal::endl;
+
+    assert(integrator);
+    PetscErrorCode err;
+
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscDS dsSoln = NULL;
+    err = DMGetDS(dmSoln, &dsSoln);PYLITH_CHECK_ERROR(err);assert(dsSoln);
+    PetscWeakForm weakForm = NULL;
+    err = PetscDSGetWeakForm(dsSoln, &weakForm);PYLITH_CHECK_ERROR(err);
+
+    PetscDMLabel dmLabel = integrator->_boundaryDMLabel;assert(dmLabel);
+    const PetscInt labelValue = integrator->getLabelValue();
+
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        const PetscInt i_field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
+        const PetscInt i_part = pylith::feassemble::Integrator::RESIDUAL_LHS;
+        err = PetscWeakFormSetIndexBdResidual(weakForm, dmLabel, labelValue, i_field, i_part,
+                                              0, kernels[i].r0, 0, kernels[i].r1);PYLITH_CHECK_ERROR(err);
+    } // for
+    if (debug.state()) {
+        err = PetscDSView(dsSoln, PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
+    err = DMSetAuxiliaryVec(dmSoln, dmLabel, labelValue, auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // setWeakFormKernels
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether weak form holds kernels and auxiliary field for boundary.
+bool
+pylith::feassemble::_IntegratorBoundary::hasWeakFormKernels(const pylith::feassemble::IntegratorBoundary* integrator,
+                                                            const std::vector<pylith::feassemble::IntegratorBoundary::ResidualKernels>& kernels,
+                                                            const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(integrator);
+    PetscErrorCode err;
+
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscDMLabel dmLabel = integrator->_boundaryDMLabel;assert(dmLabel);
+    const PetscInt labelValue = integrator->getLabelValue();
+
+    const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
+    PetscVec auxiliaryVec = NULL;
+    err = DMGetAuxiliaryVec(dmSoln, dmLabel, labelValue, &auxiliaryVec);PYLITH_CHECK_ERROR(err);
+    if (auxiliaryVec != auxiliaryField->localVector()) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscDS dsSoln = NULL;
+    err = DMGetDS(dmSoln, &dsSoln);PYLITH_CHECK_ERROR(err);assert(dsSoln);
+    PetscWeakForm weakForm = NULL;
+    err = PetscDSGetWeakForm(dsSoln, &weakForm);PYLITH_CHECK_ERROR(err);
+
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        const PetscInt i_field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
+        const PetscInt i_part = pylith::feassemble::Integrator::RESIDUAL_LHS;
+        PetscInt numR0 = 0, numR1 = 0;
+        PetscBdPointFunc* r0 = NULL;
+        PetscBdPointFunc* r1 = NULL;
+        err = PetscWeakFormGetBdResidual(weakForm, dmLabel, labelValue, i_field, i_part, &numR0, &r0, &numR1, &r1);PYLITH_CHECK_ERROR(err);
+        const bool hasR0 = (kernels[i].r0) ? (numR0 > 0 && r0[0] == kernels[i].r0) : (0 == numR0 || !r0[0]);
+        const bool hasR1 = (kernels[i].r1) ? (numR1 > 0 && r1[0] == kernels[i].r1) : (0 == numR1 || !r1[0]);
+        if (!hasR0 || !hasR1) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    PYLITH_METHOD_RETURN(true);
+} // hasWeakFormKernels
+
+
 // End of file
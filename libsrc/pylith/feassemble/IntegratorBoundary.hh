@@ -33,6 +33,7 @@
 
 class pylith::feassemble::IntegratorBoundary : public pylith::feassemble::Integrator {
     friend class TestIntegratorBoundary; // unit testing
+    friend class _IntegratorBoundary; // private utility functions
 
     // PUBLIC STRUCTS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -158,6 +159,26 @@ public:
                             const pylith::topology::Field& solution,
                             const pylith::topology::Field& solutionDot);
 
+    /** Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector for matrix-free implicit time-stepping.
+     *
+     * Boundary conditions do not contribute to the LHS Jacobian, so the action is unchanged.
+     *
+     * @param[inout] action Field for action of Jacobian.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] s_tshift Scale for time derivative.
+     * @param[in] solution Field with trial solution at which Jacobian is evaluated.
+     * @param[in] solutionDot Field with time derivative of trial solution at which Jacobian is evaluated.
+     * @param[in] inputVec PETSc Vec (local) that Jacobian acts on.
+     */
+    void computeLHSJacobianAction(pylith::topology::Field* action,
+                                  const PylithReal t,
+                                  const PylithReal dt,
+                                  const PylithReal s_tshift,
+                                  const pylith::topology::Field& solution,
+                                  const pylith::topology::Field& solutionDot,
+                                  PetscVec inputVec);
+
     /** Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}) with explicit time-stepping.
      *
      * @param[out] jacobianInv Inverse of lumped Jacobian as a field.
@@ -180,6 +201,10 @@ private:
 
     pylith::topology::Mesh* _boundaryMesh; ///< Boundary mesh.
     std::string _boundarySurfaceLabel; ///< Name of label identifying boundary surface.
+    PetscDMLabel _boundaryDMLabel; ///< PETSc label identifying boundary surface in solution DM.
+    PetscIS _boundaryFacesIS; ///< Faces on boundary surface.
+    PetscQuadrature _boundaryFacesQuadrature; ///< Quadrature used for geometry of boundary faces.
+    PetscFEGeom* _boundaryFacesGeom; ///< Geometry of boundary faces (NULL if kernels are integrated one field at a time).
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -30,9 +30,15 @@
 #include "petscds.h" // USES PetscDS
 
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
+#include "pylith/utils/array.hh" // USES int_array
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include <cassert> // USES assert()
+#include <cmath> // USES sqrt()
 #include <stdexcept> // USES std::runtime_error
+#include <limits> // USES std::numeric_limits
+#include <algorithm> // USES std::max(), std::min()
+#include <vector> // USES std::vector
 
 extern "C" PetscErrorCode DMPlexComputeResidual_Internal(PetscDM dm,
                                                          PetscFormKey key,
@@ -66,14 +72,55 @@ extern "C" PetscErrorCode DMPlexComputeJacobian_Action_Internal(DM,
                                                                 Vec,
                                                                 void *);
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Local "private" functions.
+namespace pylith {
+    namespace feassemble {
+        class _IntegratorDomain {
+public:
+
+            /** Create key for kernels in weak form.
+             *
+             * @param[in] label Label identifying integration domain.
+             * @param[in] value Value of label identifying integration domain.
+             * @param[in] part Part of residual or Jacobian.
+             * @returns Key for weak form.
+             */
+            static
+            PetscFormKey createKey(PetscDMLabel label,
+                                   const PetscInt value,
+                                   const PetscInt part);
+
+        }; // _IntegratorDomain
+    } // feassemble
+} // pylith
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Default constructor.
 pylith::feassemble::IntegratorDomain::IntegratorDomain(pylith::problems::Physics* const physics) :
     Integrator(physics),
     _materialMesh(NULL),
-    _updateState(NULL) {
+    _updateState(NULL),
+    _cellsIS(NULL),
+    _cellsSlowIS(NULL),
+    _cellsFastIS(NULL),
+    _cellsHaloBoundaryIS(NULL),
+    _cellsHaloInteriorIS(NULL),
+    _geometryCacheBudget(std::numeric_limits<size_t>::max()),
+    _geometryCacheSize(0),
+    _geometryCacheCellSize(0),
+    _geometryCacheSizeMultirate(0),
+    _geometryCacheSizeHalo(0),
+    _cacheGeometry(false),
+    _cacheGeometryMultirate(false),
+    _cacheGeometryHalo(false) {
     GenericComponent::setName("integratordomain");
     _labelName = pylith::topology::Mesh::getCellsLabelName();
+
+    _keyRHSResidual = _IntegratorDomain::createKey(NULL, 0, RESIDUAL_RHS);
+    _keyLHSResidual = _IntegratorDomain::createKey(NULL, 0, RESIDUAL_LHS);
+    _keyLHSJacobian = _IntegratorDomain::createKey(NULL, 0, JACOBIAN_LHS);
+    _keyLHSJacobianLumped = _IntegratorDomain::createKey(NULL, 0, JACOBIAN_LHS_LUMPED_INV);
 } // constructor
 
 
@@ -95,6 +142,12 @@ pylith::feassemble::IntegratorDomain::deallocate(void) {
     delete _materialMesh;_materialMesh = NULL;
     delete _updateState;_updateState = NULL;
 
+    PetscErrorCode err = ISDestroy(&_cellsIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_cellsSlowIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_cellsFastIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_cellsHaloBoundaryIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_cellsHaloInteriorIS);PYLITH_CHECK_ERROR(err);
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -168,6 +221,271 @@ pylith::feassemble::IntegratorDomain::setKernelsDerivedField(const std::vector<P
 } // setKernelsDerivedField
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set memory budget for caching cell geometry.
+void
+pylith::feassemble::IntegratorDomain::setGeometryCacheBudget(const size_t value) {
+    PYLITH_JOURNAL_DEBUG("setGeometryCacheBudget(value="<<value<<")");
+
+    _geometryCacheBudget = value;
+} // setGeometryCacheBudget
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get memory reserved for cached cell geometry.
+size_t
+pylith::feassemble::IntegratorDomain::getGeometryCacheSize(void) const {
+    return _geometryCacheSize;
+} // getGeometryCacheSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Mark points in closure of cells that need a time step smaller than the slow time step.
+PylithReal
+pylith::feassemble::IntegratorDomain::markMultirateFastPoints(pylith::int_array* fastPoints,
+                                                              const PylithReal dt,
+                                                              const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("markMultirateFastPoints(fastPoints="<<fastPoints<<", dt="<<dt<<", solution="<<solution.getLabel()<<")");
+
+    assert(fastPoints);
+    assert(_auxiliaryField);
+    assert(_cellsIS);
+
+    PylithReal dtStableMin = pylith::PYLITH_MAXSCALAR;
+    const char* subfieldNames[3] = { "density", "shear_modulus", "bulk_modulus" };
+    PylithInt subfieldIndices[3];
+    for (size_t i = 0; i < 3; ++i) {
+        if (!_auxiliaryField->hasSubfield(subfieldNames[i])) {
+            PYLITH_JOURNAL_DEBUG("Auxiliary field does not contain '"<<subfieldNames[i]<<"'; cells do not limit time step.");
+            PYLITH_METHOD_RETURN(dtStableMin);
+        } // if
+        subfieldIndices[i] = _auxiliaryField->subfieldInfo(subfieldNames[i]).index;
+    } // for
+
+    PetscErrorCode err;
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmSoln, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(fastPoints->size() == size_t(pEnd - pStart));
+    PylithInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmSoln, &spaceDim);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmAux = _auxiliaryField->dmMesh();assert(dmAux);
+    PetscSection auxSection = _auxiliaryField->localSection();assert(auxSection);
+    DMEnclosureType auxEnclosure;
+    err = DMGetEnclosureRelation(dmAux, dmSoln, &auxEnclosure);PYLITH_CHECK_ERROR(err);
+    const PetscScalar* auxArray = NULL;
+    err = VecGetArrayRead(_auxiliaryField->localVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+
+    pylith::topology::CoordsVisitor coordsVisitor(dmSoln);
+
+    PylithInt numCells = 0;
+    PylithInt numFastCells = 0;
+    const PetscInt* cells = NULL;
+    err = ISGetLocalSize(_cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(_cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+    for (PylithInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cells[iCell];
+
+        // Use minimum distance between vertices as the size of the cell.
+        PetscScalar* coordsCell = NULL;
+        PetscInt coordsSize = 0;
+        coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+        const PetscInt numVertices = coordsSize / spaceDim;
+        PylithReal minDistSquared = pylith::PYLITH_MAXSCALAR;
+        for (PetscInt iVertex = 0; iVertex < numVertices; ++iVertex) {
+            for (PetscInt jVertex = iVertex+1; jVertex < numVertices; ++jVertex) {
+                PylithReal distSquared = 0.0;
+                for (PylithInt iDim = 0; iDim < spaceDim; ++iDim) {
+                    const PylithReal delta = coordsCell[jVertex*spaceDim+iDim] - coordsCell[iVertex*spaceDim+iDim];
+                    distSquared += delta * delta;
+                } // for
+                minDistSquared = std::min(minDistSquared, distSquared);
+            } // for
+        } // for
+        coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+
+        // Average elastic properties over points with values in closure of cell, so any basis order works.
+        PylithReal values[3] = { 0.0, 0.0, 0.0 };
+        PylithInt numValues[3] = { 0, 0, 0 };
+        PetscInt auxCell = -1;
+        err = DMGetEnclosurePoint(dmAux, dmSoln, auxEnclosure, cell, &auxCell);PYLITH_CHECK_ERROR(err);
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmAux, auxCell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            const PetscInt point = closure[2*iPoint];
+            for (size_t i = 0; i < 3; ++i) {
+                PetscInt dof = 0, off = 0;
+                err = PetscSectionGetFieldDof(auxSection, point, subfieldIndices[i], &dof);PYLITH_CHECK_ERROR(err);
+                if (dof > 0) {
+                    err = PetscSectionGetFieldOffset(auxSection, point, subfieldIndices[i], &off);PYLITH_CHECK_ERROR(err);
+                    values[i] += PetscRealPart(auxArray[off]);
+                    ++numValues[i];
+                } // if
+            } // for
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmAux, auxCell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        if (!numValues[0] || !numValues[1] || !numValues[2]) { continue; }
+
+        const PylithReal density = values[0] / numValues[0];
+        const PylithReal shearModulus = values[1] / numValues[1];
+        const PylithReal bulkModulus = values[2] / numValues[2];
+        const PylithReal vp = sqrt((bulkModulus + 4.0/3.0*shearModulus) / density);
+        const PylithReal dtStable = sqrt(minDistSquared) / vp;
+        dtStableMin = std::min(dtStableMin, dtStable);
+
+        if (dtStable < dt) {
+            ++numFastCells;
+            err = DMPlexGetTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+                (*fastPoints)[closure[2*iPoint]-pStart] = 1;
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+    err = ISRestoreIndices(_cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(_auxiliaryField->localVector(), &auxArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_JOURNAL_DEBUG(numFastCells<<" of "<<numCells<<" cells need time step smaller than "<<dt
+                                     <<" (minimum stable time step "<<dtStableMin<<").");
+
+    PYLITH_METHOD_RETURN(dtStableMin);
+} // markMultirateFastPoints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set cells used in RHS residual evaluations for each multirate bin.
+void
+pylith::feassemble::IntegratorDomain::setMultirateFastPoints(const pylith::int_array& fastPoints,
+                                                             const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setMultirateFastPoints(fastPoints="<<&fastPoints<<", solution="<<solution.getLabel()<<")");
+
+    assert(_cellsIS);
+
+    PetscErrorCode err;
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmSoln, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(fastPoints.size() == size_t(pEnd - pStart));
+
+    PylithInt numCells = 0;
+    const PetscInt* cells = NULL;
+    err = ISGetLocalSize(_cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(_cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> cellsSlow;
+    std::vector<PetscInt> cellsFast;
+    for (PylithInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cells[iCell];
+        bool hasSlowPoint = false;
+        bool hasFastPoint = false;
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            if (fastPoints[closure[2*iPoint]-pStart]) {
+                hasFastPoint = true;
+            } else {
+                hasSlowPoint = true;
+            } // if/else
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+        if (hasSlowPoint) { cellsSlow.push_back(cell); }
+        if (hasFastPoint) { cellsFast.push_back(cell); }
+    } // for
+    err = ISRestoreIndices(_cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+
+    err = ISDestroy(&_cellsSlowIS);PYLITH_CHECK_ERROR(err);
+    err = ISCreateGeneral(PETSC_COMM_SELF, cellsSlow.size(), cellsSlow.size() ? &cellsSlow[0] : NULL, PETSC_COPY_VALUES,
+                          &_cellsSlowIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_cellsFastIS);PYLITH_CHECK_ERROR(err);
+    err = ISCreateGeneral(PETSC_COMM_SELF, cellsFast.size(), cellsFast.size() ? &cellsFast[0] : NULL, PETSC_COPY_VALUES,
+                          &_cellsFastIS);PYLITH_CHECK_ERROR(err);
+
+    // Cached geometry is attached to each set of cells, so the bins are charged against the budget separately.
+    _geometryCacheSize -= _geometryCacheSizeMultirate;
+    _cacheGeometryMultirate = _reserveGeometryCache(cellsSlow.size() + cellsFast.size(), &_geometryCacheSizeMultirate);
+
+    PYLITH_JOURNAL_DEBUG("Multirate bins contain "<<cellsSlow.size()<<" slow and "<<cellsFast.size()<<" fast cells of "
+                                                  <<numCells<<" cells.");
+
+    PYLITH_METHOD_END;
+} // setMultirateFastPoints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Split cells into those with and without points shared with other processes.
+void
+pylith::feassemble::IntegratorDomain::setHaloSharedPoints(const pylith::int_array& sharedPoints,
+                                                          const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setHaloSharedPoints(sharedPoints="<<&sharedPoints<<", solution="<<solution.getLabel()<<")");
+
+    assert(_cellsIS);
+
+    PetscErrorCode err;
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmSoln, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(sharedPoints.size() == size_t(pEnd - pStart));
+
+    PylithInt numCells = 0;
+    const PetscInt* cells = NULL;
+    err = ISGetLocalSize(_cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(_cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> cellsBoundary;
+    std::vector<PetscInt> cellsInterior;
+    for (PylithInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cells[iCell];
+        bool hasSharedPoint = false;
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            if (sharedPoints[closure[2*iPoint]-pStart]) {
+                hasSharedPoint = true;
+                break;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+        if (hasSharedPoint) {
+            cellsBoundary.push_back(cell);
+        } else {
+            cellsInterior.push_back(cell);
+        } // if/else
+    } // for
+    err = ISRestoreIndices(_cellsIS, &cells);PYLITH_CHECK_ERROR(err);
+
+    err = ISDestroy(&_cellsHaloBoundaryIS);PYLITH_CHECK_ERROR(err);
+    err = ISCreateGeneral(PETSC_COMM_SELF, cellsBoundary.size(), cellsBoundary.size() ? &cellsBoundary[0] : NULL,
+                          PETSC_COPY_VALUES, &_cellsHaloBoundaryIS);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&_cellsHaloInteriorIS);PYLITH_CHECK_ERROR(err);
+    err = ISCreateGeneral(PETSC_COMM_SELF, cellsInterior.size(), cellsInterior.size() ? &cellsInterior[0] : NULL,
+                          PETSC_COPY_VALUES, &_cellsHaloInteriorIS);PYLITH_CHECK_ERROR(err);
+
+    // Cached geometry is attached to each set of cells, so the halo split is charged against the budget separately.
+    _geometryCacheSize -= _geometryCacheSizeHalo;
+    _cacheGeometryHalo = _reserveGeometryCache(cellsBoundary.size() + cellsInterior.size(), &_geometryCacheSizeHalo);
+
+    PYLITH_JOURNAL_DEBUG("Halo split contains "<<cellsBoundary.size()<<" cells with shared points and "
+                                               <<cellsInterior.size()<<" interior cells.");
+
+    PYLITH_METHOD_END;
+} // setHaloSharedPoints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether integrator has a separate set of cells without points shared with other processes.
+bool
+pylith::feassemble::IntegratorDomain::hasHaloInteriorCells(void) const {
+    return NULL != _cellsHaloInteriorIS;
+} // hasHaloInteriorCells
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Initialize integration domain, auxiliary field, and derived field. Update observers.
 void
@@ -188,6 +506,9 @@ pylith::feassemble::IntegratorDomain::initialize(const pylith::topology::Field&
         _updateState->initialize(*_auxiliaryField);
     } // if
 
+    _setWeakFormKernels(solution);
+    _setupGeometryCache(solution);
+
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
         PYLITH_JOURNAL_DEBUG("Viewing auxiliary field.");
@@ -211,11 +532,13 @@ pylith::feassemble::IntegratorDomain::computeRHSResidual(pylith::topology::Field
 
     if (0 == _kernelsRHSResidual.size()) { PYLITH_METHOD_END;}
 
+    _eventBegin(EVENT_COMPUTE_RHS_RESIDUAL);
     _setKernelConstants(solution, dt);
 
-    pylith::topology::Field solutionDot(solution.mesh()); // No dependence on time derivative of solution in RHS.
-    solutionDot.setLabel("solution_dot");
-    _computeResidual(residual, _kernelsRHSResidual, t, dt, solution, solutionDot);
+    // No dependence on time derivative of solution in RHS.
+    const pylith::topology::Field& solutionDot = _getSolutionDotEmpty(solution);
+    _computeResidual(residual, _keyRHSResidual, t, dt, solution, solutionDot);
+    _eventEnd(EVENT_COMPUTE_RHS_RESIDUAL);
 
     PYLITH_METHOD_END;
 } // computeRHSResidual
@@ -234,8 +557,10 @@ pylith::feassemble::IntegratorDomain::computeLHSResidual(pylith::topology::Field
 
     if (0 == _kernelsLHSResidual.size()) { PYLITH_METHOD_END;}
 
+    _eventBegin(EVENT_COMPUTE_LHS_RESIDUAL);
     _setKernelConstants(solution, dt);
-    _computeResidual(residual, _kernelsLHSResidual, t, dt, solution, solutionDot);
+    _computeResidual(residual, _keyLHSResidual, t, dt, solution, solutionDot);
+    _eventEnd(EVENT_COMPUTE_LHS_RESIDUAL);
 
     PYLITH_METHOD_END;
 } // computeLHSResidual
@@ -257,13 +582,55 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobian(PetscMat jacobianMat,
     _needNewLHSJacobian = false;
     if (0 == _kernelsLHSJacobian.size()) { PYLITH_METHOD_END;}
 
+    _eventBegin(EVENT_COMPUTE_LHS_JACOBIAN);
     _setKernelConstants(solution, dt);
-    _computeJacobian(jacobianMat, precondMat, _kernelsLHSJacobian, t, dt, s_tshift, solution, solutionDot);
+    _computeJacobian(jacobianMat, precondMat, _keyLHSJacobian, t, dt, s_tshift, solution, solutionDot);
+    _eventEnd(EVENT_COMPUTE_LHS_JACOBIAN);
 
     PYLITH_METHOD_END;
 } // computeLHSJacobian
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector.
+void
+pylith::feassemble::IntegratorDomain::computeLHSJacobianAction(pylith::topology::Field* action,
+                                                               const PylithReal t,
+                                                               const PylithReal dt,
+                                                               const PylithReal s_tshift,
+                                                               const pylith::topology::Field& solution,
+                                                               const pylith::topology::Field& solutionDot,
+                                                               PetscVec inputVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("computeLHSJacobianAction(action="<<action<<", t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solution="<<solution.getLabel()<<", solutionDot="<<solutionDot.getLabel()<<", inputVec="<<inputVec<<")");
+
+    if (0 == _kernelsLHSJacobian.size()) { PYLITH_METHOD_END;}
+
+    assert(action);
+    assert(inputVec);
+    assert(_cellsIS);
+    PetscErrorCode err;
+
+    _setKernelConstants(solution, dt);
+
+    // Compute action over the cells of this integrator and then add it to the action for all integrators.
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscVec actionVec = NULL;
+    err = DMGetLocalVector(dmSoln, &actionVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(actionVec, 0.0);PYLITH_CHECK_ERROR(err);
+
+    assert(action->localVector());
+    PetscIS cellsIS = _getCellsIS();
+    err = DMPlexComputeJacobian_Action_Internal(dmSoln, _keyLHSJacobian, cellsIS, t, s_tshift, solution.localVector(),
+                                                solutionDot.localVector(), inputVec, actionVec, NULL);PYLITH_CHECK_ERROR(err);
+    _restoreCellsIS(&cellsIS);
+    err = VecAXPY(action->localVector(), 1.0, actionVec);PYLITH_CHECK_ERROR(err);
+    err = DMRestoreLocalVector(dmSoln, &actionVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Compute LHS Jacobian for F(t,s,\dot{s}).
 void
@@ -276,57 +643,23 @@ pylith::feassemble::IntegratorDomain::computeLHSJacobianLumpedInv(pylith::topolo
     PYLITH_JOURNAL_DEBUG("computeLHSJacobianLumpedInv(jacobianInv="<<jacobianInv<<", t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<")");
 
     assert(jacobianInv);
+    assert(_cellsIS);
     PetscErrorCode err;
 
     _setKernelConstants(solution, dt);
 
-    // :KLUDGE: Potentially we may have multiple PetscDS objects. This assumes that the first one (with a NULL label) is
-    // the correct one.
     PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
-    PetscDS dsSoln = NULL;
-    err = DMGetDS(dmSoln, &dsSoln);PYLITH_CHECK_ERROR(err);assert(dsSoln);
-    PetscWeakForm weakForm = NULL;
-    err = PetscDSGetWeakForm(dsSoln, &weakForm);PYLITH_CHECK_ERROR(err);
-
-    PetscDMLabel dmLabel = NULL;
-    err = DMGetLabel(dmSoln, _labelName.c_str(), &dmLabel);PYLITH_CHECK_ERROR(err);
-    const PetscInt labelValue = _labelValue;
-
-    { // Move to initialization phase.
-      // Must use PetscWeakFormAddJacobian() when moved to initialization.
-        const std::vector<JacobianKernels>& kernels = _kernelsLHSJacobian;
-        for (size_t i = 0; i < kernels.size(); ++i) {
-            const PetscInt i_fieldTrial = solution.subfieldInfo(kernels[i].subfieldTrial.c_str()).index;
-            const PetscInt i_fieldBasis = solution.subfieldInfo(kernels[i].subfieldBasis.c_str()).index;
-            const PetscInt i_part = pylith::feassemble::Integrator::JACOBIAN_LHS_LUMPED_INV;
-            const PetscInt index = 0;
-            err = PetscWeakFormSetIndexJacobian(weakForm, dmLabel, labelValue, i_fieldTrial, i_fieldBasis, i_part,
-                                                index, kernels[i].j0, index, kernels[i].j1, index, kernels[i].j2, index, kernels[i].j3);
-            PYLITH_CHECK_ERROR(err);
-        } // for
-        pythia::journal::debug_t debug(GenericComponent::getName());
-        if (debug.state()) {
-            err = PetscDSView(dsSoln, PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
-        } // if
-
-        err = DMSetAuxiliaryVec(dmSoln, dmLabel, labelValue, _auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
-    } // Move to initialization phase
-
     PetscVec vecRowSum = NULL;
     err = DMGetLocalVector(dmSoln, &vecRowSum);PYLITH_CHECK_ERROR(err);
     err = VecSet(vecRowSum, 1.0);PYLITH_CHECK_ERROR(err);
 
     // Compute the local Jacobian action
-    PetscFormKey key;
-    key.label = dmLabel;
-    key.value = _labelValue;
-    key.part = pylith::feassemble::Integrator::JACOBIAN_LHS_LUMPED_INV;
-
-    PetscIS cellsIS = NULL;
     assert(jacobianInv->localVector());
-    err = DMGetStratumIS(dmSoln, _labelName.c_str(), _labelValue, &cellsIS);PYLITH_CHECK_ERROR(err);
-    err = DMPlexComputeJacobian_Action_Internal(dmSoln, key, cellsIS, t, s_tshift, vecRowSum, NULL, vecRowSum, jacobianInv->localVector(), NULL);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&cellsIS);PYLITH_CHECK_ERROR(err);
+    PetscIS cellsIS = _getCellsIS();
+    err = DMPlexComputeJacobian_Action_Internal(dmSoln, _keyLHSJacobianLumped, cellsIS, t, s_tshift, vecRowSum, NULL,
+                                                vecRowSum, jacobianInv->localVector(), NULL);PYLITH_CHECK_ERROR(err);
+    _restoreCellsIS(&cellsIS);
+    err = DMRestoreLocalVector(dmSoln, &vecRowSum);PYLITH_CHECK_ERROR(err);
 
     // Compute the Jacobian inverse.
     err = VecReciprocal(jacobianInv->localVector());PYLITH_CHECK_ERROR(err);
@@ -350,6 +683,7 @@ pylith::feassemble::IntegratorDomain::_updateStateVars(const PylithReal t,
         PYLITH_METHOD_END;
     } // if
 
+    _eventBegin(EVENT_UPDATE_STATE_VARS);
     assert(_updateState);
     assert(_auxiliaryField);
     _updateState->prepare(_auxiliaryField);
@@ -375,6 +709,7 @@ pylith::feassemble::IntegratorDomain::_updateStateVars(const PylithReal t,
     _updateState->restore(_auxiliaryField);
 
     delete[] kernelsStateVars;kernelsStateVars = NULL;
+    _eventEnd(EVENT_UPDATE_STATE_VARS);
 
     PYLITH_METHOD_END;
 } // _updateStateVars
@@ -393,6 +728,7 @@ pylith::feassemble::IntegratorDomain::_computeDerivedField(const PylithReal t,
         PYLITH_METHOD_END;
     } // if
 
+    _eventBegin(EVENT_COMPUTE_DERIVED_FIELD);
     assert(_derivedField);
     _setKernelConstants(solution, dt);
 
@@ -412,6 +748,7 @@ pylith::feassemble::IntegratorDomain::_computeDerivedField(const PylithReal t,
     err = DMSetAuxiliaryVec(derivedDM, dmLabel, labelValue, _auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
     err = DMProjectFieldLocal(derivedDM, t, solution.localVector(), kernelsArray, INSERT_VALUES, _derivedField->localVector());PYLITH_CHECK_ERROR(err);
     delete[] kernelsArray;kernelsArray = NULL;
+    _eventEnd(EVENT_COMPUTE_DERIVED_FIELD);
 
     pythia::journal::debug_t debug(GenericComponent::getName());
     if (debug.state()) {
@@ -424,18 +761,12 @@ pylith::feassemble::IntegratorDomain::_computeDerivedField(const PylithReal t,
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Compute residual using current kernels.
+// Register kernels with the PETSc weak form and cache label, keys, and cells for integration domain.
 void
-pylith::feassemble::IntegratorDomain::_computeResidual(pylith::topology::Field* residual,
-                                                       const std::vector<ResidualKernels>& kernels,
-                                                       const PylithReal t,
-                                                       const PylithReal dt,
-                                                       const pylith::topology::Field& solution,
-                                                       const pylith::topology::Field& solutionDot) {
+pylith::feassemble::IntegratorDomain::_setWeakFormKernels(const pylith::topology::Field& solution) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("_computeResidual(residual="<<residual<<", # kernels="<<kernels.size()<<", t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<", solutionDot="<<solutionDot.getLabel()<<")");
+    PYLITH_JOURNAL_DEBUG("_setWeakFormKernels(solution="<<solution.getLabel()<<")");
 
-    assert(residual);
     assert(_auxiliaryField);
     PetscErrorCode err;
 
@@ -449,109 +780,261 @@ pylith::feassemble::IntegratorDomain::_computeResidual(pylith::topology::Field*
 
     PetscDMLabel dmLabel = NULL;
     err = DMGetLabel(dmSoln, _labelName.c_str(), &dmLabel);PYLITH_CHECK_ERROR(err);
+    _keyRHSResidual = _IntegratorDomain::createKey(dmLabel, _labelValue, RESIDUAL_RHS);
+    _keyLHSResidual = _IntegratorDomain::createKey(dmLabel, _labelValue, RESIDUAL_LHS);
+    _keyLHSJacobian = _IntegratorDomain::createKey(dmLabel, _labelValue, JACOBIAN_LHS);
+    _keyLHSJacobianLumped = _IntegratorDomain::createKey(dmLabel, _labelValue, JACOBIAN_LHS_LUMPED_INV);
+
+    // Residual kernels for RHS and LHS are registered as separate parts, so they do not overwrite each other.
+    const PetscInt index = 0;
+    for (size_t i = 0; i < _kernelsRHSResidual.size(); ++i) {
+        const PetscInt i_field = solution.subfieldInfo(_kernelsRHSResidual[i].subfield.c_str()).index;
+        err = PetscWeakFormSetIndexResidual(weakForm, dmLabel, _labelValue, i_field, _keyRHSResidual.part,
+                                            index, _kernelsRHSResidual[i].r0, index, _kernelsRHSResidual[i].r1);
+        PYLITH_CHECK_ERROR(err);
+    } // for
+    for (size_t i = 0; i < _kernelsLHSResidual.size(); ++i) {
+        const PetscInt i_field = solution.subfieldInfo(_kernelsLHSResidual[i].subfield.c_str()).index;
+        err = PetscWeakFormSetIndexResidual(weakForm, dmLabel, _labelValue, i_field, _keyLHSResidual.part,
+                                            index, _kernelsLHSResidual[i].r0, index, _kernelsLHSResidual[i].r1);
+        PYLITH_CHECK_ERROR(err);
+    } // for
 
-    { // Move to initialization phase.
-        // Must use PetscWeakFormAddBdResidual() when moved to initialization.
-        for (size_t i = 0; i < kernels.size(); ++i) {
-            const PetscInt i_field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
-            const PetscInt i_part = pylith::feassemble::Integrator::RESIDUAL_LHS; // :TODO: Update when moved to
-                                                                                  // initialization.
-            const PetscInt index = 0;
-            err = PetscWeakFormSetIndexResidual(weakForm, dmLabel, _labelValue, i_field, i_part,
-                                                index, kernels[i].r0, index, kernels[i].r1);PYLITH_CHECK_ERROR(err);
+    // The LHS Jacobian kernels are used for both the LHS Jacobian and the lumped LHS Jacobian.
+    const PetscInt jacobianParts[2] = { _keyLHSJacobian.part, _keyLHSJacobianLumped.part };
+    for (size_t i = 0; i < _kernelsLHSJacobian.size(); ++i) {
+        const PetscInt i_fieldTrial = solution.subfieldInfo(_kernelsLHSJacobian[i].subfieldTrial.c_str()).index;
+        const PetscInt i_fieldBasis = solution.subfieldInfo(_kernelsLHSJacobian[i].subfieldBasis.c_str()).index;
+        for (size_t iPart = 0; iPart < 2; ++iPart) {
+            err = PetscWeakFormSetIndexJacobian(weakForm, dmLabel, _labelValue, i_fieldTrial, i_fieldBasis, jacobianParts[iPart],
+                                                index, _kernelsLHSJacobian[i].j0, index, _kernelsLHSJacobian[i].j1,
+                                                index, _kernelsLHSJacobian[i].j2, index, _kernelsLHSJacobian[i].j3);
+            PYLITH_CHECK_ERROR(err);
         } // for
-        pythia::journal::debug_t debug(GenericComponent::getName());
-        if (debug.state()) {
-            err = PetscDSView(dsSoln, PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
+    } // for
+    pythia::journal::debug_t debug(GenericComponent::getName());
+    if (debug.state()) {
+        err = PetscDSView(dsSoln, PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Auxiliary field is keyed by the label and value of the integration domain, so it is unique to this integrator.
+    err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, _auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
+
+    // Mesh does not change, so the cells in the integration domain can be reused for every residual and Jacobian.
+    err = ISDestroy(&_cellsIS);PYLITH_CHECK_ERROR(err);
+    err = DMGetStratumIS(dmSoln, _labelName.c_str(), _labelValue, &_cellsIS);PYLITH_CHECK_ERROR(err);
+    if (!_cellsIS) { // No cells in integration domain on this process.
+        err = ISCreateStride(PETSC_COMM_SELF, 0, 0, 1, &_cellsIS);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _setWeakFormKernels
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Decide whether cell geometry is cached across evaluations based on the memory budget.
+void
+pylith::feassemble::IntegratorDomain::_setupGeometryCache(const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("_setupGeometryCache(solution="<<solution.getLabel()<<")");
+
+    assert(_cellsIS);
+    PetscErrorCode err;
+
+    // Geometry is evaluated at the quadrature points, so use the largest quadrature over the solution subfields.
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    PetscDS dsSoln = NULL;
+    err = DMGetDS(dmSoln, &dsSoln);PYLITH_CHECK_ERROR(err);assert(dsSoln);
+    PylithInt numFields = 0;
+    err = PetscDSGetNumFields(dsSoln, &numFields);PYLITH_CHECK_ERROR(err);
+    PylithInt numQuadPts = 0;
+    for (PylithInt iField = 0; iField < numFields; ++iField) {
+        PetscObject discretization = NULL;
+        err = PetscDSGetDiscretization(dsSoln, iField, &discretization);PYLITH_CHECK_ERROR(err);
+        PetscQuadrature quadrature = NULL;
+        err = PetscFEGetQuadrature((PetscFE)discretization, &quadrature);PYLITH_CHECK_ERROR(err);
+        PylithInt numPoints = 0;
+        err = PetscQuadratureGetData(quadrature, NULL, NULL, &numPoints, NULL, NULL);PYLITH_CHECK_ERROR(err);
+        numQuadPts = std::max(numQuadPts, numPoints);
+    } // for
+
+    PylithInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmSoln, &spaceDim);PYLITH_CHECK_ERROR(err);
+    PylithInt numCells = 0;
+    err = ISGetLocalSize(_cellsIS, &numCells);PYLITH_CHECK_ERROR(err);
+
+    // PetscFEGeom holds coordinates, Jacobian, inverse Jacobian, and determinant of Jacobian at each point.
+    const size_t pointSize = size_t(spaceDim + 2*spaceDim*spaceDim + 1) * sizeof(PylithReal);
+    const size_t cacheSize = size_t(numCells) * size_t(numQuadPts) * pointSize;
+
+    _cacheGeometry = cacheSize <= _geometryCacheBudget;
+    _geometryCacheSize = _cacheGeometry ? cacheSize : 0;
+    _geometryCacheCellSize = size_t(numQuadPts) * pointSize;
+    _geometryCacheSizeMultirate = 0;
+    _geometryCacheSizeHalo = 0;
+    _cacheGeometryMultirate = false;
+    _cacheGeometryHalo = false;
+    PYLITH_JOURNAL_DEBUG("Cell geometry for "<<numCells<<" cells requires "<<cacheSize<<" bytes; "
+                         <<(_cacheGeometry ? "caching" : "recomputing")<<" geometry (budget="<<_geometryCacheBudget<<" bytes).");
+
+    PYLITH_METHOD_END;
+} // _setupGeometryCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Reserve memory within the budget for caching geometry of an additional set of cells.
+bool
+pylith::feassemble::IntegratorDomain::_reserveGeometryCache(const size_t numCells,
+                                                            size_t* reserved) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("_reserveGeometryCache(numCells="<<numCells<<", reserved="<<reserved<<")");
+
+    assert(reserved);
+    const size_t cacheSize = numCells * _geometryCacheCellSize;
+    const bool isCached = _cacheGeometry && (_geometryCacheSize + cacheSize <= _geometryCacheBudget);
+    *reserved = isCached ? cacheSize : 0;
+    _geometryCacheSize += *reserved;
+    PYLITH_JOURNAL_DEBUG("Cell geometry for "<<numCells<<" additional cells requires "<<cacheSize<<" bytes; "
+                         <<(isCached ? "caching" : "recomputing")<<" geometry (used "<<_geometryCacheSize
+                         <<" of budget="<<_geometryCacheBudget<<" bytes).");
+
+    PYLITH_METHOD_RETURN(isCached);
+} // _reserveGeometryCache
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get cells to pass to DMPlex integration routines.
+PetscIS
+pylith::feassemble::IntegratorDomain::_getCellsIS(void) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_cellsIS);
+    PetscIS binIS = _cellsIS;
+    bool cacheGeometry = _cacheGeometry;
+    switch (_multirateBin) {
+    case MULTIRATE_SLOW:
+        if (_cellsSlowIS) {
+            binIS = _cellsSlowIS;
+            cacheGeometry = _cacheGeometryMultirate;
         } // if
+        break;
+    case MULTIRATE_FAST:
+        if (_cellsFastIS) {
+            binIS = _cellsFastIS;
+            cacheGeometry = _cacheGeometryMultirate;
+        } // if
+        break;
+    default:
+        if ((HALO_BOUNDARY == _haloPart) && _cellsHaloBoundaryIS) {
+            binIS = _cellsHaloBoundaryIS;
+            cacheGeometry = _cacheGeometryHalo;
+        } else if ((HALO_INTERIOR == _haloPart) && _cellsHaloInteriorIS) {
+            binIS = _cellsHaloInteriorIS;
+            cacheGeometry = _cacheGeometryHalo;
+        } // if/else
+        break;
+    } // switch
+
+    PetscIS cellsIS = binIS;
+    if (!cacheGeometry) {
+        // Geometry attached to the copy is discarded when the copy is destroyed.
+        PetscErrorCode err = ISDuplicate(binIS, &cellsIS);PYLITH_CHECK_ERROR(err);
+    } // if
 
-        err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, _auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
-    } // Move to initialization phase
+    PYLITH_METHOD_RETURN(cellsIS);
+} // _getCellsIS
 
-    // Compute the local residual
-    PetscFormKey key;
-    key.label = dmLabel;
-    key.value = _labelValue;
-    key.part = pylith::feassemble::Integrator::RESIDUAL_LHS; // Update when initialization moves.
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Restore cells obtained from _getCellsIS().
+void
+pylith::feassemble::IntegratorDomain::_restoreCellsIS(PetscIS* cellsIS) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(cellsIS);
+    if ((*cellsIS != _cellsIS) && (*cellsIS != _cellsSlowIS) && (*cellsIS != _cellsFastIS) &&
+        (*cellsIS != _cellsHaloBoundaryIS) && (*cellsIS != _cellsHaloInteriorIS)) {
+        PetscErrorCode err = ISDestroy(cellsIS);PYLITH_CHECK_ERROR(err);
+    } // if
+    *cellsIS = NULL;
+
+    PYLITH_METHOD_END;
+} // _restoreCellsIS
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute residual using kernels registered in weak form.
+void
+pylith::feassemble::IntegratorDomain::_computeResidual(pylith::topology::Field* residual,
+                                                       const PetscFormKey& key,
+                                                       const PylithReal t,
+                                                       const PylithReal dt,
+                                                       const pylith::topology::Field& solution,
+                                                       const pylith::topology::Field& solutionDot) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("_computeResidual(residual="<<residual<<", part="<<key.part<<", t="<<t<<", dt="<<dt<<", solution="<<solution.getLabel()<<", solutionDot="<<solutionDot.getLabel()<<")");
+
+    assert(residual);
+    assert(_auxiliaryField);
+    assert(_cellsIS);
 
     PYLITH_JOURNAL_DEBUG("DMPlexComputeResidual_Internal() with label name '"<<_labelName<<"' and value '"<<_labelValue<<").");
     assert(solution.localVector());
     assert(residual->localVector());
-    PetscIS cellsIS = NULL;
-    PetscInt numCells = 0;
-    err = DMGetStratumIS(dmSoln, _labelName.c_str(), _labelValue, &cellsIS);PYLITH_CHECK_ERROR(err);
-    err = ISGetSize(cellsIS, &numCells);PYLITH_CHECK_ERROR(err);assert(numCells > 0);
-    err = DMPlexComputeResidual_Internal(dmSoln, key, cellsIS, PETSC_MIN_REAL, solution.localVector(), solutionDot.localVector(), t, residual->localVector(), NULL);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&cellsIS);PYLITH_CHECK_ERROR(err);
+    PetscIS cellsIS = _getCellsIS();
+    PetscErrorCode err = DMPlexComputeResidual_Internal(solution.dmMesh(), key, cellsIS, PETSC_MIN_REAL, solution.localVector(),
+                                                       solutionDot.localVector(), t, residual->localVector(), NULL);
+    PYLITH_CHECK_ERROR(err);
+    _restoreCellsIS(&cellsIS);
 
     PYLITH_METHOD_END;
 } // _computeResidual
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Compute Jacobian using current kernels.
+// Compute Jacobian using kernels registered in weak form.
 void
 pylith::feassemble::IntegratorDomain::_computeJacobian(PetscMat jacobianMat,
                                                        PetscMat precondMat,
-                                                       const std::vector<JacobianKernels>& kernels,
+                                                       const PetscFormKey& key,
                                                        const PylithReal t,
                                                        const PylithReal dt,
                                                        const PylithReal s_tshift,
                                                        const pylith::topology::Field& solution,
                                                        const pylith::topology::Field& solutionDot) {
     PYLITH_METHOD_BEGIN;
-    PYLITH_JOURNAL_DEBUG("_computeJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", # kernels="<<kernels.size()<<", t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solution="<<solution.getLabel()<<", solutionDot="<<solutionDot.getLabel()<<")");
+    PYLITH_JOURNAL_DEBUG("_computeJacobian(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", part="<<key.part<<", t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solution="<<solution.getLabel()<<", solutionDot="<<solutionDot.getLabel()<<")");
 
     assert(jacobianMat);
     assert(precondMat);
     assert(_auxiliaryField);
-    PetscErrorCode err;
-
-    // :KLUDGE: Potentially we may have multiple PetscDS objects. This assumes that the first one (with a NULL label) is
-    // the correct one.
-    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
-    PetscDS dsSoln = NULL;
-    err = DMGetDS(dmSoln, &dsSoln);PYLITH_CHECK_ERROR(err);assert(dsSoln);
-    PetscWeakForm weakForm = NULL;
-    err = PetscDSGetWeakForm(dsSoln, &weakForm);PYLITH_CHECK_ERROR(err);
-
-    PetscDMLabel dmLabel = NULL;
-    err = DMGetLabel(dmSoln, _labelName.c_str(), &dmLabel);PYLITH_CHECK_ERROR(err);
-
-    { // Move to initialization phase.
-        // Must use PetscWeakFormAddJacobian() when moved to initialization.
-        for (size_t i = 0; i < kernels.size(); ++i) {
-            const PetscInt i_fieldTrial = solution.subfieldInfo(kernels[i].subfieldTrial.c_str()).index;
-            const PetscInt i_fieldBasis = solution.subfieldInfo(kernels[i].subfieldBasis.c_str()).index;
-            const PetscInt i_part = pylith::feassemble::Integrator::JACOBIAN_LHS;
-            const PetscInt index = 0;
-            err = PetscWeakFormSetIndexJacobian(weakForm, dmLabel, _labelValue, i_fieldTrial, i_fieldBasis, i_part,
-                                                index, kernels[i].j0, index, kernels[i].j1, index, kernels[i].j2, index, kernels[i].j3);
-            PYLITH_CHECK_ERROR(err);
-        } // for
-        pythia::journal::debug_t debug(GenericComponent::getName());
-        if (debug.state()) {
-            err = PetscDSView(dsSoln, PETSC_VIEWER_STDOUT_WORLD);PYLITH_CHECK_ERROR(err);
-        } // if
-
-        err = DMSetAuxiliaryVec(dmSoln, dmLabel, _labelValue, _auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
-    } // Move to initialization phase
-
-    // Compute the local Jacobian
-    PetscFormKey key;
-    key.label = dmLabel;
-    key.value = _labelValue;
-    key.part = pylith::feassemble::Integrator::JACOBIAN_LHS;
+    assert(_cellsIS);
 
     PYLITH_JOURNAL_DEBUG("DMPlexComputeJacobian_Internal() with label name '"<<_labelName<<"' and value '"<<_labelValue<<".");
     assert(solution.localVector());
-    PetscIS cellsIS = NULL;
-    err = DMGetStratumIS(dmSoln, _labelName.c_str(), _labelValue, &cellsIS);PYLITH_CHECK_ERROR(err);
-    err = DMPlexComputeJacobian_Internal(dmSoln, key, cellsIS, t, s_tshift, solution.localVector(), solutionDot.localVector(), jacobianMat, precondMat, NULL);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&cellsIS);PYLITH_CHECK_ERROR(err);
+    PetscIS cellsIS = _getCellsIS();
+    PetscErrorCode err = DMPlexComputeJacobian_Internal(solution.dmMesh(), key, cellsIS, t, s_tshift, solution.localVector(),
+                                                       solutionDot.localVector(), jacobianMat, precondMat, NULL);
+    PYLITH_CHECK_ERROR(err);
+    _restoreCellsIS(&cellsIS);
 
     PYLITH_METHOD_END;
 } // _computeJacobian
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Create key for kernels in weak form.
+PetscFormKey
+pylith::feassemble::_IntegratorDomain::createKey(PetscDMLabel label,
+                                                 const PetscInt value,
+                                                 const PetscInt part) {
+    PetscFormKey key;
+    key.label = label;
+    key.value = value;
+    key.field = 0;
+    key.part = part;
+    return key;
+} // createKey
+
+
 // End of file
@@ -30,8 +30,15 @@
 #include "pylith/feassemble/Integrator.hh" // ISA Integrator
 #include "pylith/utils/arrayfwd.hh" // HASA std::vector
 
+namespace pylith {
+    namespace problems {
+        class TestTimeDependent; // unit testing
+    } // problems
+} // pylith
+
 class pylith::feassemble::IntegratorDomain : public pylith::feassemble::Integrator {
     friend class TestIntegratorDomain; // unit testing
+    friend class pylith::problems::TestTimeDependent; // unit testing
 
     // PUBLIC STRUCTS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -159,6 +166,62 @@ public:
      */
     void setKernelsDerivedField(const std::vector<ProjectKernels>& kernels);
 
+    /** Set memory budget for caching cell geometry between residual and Jacobian evaluations.
+     *
+     * @param[in] value Maximum number of bytes for cached geometry.
+     */
+    void setGeometryCacheBudget(const size_t value);
+
+    /** Get memory reserved for cached cell geometry.
+     *
+     * @returns Estimated number of bytes used by cached geometry (0 if geometry is recomputed on the fly).
+     */
+    size_t getGeometryCacheSize(void) const;
+
+    /** Mark points in the closure of cells that need a time step smaller than the slow time step for stable explicit
+     * time stepping.
+     *
+     * The stable time step of a cell is the minimum distance between its vertices divided by the P-wave speed. Cells
+     * in integration domains without density, shear modulus, and bulk modulus do not limit the time step.
+     *
+     * @param[inout] fastPoints Flags for points in solution mesh (1 if advanced at the fast rate, 0 otherwise).
+     * @param[in] dt Time step for the slow rate.
+     * @param[in] solution Solution field.
+     * @returns Minimum stable time step over cells in integration domain.
+     */
+    PylithReal markMultirateFastPoints(pylith::int_array* fastPoints,
+                                       const PylithReal dt,
+                                       const pylith::topology::Field& solution);
+
+    /** Set cells used in RHS residual evaluations for each multirate bin.
+     *
+     * Cells with any point advanced at the fast (slow) rate in their closure contribute to the fast (slow) bin, so
+     * cells along the boundary between the bins are in both. Cached geometry for the bins is charged against the
+     * memory budget; if it does not fit, geometry for the bins is recomputed in each evaluation.
+     *
+     * @param[in] fastPoints Flags for points in solution mesh (consistent across processes).
+     * @param[in] solution Solution field.
+     */
+    void setMultirateFastPoints(const pylith::int_array& fastPoints,
+                                const pylith::topology::Field& solution);
+
+    /** Split cells into those with and without points shared with other processes.
+     *
+     * Cached geometry for the split is charged against the memory budget; if it does not fit, geometry for the
+     * split is recomputed in each evaluation.
+     *
+     * @param[in] sharedPoints Flags for points in solution mesh (1 if shared with another process, 0 otherwise).
+     * @param[in] solution Solution field.
+     */
+    void setHaloSharedPoints(const pylith::int_array& sharedPoints,
+                             const pylith::topology::Field& solution);
+
+    /** Check whether integrator has a separate set of cells without points shared with other processes.
+     *
+     * @returns True if residual evaluations for HALO_INTERIOR integrate cells, false otherwise.
+     */
+    bool hasHaloInteriorCells(void) const;
+
     /** Initialize integration domain, auxiliary field, and derived field. Update observers.
      *
      * @param[in] solution Solution field (layout).
@@ -209,6 +272,24 @@ public:
                             const pylith::topology::Field& solution,
                             const pylith::topology::Field& solutionDot);
 
+    /** Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector for matrix-free implicit time-stepping.
+     *
+     * @param[inout] action Field for action of Jacobian.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] s_tshift Scale for time derivative.
+     * @param[in] solution Field with trial solution at which Jacobian is evaluated.
+     * @param[in] solutionDot Field with time derivative of trial solution at which Jacobian is evaluated.
+     * @param[in] inputVec PETSc Vec (local) that Jacobian acts on.
+     */
+    void computeLHSJacobianAction(pylith::topology::Field* action,
+                                  const PylithReal t,
+                                  const PylithReal dt,
+                                  const PylithReal s_tshift,
+                                  const pylith::topology::Field& solution,
+                                  const pylith::topology::Field& solutionDot,
+                                  PetscVec inputVec);
+
     /** Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}) with explicit time-stepping.
      *
      * @param[out] jacobianInv Inverse of lumped Jacobian as a field.
@@ -246,27 +327,66 @@ protected:
                               const PylithReal dt,
                               const pylith::topology::Field& solution);
 
-    /** Compute residual using current kernels.
+    /** Register kernels with the PETSc weak form and cache label, keys, and cells for integration domain.
+     *
+     * @param[in] solution Solution field (layout).
+     */
+    void _setWeakFormKernels(const pylith::topology::Field& solution);
+
+    /** Decide whether cell geometry is cached across evaluations based on the memory budget.
+     *
+     * @param[in] solution Solution field (layout).
+     */
+    void _setupGeometryCache(const pylith::topology::Field& solution);
+
+    /** Reserve memory within the budget for caching geometry of an additional set of cells.
+     *
+     * @param[in] numCells Number of cells in set.
+     * @param[out] reserved Number of bytes reserved (0 if geometry is recomputed on the fly).
+     * @returns True if geometry for the set of cells is cached, false otherwise.
+     */
+    bool _reserveGeometryCache(const size_t numCells,
+                               size_t* reserved);
+
+    /** Get cells to pass to DMPlex integration routines.
+     *
+     * The cells are restricted to the current multirate bin or, if no bin is selected, the current halo part.
+     *
+     * PETSc attaches the cell geometry it computes to the IS of cells it integrates over. When geometry is cached we
+     * return the persistent IS, so the geometry is computed once and reused; otherwise we return a temporary copy so
+     * the geometry is released when the copy is restored.
+     *
+     * @returns Cells in integration domain.
+     */
+    PetscIS _getCellsIS(void);
+
+    /** Restore cells obtained from _getCellsIS().
+     *
+     * @param[inout] cellsIS Cells in integration domain.
+     */
+    void _restoreCellsIS(PetscIS* cellsIS);
+
+    /** Compute residual using kernels registered in weak form.
      *
      * @param[out] residual Field for residual.
-     * @param[in] kernels Kernels for computing residual.
+     * @param[in] key Key identifying residual kernels in weak form.
      * @param[in] t Current time.
      * @param[in] dt Current time step.
      * @param[in] solution Field with current trial solution.
      * @param[in] solutionDot Field with time derivative of current trial solution.
      */
     void _computeResidual(pylith::topology::Field* residual,
-                          const std::vector<ResidualKernels>& kernels,
+                          const PetscFormKey& key,
                           const PylithReal t,
                           const PylithReal dt,
                           const pylith::topology::Field& solution,
                           const pylith::topology::Field& solutionDot);
 
-    /** Compute Jacobian using current kernels.
+    /** Compute Jacobian using kernels registered in weak form.
      *
      * @param[out] jacobianMat PETSc Mat with Jacobian sparse matrix.
      * @param[out] precondMat PETSc Mat with Jacobian preconditioning sparse matrix.
-     * @param[in] kernels Kernels for computing Jacobian.
+     * @param[in] key Key identifying Jacobian kernels in weak form.
      * @param[in] t Current time.
      * @param[in] dt Current time step.
      * @param[in] s_tshift Scale for time derivative.
@@ -275,7 +395,7 @@ protected:
      */
     void _computeJacobian(PetscMat jacobianMat,
                           PetscMat precondMat,
-                          const std::vector<JacobianKernels>& kernels,
+                          const PetscFormKey& key,
                           const PylithReal t,
                           const PylithReal dt,
                           const PylithReal s_tshift,
@@ -297,6 +417,25 @@ private:
 
     pylith::feassemble::UpdateStateVars* _updateState; ///< Data structure for layout needed to update state vars.
 
+    PetscIS _cellsIS; ///< Cells in integration domain.
+    PetscIS _cellsSlowIS; ///< Cells contributing to degrees of freedom advanced at the slow rate.
+    PetscIS _cellsFastIS; ///< Cells contributing to degrees of freedom advanced at the fast rate.
+    PetscIS _cellsHaloBoundaryIS; ///< Cells with points shared with other processes.
+    PetscIS _cellsHaloInteriorIS; ///< Cells without points shared with other processes.
+    PetscFormKey _keyRHSResidual; ///< Weak form key for RHS residual kernels.
+    PetscFormKey _keyLHSResidual; ///< Weak form key for LHS residual kernels.
+    PetscFormKey _keyLHSJacobian; ///< Weak form key for LHS Jacobian kernels.
+    PetscFormKey _keyLHSJacobianLumped; ///< Weak form key for LHS lumped Jacobian kernels.
+
+    size_t _geometryCacheBudget; ///< Maximum number of bytes for cached cell geometry.
+    size_t _geometryCacheSize; ///< Estimated number of bytes used by cached cell geometry.
+    size_t _geometryCacheCellSize; ///< Estimated number of bytes of cached geometry per cell.
+    size_t _geometryCacheSizeMultirate; ///< Estimated number of bytes used by cached geometry of multirate bins.
+    size_t _geometryCacheSizeHalo; ///< Estimated number of bytes used by cached geometry of halo boundary/interior cells.
+    bool _cacheGeometry; ///< True if cell geometry is reused across evaluations.
+    bool _cacheGeometryMultirate; ///< True if cell geometry of multirate bins is reused across evaluations.
+    bool _cacheGeometryHalo; ///< True if cell geometry of halo boundary/interior cells is reused across evaluations.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
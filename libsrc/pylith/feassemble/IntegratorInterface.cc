@@ -105,6 +105,66 @@ public:
                                  const pylith::topology::Field& solution,
                                  const pylith::topology::Field& solutionDot);
 
+            /** Register residual kernels with PETSc DS for cohesive cells.
+             *
+             * @param[in] integrator Integrator for interface.
+             * @param[in] kernels Kernels for computing residual.
+             * @param[in] solution Solution field (layout).
+             */
+            static
+            void setKernels(const pylith::feassemble::IntegratorInterface* integrator,
+                            const std::vector<pylith::feassemble::IntegratorInterface::ResidualKernels>& kernels,
+                            const pylith::topology::Field& solution);
+
+            /** Register Jacobian kernels with PETSc DS for cohesive cells.
+             *
+             * @param[in] integrator Integrator for interface.
+             * @param[in] kernels Kernels for computing Jacobian.
+             * @param[in] solution Solution field (layout).
+             */
+            static
+            void setKernels(const pylith::feassemble::IntegratorInterface* integrator,
+                            const std::vector<pylith::feassemble::IntegratorInterface::JacobianKernels>& kernels,
+                            const pylith::topology::Field& solution);
+
+            /** Check whether PETSc DS for cohesive cells holds residual kernels.
+             *
+             * All interfaces share the PETSc DS for cohesive cells, so registration of kernels by another interface may
+             * have replaced the kernels for this interface.
+             *
+             * @param[in] integrator Integrator for interface.
+             * @param[in] kernels Kernels for computing residual.
+             * @param[in] solution Solution field (layout).
+             * @returns True if PETSc DS holds kernels, false otherwise.
+             */
+            static
+            bool hasKernels(const pylith::feassemble::IntegratorInterface* integrator,
+                            const std::vector<pylith::feassemble::IntegratorInterface::ResidualKernels>& kernels,
+                            const pylith::topology::Field& solution);
+
+            /** Check whether PETSc DS for cohesive cells holds Jacobian kernels.
+             *
+             * @param[in] integrator Integrator for interface.
+             * @param[in] kernels Kernels for computing Jacobian.
+             * @param[in] solution Solution field (layout).
+             * @returns True if PETSc DS holds kernels, false otherwise.
+             */
+            static
+            bool hasKernels(const pylith::feassemble::IntegratorInterface* integrator,
+                            const std::vector<pylith::feassemble::IntegratorInterface::JacobianKernels>& kernels,
+                            const pylith::topology::Field& solution);
+
+            /** Set auxiliary field for cohesive cells if it is not already set.
+             *
+             * All interfaces use the same key (NULL label) for the auxiliary field.
+             *
+             * @param[in] integrator Integrator for interface.
+             * @param[in] solution Solution field (layout).
+             */
+            static
+            void setAuxiliaryVec(const pylith::feassemble::IntegratorInterface* integrator,
+                                 const pylith::topology::Field& solution);
+
             static const char* genericComponent;
         }; // _IntegratorInterface
         const char* _IntegratorInterface::genericComponent = "integratorinterface";
@@ -117,7 +177,9 @@ public:
 pylith::feassemble::IntegratorInterface::IntegratorInterface(pylith::problems::Physics* const physics) :
     Integrator(physics),
     _interfaceMesh(NULL),
-    _interfaceSurfaceLabel("") {
+    _interfaceSurfaceLabel(""),
+    _cohesiveCellsIS(NULL),
+    _cohesiveDS(NULL) {
     GenericComponent::setName(_IntegratorInterface::genericComponent);
     _labelValue = 100;
     _labelName = pylith::topology::Mesh::getCellsLabelName();
@@ -140,6 +202,9 @@ pylith::feassemble::IntegratorInterface::deallocate(void) {
     pylith::feassemble::Integrator::deallocate();
 
     delete _interfaceMesh;_interfaceMesh = NULL;
+    _cohesiveDS = NULL; // Memory managed by solution DM.
+
+    PetscErrorCode err = ISDestroy(&_cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -231,6 +296,30 @@ pylith::feassemble::IntegratorInterface::initialize(const pylith::topology::Fiel
 
     Integrator::initialize(solution);
 
+    // Mesh does not change, so the cohesive cells and their PETSc DS can be reused for every residual and Jacobian.
+    PetscErrorCode err;
+    PetscDM dmSoln = solution.dmMesh();assert(dmSoln);
+    err = ISDestroy(&_cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
+    err = DMGetStratumIS(dmSoln, _labelName.c_str(), _labelValue, &_cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
+    PetscInt numCohesiveCells = 0;
+    if (_cohesiveCellsIS) {
+        err = ISGetSize(_cohesiveCellsIS, &numCohesiveCells);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (numCohesiveCells > 0) {
+        const PetscInt* cellIndices = NULL;
+        err = ISGetIndices(_cohesiveCellsIS, &cellIndices);PYLITH_CHECK_ERROR(err);assert(cellIndices);
+        assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, cellIndices[0]));
+        err = DMGetCellDS(dmSoln, cellIndices[0], &_cohesiveDS);PYLITH_CHECK_ERROR(err);
+        err = ISRestoreIndices(_cohesiveCellsIS, &cellIndices);PYLITH_CHECK_ERROR(err);
+
+        if (_kernelsLHSResidual.size() > 0) {
+            _IntegratorInterface::setKernels(this, _kernelsLHSResidual, solution);
+        } else if (_kernelsRHSResidual.size() > 0) {
+            _IntegratorInterface::setKernels(this, _kernelsRHSResidual, solution);
+        } // if/else
+        _IntegratorInterface::setKernels(this, _kernelsLHSJacobian, solution);
+    } // if
+
     PYLITH_METHOD_END;
 } // initialize
 
@@ -272,12 +361,14 @@ pylith::feassemble::IntegratorInterface::computeRHSResidual(pylith::topology::Fi
 
     if (0 == _kernelsRHSResidual.size()) { PYLITH_METHOD_END;}
 
+    _eventBegin(EVENT_COMPUTE_RHS_RESIDUAL);
     _setKernelConstants(solution, dt);
 
-    pylith::topology::Field solutionDot(solution.mesh()); // No dependence on time derivative of solution in RHS.
-    solutionDot.setLabel("solution_dot");
+    // No dependence on time derivative of solution in RHS.
+    const pylith::topology::Field& solutionDot = _getSolutionDotEmpty(solution);
 
     _IntegratorInterface::computeResidual(residual, this, _kernelsRHSResidual, t, dt, solution, solutionDot);
+    _eventEnd(EVENT_COMPUTE_RHS_RESIDUAL);
 
     PYLITH_METHOD_END;
 } // computeRHSResidual
@@ -296,9 +387,11 @@ pylith::feassemble::IntegratorInterface::computeLHSResidual(pylith::topology::Fi
 
     if (0 == _kernelsLHSResidual.size()) { PYLITH_METHOD_END;}
 
+    _eventBegin(EVENT_COMPUTE_LHS_RESIDUAL);
     _setKernelConstants(solution, dt);
 
     _IntegratorInterface::computeResidual(residual, this, _kernelsLHSResidual, t, dt, solution, solutionDot);
+    _eventEnd(EVENT_COMPUTE_LHS_RESIDUAL);
 
     PYLITH_METHOD_END;
 } // computeLHSResidual
@@ -320,15 +413,39 @@ pylith::feassemble::IntegratorInterface::computeLHSJacobian(PetscMat jacobianMat
     _needNewLHSJacobian = false;
     if (0 == _kernelsLHSJacobian.size()) { PYLITH_METHOD_END;}
 
+    _eventBegin(EVENT_COMPUTE_LHS_JACOBIAN);
     _setKernelConstants(solution, dt);
 
     _IntegratorInterface::computeJacobian(jacobianMat, precondMat, this, _kernelsLHSJacobian, t, dt, s_tshift,
                                           solution, solutionDot);
+    _eventEnd(EVENT_COMPUTE_LHS_JACOBIAN);
 
     PYLITH_METHOD_END;
 } // computeLHSJacobian
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector.
+void
+pylith::feassemble::IntegratorInterface::computeLHSJacobianAction(pylith::topology::Field* action,
+                                                                  const PylithReal t,
+                                                                  const PylithReal dt,
+                                                                  const PylithReal s_tshift,
+                                                                  const pylith::topology::Field& solution,
+                                                                  const pylith::topology::Field& solutionDot,
+                                                                  PetscVec inputVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("computeLHSJacobianAction(action="<<action<<", t="<<t<<", dt="<<dt<<", s_tshift="<<s_tshift<<", solution="<<solution.getLabel()<<", solutionDot="<<solutionDot.getLabel()<<", inputVec="<<inputVec<<")");
+
+    if (0 == _kernelsLHSJacobian.size()) { PYLITH_METHOD_END;}
+
+    // PETSc does not provide the action of the Jacobian for cohesive cells.
+    PYLITH_JOURNAL_LOGICERROR("Matrix-free Jacobian not supported for interfaces with cohesive cells.");
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Compute LHS Jacobian for F(t,s,\dot{s}).
 void
@@ -367,27 +484,17 @@ pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Fiel
 
     assert(integrator);
     assert(residual);
-
-    const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
+    if (!integrator->_cohesiveDS) { // No cohesive cells for this interface on this process.
+        PYLITH_METHOD_END;
+    } // if
 
     PetscErrorCode err;
 
     PetscDM dmSoln = solution.dmMesh();
-    PetscIS cohesiveCellsIS = NULL;
-    PetscInt numCohesiveCells = 0;
-    const PetscInt* cellIndices = NULL;
-    err = DMGetStratumIS(dmSoln, integrator->getLabelName(), integrator->getLabelValue(), &cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
-    err = ISGetSize(cohesiveCellsIS, &numCohesiveCells);PYLITH_CHECK_ERROR(err);assert(numCohesiveCells > 0);
-    err = ISGetIndices(cohesiveCellsIS, &cellIndices);PYLITH_CHECK_ERROR(err);assert(cellIndices);
-
-    assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, cellIndices[0]));
-    PetscDS prob = NULL;
-    err = DMGetCellDS(dmSoln, cellIndices[0], &prob);PYLITH_CHECK_ERROR(err);
-
-    // Get auxiliary data
-    PetscDMLabel dmLabel = NULL;
-    PetscInt labelValue = 0;
-    err = DMSetAuxiliaryVec(dmSoln, dmLabel, labelValue, auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
+    setAuxiliaryVec(integrator, solution);
+    if (!hasKernels(integrator, kernels, solution)) {
+        setKernels(integrator, kernels, solution);
+    } // if
 
     PetscFormKey keys[3];
     keys[0].label = NULL;
@@ -406,15 +513,9 @@ pylith::feassemble::_IntegratorInterface::computeResidual(pylith::topology::Fiel
     // Compute the local residual
     assert(solution.localVector());
     assert(residual->localVector());
-    for (size_t i = 0; i < kernels.size(); ++i) {
-        const PetscInt i_field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
-        err = PetscDSSetBdResidual(prob, i_field, kernels[i].r0, kernels[i].r1);PYLITH_CHECK_ERROR(err);
-    } // for
-    err = DMPlexComputeResidual_Hybrid_Internal(dmSoln, keys, cohesiveCellsIS, t, solution.localVector(),
+    err = DMPlexComputeResidual_Hybrid_Internal(dmSoln, keys, integrator->_cohesiveCellsIS, t, solution.localVector(),
                                                 solutionDot.localVector(), t,
                                                 residual->localVector(), NULL);PYLITH_CHECK_ERROR(err);
-    err = ISRestoreIndices(cohesiveCellsIS, &cellIndices);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&cohesiveCellsIS);PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
 } // computeResidual
@@ -442,28 +543,17 @@ pylith::feassemble::_IntegratorInterface::computeJacobian(PetscMat jacobianMat,
 
     assert(jacobianMat);
     assert(precondMat);
-
-    const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
+    if (!integrator->_cohesiveDS) { // No cohesive cells for this interface on this process.
+        PYLITH_METHOD_END;
+    } // if
 
     PetscErrorCode err;
 
     PetscDM dmSoln = solution.dmMesh();
-
-    PetscIS cohesiveCells = NULL;
-    PetscInt numCohesiveCells = 0;
-    const PetscInt* cellIndices = NULL;
-    err = DMGetStratumIS(dmSoln, integrator->getLabelName(), integrator->getLabelValue(), &cohesiveCells);PYLITH_CHECK_ERROR(err);
-    err = ISGetSize(cohesiveCells, &numCohesiveCells);PYLITH_CHECK_ERROR(err);assert(numCohesiveCells > 0);
-    err = ISGetIndices(cohesiveCells, &cellIndices);PYLITH_CHECK_ERROR(err);assert(cellIndices);
-
-    assert(pylith::topology::MeshOps::isCohesiveCell(dmSoln, cellIndices[0]));
-    PetscDS prob = NULL;
-    err = DMGetCellDS(dmSoln, cellIndices[0], &prob);PYLITH_CHECK_ERROR(err);
-
-    // Set auxiliary data
-    PetscDMLabel dmLabel = NULL;
-    PetscInt labelValue = 0;
-    err = DMSetAuxiliaryVec(dmSoln, dmLabel, labelValue, auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
+    setAuxiliaryVec(integrator, solution);
+    if (!hasKernels(integrator, kernels, solution)) {
+        setKernels(integrator, kernels, solution);
+    } // if
 
     PetscFormKey keys[3];
     keys[0].label = NULL;
@@ -480,21 +570,145 @@ pylith::feassemble::_IntegratorInterface::computeJacobian(PetscMat jacobianMat,
     keys[2].part  = 0;
 
     // Compute the local Jacobian
+    assert(solution.localVector());
+    err = DMPlexComputeJacobian_Hybrid_Internal(dmSoln, keys, integrator->_cohesiveCellsIS, t, s_tshift, solution.localVector(),
+                                                solutionDot.localVector(), jacobianMat, precondMat,
+                                                NULL);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // computeJacobian
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Register residual kernels with PETSc DS for cohesive cells.
+void
+pylith::feassemble::_IntegratorInterface::setKernels(const pylith::feassemble::IntegratorInterface* integrator,
+                                                     const std::vector<pylith::feassemble::IntegratorInterface::ResidualKernels>& kernels,
+                                                     const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_IntegratorInterface::genericComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "_IntegratorInterface::setKernels(integrator="<<typeid(integrator).name()<<", # residual kernels="
+          <<kernels.size()<<", solution="<<solution.getLabel()<<")"
+          << pythia::journal::endl;
+
+    assert(integrator);
+    PetscDS prob = integrator->_cohesiveDS;assert(prob);
+
+    PetscErrorCode err;
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        const PetscInt i_field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
+        err = PetscDSSetBdResidual(prob, i_field, kernels[i].r0, kernels[i].r1);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PYLITH_METHOD_END;
+} // setKernels
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Register Jacobian kernels with PETSc DS for cohesive cells.
+void
+pylith::feassemble::_IntegratorInterface::setKernels(const pylith::feassemble::IntegratorInterface* integrator,
+                                                     const std::vector<pylith::feassemble::IntegratorInterface::JacobianKernels>& kernels,
+                                                     const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_IntegratorInterface::genericComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "_IntegratorInterface::setKernels(integrator="<<typeid(integrator).name()<<", # Jacobian kernels="
+          <<kernels.size()<<", solution="<<solution.getLabel()<<")"
+          << pythia::journal::endl;
+
+    assert(integrator);
+    PetscDS prob = integrator->_cohesiveDS;assert(prob);
+
+    PetscErrorCode err;
     for (size_t i = 0; i < kernels.size(); ++i) {
         const PetscInt i_fieldTrial = solution.subfieldInfo(kernels[i].subfieldTrial.c_str()).index;
         const PetscInt i_fieldBasis = solution.subfieldInfo(kernels[i].subfieldBasis.c_str()).index;
         err = PetscDSSetBdJacobian(prob, i_fieldTrial, i_fieldBasis, kernels[i].j0, kernels[i].j1, kernels[i].j2, kernels[i].j3);PYLITH_CHECK_ERROR(err);
     } // for
 
-    assert(solution.localVector());
-    err = DMPlexComputeJacobian_Hybrid_Internal(dmSoln, keys, cohesiveCells, t, s_tshift, solution.localVector(),
-                                                solutionDot.localVector(), jacobianMat, precondMat,
-                                                NULL);PYLITH_CHECK_ERROR(err);
-    err = ISRestoreIndices(cohesiveCells, &cellIndices);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&cohesiveCells);PYLITH_CHECK_ERROR(err);
+    PYLITH_METHOD_END;
+} // setKernels
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether PETSc DS for cohesive cells holds residual kernels.
+bool
+pylith::feassemble::_IntegratorInterface::hasKernels(const pylith::feassemble::IntegratorInterface* integrator,
+                                                     const std::vector<pylith::feassemble::IntegratorInterface::ResidualKernels>& kernels,
+                                                     const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(integrator);
+    PetscDS prob = integrator->_cohesiveDS;assert(prob);
+
+    PetscErrorCode err;
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        const PetscInt i_field = solution.subfieldInfo(kernels[i].subfield.c_str()).index;
+        PetscBdPointFunc r0 = NULL;
+        PetscBdPointFunc r1 = NULL;
+        err = PetscDSGetBdResidual(prob, i_field, &r0, &r1);PYLITH_CHECK_ERROR(err);
+        if ((kernels[i].r0 != r0) || (kernels[i].r1 != r1)) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    PYLITH_METHOD_RETURN(true);
+} // hasKernels
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether PETSc DS for cohesive cells holds Jacobian kernels.
+bool
+pylith::feassemble::_IntegratorInterface::hasKernels(const pylith::feassemble::IntegratorInterface* integrator,
+                                                     const std::vector<pylith::feassemble::IntegratorInterface::JacobianKernels>& kernels,
+                                                     const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(integrator);
+    PetscDS prob = integrator->_cohesiveDS;assert(prob);
+
+    PetscErrorCode err;
+    for (size_t i = 0; i < kernels.size(); ++i) {
+        const PetscInt i_fieldTrial = solution.subfieldInfo(kernels[i].subfieldTrial.c_str()).index;
+        const PetscInt i_fieldBasis = solution.subfieldInfo(kernels[i].subfieldBasis.c_str()).index;
+        PetscBdPointJac j0 = NULL;
+        PetscBdPointJac j1 = NULL;
+        PetscBdPointJac j2 = NULL;
+        PetscBdPointJac j3 = NULL;
+        err = PetscDSGetBdJacobian(prob, i_fieldTrial, i_fieldBasis, &j0, &j1, &j2, &j3);PYLITH_CHECK_ERROR(err);
+        if ((kernels[i].j0 != j0) || (kernels[i].j1 != j1) || (kernels[i].j2 != j2) || (kernels[i].j3 != j3)) {
+            PYLITH_METHOD_RETURN(false);
+        } // if
+    } // for
+
+    PYLITH_METHOD_RETURN(true);
+} // hasKernels
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set auxiliary field for cohesive cells if it is not already set.
+void
+pylith::feassemble::_IntegratorInterface::setAuxiliaryVec(const pylith::feassemble::IntegratorInterface* integrator,
+                                                          const pylith::topology::Field& solution) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(integrator);
+    const pylith::topology::Field* auxiliaryField = integrator->getAuxiliaryField();assert(auxiliaryField);
+
+    PetscErrorCode err;
+    PetscDM dmSoln = solution.dmMesh();
+    PetscDMLabel dmLabel = NULL;
+    PetscInt labelValue = 0;
+    PetscVec auxiliaryVec = NULL;
+    err = DMGetAuxiliaryVec(dmSoln, dmLabel, labelValue, &auxiliaryVec);PYLITH_CHECK_ERROR(err);
+    if (auxiliaryVec != auxiliaryField->localVector()) {
+        err = DMSetAuxiliaryVec(dmSoln, dmLabel, labelValue, auxiliaryField->localVector());PYLITH_CHECK_ERROR(err);
+    } // if
 
     PYLITH_METHOD_END;
-} // computeJacobian
+} // setAuxiliaryVec
 
 
 // End of file
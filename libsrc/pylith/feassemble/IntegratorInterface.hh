@@ -32,6 +32,7 @@
 
 class pylith::feassemble::IntegratorInterface : public pylith::feassemble::Integrator {
     friend class TestIntegratorInterface; // unit testing
+    friend class _IntegratorInterface; // private utility functions
 
     // PUBLIC STRUCTS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
@@ -197,6 +198,24 @@ public:
                             const pylith::topology::Field& solution,
                             const pylith::topology::Field& solutionDot);
 
+    /** Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector for matrix-free implicit time-stepping.
+     *
+     * @param[inout] action Field for action of Jacobian.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] s_tshift Scale for time derivative.
+     * @param[in] solution Field with trial solution at which Jacobian is evaluated.
+     * @param[in] solutionDot Field with time derivative of trial solution at which Jacobian is evaluated.
+     * @param[in] inputVec PETSc Vec (local) that Jacobian acts on.
+     */
+    void computeLHSJacobianAction(pylith::topology::Field* action,
+                                  const PylithReal t,
+                                  const PylithReal dt,
+                                  const PylithReal s_tshift,
+                                  const pylith::topology::Field& solution,
+                                  const pylith::topology::Field& solutionDot,
+                                  PetscVec inputVec);
+
     /** Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}) with explicit time-stepping.
      *
      * @param[out] jacobianInv Inverse of lumped Jacobian as a field.
@@ -222,6 +241,9 @@ private:
     pylith::topology::Mesh* _interfaceMesh; ///< Boundary mesh.
     std::string _interfaceSurfaceLabel; ///< Name of label identifying interface surface.
 
+    PetscIS _cohesiveCellsIS; ///< Cohesive cells in integration domain.
+    PetscDS _cohesiveDS; ///< PETSc DS for cohesive cells.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -22,14 +22,20 @@
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
 #include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
 #include "pylith/problems/Physics.hh" // USES Physics
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_JOURNAL_*
 
+#include "petsctime.h" // USES PetscTime()
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
+#include <string> // USES std::string
 
 // ------------------------------------------------------------------------------------------------
 // Default constructor.
@@ -38,8 +44,16 @@ pylith::feassemble::PhysicsImplementation::PhysicsImplementation(pylith::problem
     _auxiliaryField(NULL),
     _derivedField(NULL),
     _observers(NULL),
-    _logger(NULL)
-{}
+    _logger(NULL) {
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        _eventIds[i] = -1;
+        _eventCounts[i] = 0;
+        _eventTimes[i] = 0.0;
+        _eventFlops[i] = 0.0;
+        _eventStartTimes[i] = 0.0;
+        _eventStartFlops[i] = 0.0;
+    } // for
+} // constructor
 
 
 // ------------------------------------------------------------------------------------------------
@@ -96,4 +110,162 @@ pylith::feassemble::PhysicsImplementation::notifyObservers(const PylithReal t,
 } // _notifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Get identifier of physics implemented.
+const char*
+pylith::feassemble::PhysicsImplementation::getPhysicsIdentifier(void) const {
+    assert(_physics);
+    return _physics->getIdentifier();
+} // getPhysicsIdentifier
+
+
+// ------------------------------------------------------------------------------------------------
+// Write auxiliary field, including state variables, to checkpoint file.
+void
+pylith::feassemble::PhysicsImplementation::writeCheckpoint(PetscViewer viewer) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("writeCheckpoint(viewer="<<viewer<<")");
+
+    if (!_auxiliaryField) {
+        PYLITH_METHOD_END;
+    } // if
+
+    const std::string groupName = std::string("/auxiliary/") + getPhysicsIdentifier();
+    PetscErrorCode err = PetscViewerHDF5PushGroup(viewer, groupName.c_str());PYLITH_CHECK_ERROR(err);
+    pylith::topology::FieldOps::writeCheckpoint(viewer, *_auxiliaryField);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // writeCheckpoint
+
+
+// ------------------------------------------------------------------------------------------------
+// Read auxiliary field, including state variables, from checkpoint file.
+void
+pylith::feassemble::PhysicsImplementation::readCheckpoint(PetscViewer viewer) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("readCheckpoint(viewer="<<viewer<<")");
+
+    if (!_auxiliaryField) {
+        PYLITH_METHOD_END;
+    } // if
+
+    const std::string groupName = std::string("/auxiliary/") + getPhysicsIdentifier();
+    PetscErrorCode err = PetscViewerHDF5PushGroup(viewer, groupName.c_str());PYLITH_CHECK_ERROR(err);
+    pylith::topology::FieldOps::readCheckpoint(viewer, _auxiliaryField);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // readCheckpoint
+
+
+// ------------------------------------------------------------------------------------------------
+// Get name of event.
+const char*
+pylith::feassemble::PhysicsImplementation::getEventName(const EventEnum event) {
+    switch (event) {
+    case EVENT_COMPUTE_RHS_RESIDUAL:
+        return "computeRHSResidual";
+    case EVENT_COMPUTE_LHS_RESIDUAL:
+        return "computeLHSResidual";
+    case EVENT_COMPUTE_LHS_JACOBIAN:
+        return "computeLHSJacobian";
+    case EVENT_UPDATE_STATE_VARS:
+        return "updateStateVars";
+    case EVENT_COMPUTE_DERIVED_FIELD:
+        return "computeDerivedField";
+    case EVENT_SET_SOLUTION:
+        return "setSolution";
+    default:
+        throw std::logic_error("Unknown event in PhysicsImplementation::getEventName().");
+    } // switch
+
+    return NULL; // Not reached.
+} // getEventName
+
+
+// ------------------------------------------------------------------------------------------------
+// Get number of times event has been logged on this process.
+size_t
+pylith::feassemble::PhysicsImplementation::getEventCount(const EventEnum event) const {
+    assert(event >= 0 && event < NUM_EVENTS);
+    return _eventCounts[event];
+} // getEventCount
+
+
+// ------------------------------------------------------------------------------------------------
+// Get accumulated wall clock time for event on this process.
+PylithReal
+pylith::feassemble::PhysicsImplementation::getEventTime(const EventEnum event) const {
+    assert(event >= 0 && event < NUM_EVENTS);
+    return _eventTimes[event];
+} // getEventTime
+
+
+// ------------------------------------------------------------------------------------------------
+// Get accumulated floating point operations for event on this process.
+PylithReal
+pylith::feassemble::PhysicsImplementation::getEventFlops(const EventEnum event) const {
+    assert(event >= 0 && event < NUM_EVENTS);
+    return _eventFlops[event];
+} // getEventFlops
+
+
+// ------------------------------------------------------------------------------------------------
+// Setup event logging with events named by the identifier of the physics.
+void
+pylith::feassemble::PhysicsImplementation::_initializeLogger(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _logger;_logger = new pylith::utils::EventLogger;assert(_logger);
+    _logger->setClassName("PhysicsImplementation");
+    _logger->initialize();
+
+    const std::string prefix = std::string("Py-") + getPhysicsIdentifier() + "-";
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        const std::string eventName = prefix + getEventName(EventEnum(i));
+        _eventIds[i] = _logger->registerEvent(eventName.c_str());
+    } // for
+
+    PYLITH_METHOD_END;
+} // _initializeLogger
+
+
+// ------------------------------------------------------------------------------------------------
+// Log beginning of event.
+void
+pylith::feassemble::PhysicsImplementation::_eventBegin(const EventEnum event) {
+    assert(event >= 0 && event < NUM_EVENTS);
+    if (!_logger) { return; }
+
+    PetscErrorCode err = 0;
+    PetscLogDouble value = 0.0;
+    err = PetscGetFlops(&value);PYLITH_CHECK_ERROR(err);
+    _eventStartFlops[event] = value;
+    err = PetscTime(&value);PYLITH_CHECK_ERROR(err);
+    _eventStartTimes[event] = value;
+
+    _logger->eventBegin(_eventIds[event]);
+} // _eventBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// Log end of event.
+void
+pylith::feassemble::PhysicsImplementation::_eventEnd(const EventEnum event) {
+    assert(event >= 0 && event < NUM_EVENTS);
+    if (!_logger) { return; }
+
+    _logger->eventEnd(_eventIds[event]);
+
+    PetscErrorCode err = 0;
+    PetscLogDouble value = 0.0;
+    err = PetscTime(&value);PYLITH_CHECK_ERROR(err);
+    _eventTimes[event] += value - _eventStartTimes[event];
+    err = PetscGetFlops(&value);PYLITH_CHECK_ERROR(err);
+    _eventFlops[event] += value - _eventStartFlops[event];
+    ++_eventCounts[event];
+} // _eventEnd
+
+
 // End of file
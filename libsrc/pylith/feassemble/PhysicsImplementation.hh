@@ -32,11 +32,25 @@
 #include "pylith/topology/topologyfwd.hh" // USES Field
 
 #include "pylith/utils/array.hh" // HASA int_array
+#include "pylith/utils/petscfwd.h" // USES PetscViewer
 #include "pylith/utils/utilsfwd.hh" // HOLDSA Logger
 
 class pylith::feassemble::PhysicsImplementation : public pylith::utils::GenericComponent {
     friend class TestPhysicsImplementation; // unit testing
 
+    // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum EventEnum {
+        EVENT_COMPUTE_RHS_RESIDUAL=0, // Compute RHS residual.
+        EVENT_COMPUTE_LHS_RESIDUAL=1, // Compute LHS residual.
+        EVENT_COMPUTE_LHS_JACOBIAN=2, // Compute LHS Jacobian.
+        EVENT_UPDATE_STATE_VARS=3, // Update state variables.
+        EVENT_COMPUTE_DERIVED_FIELD=4, // Compute derived field.
+        EVENT_SET_SOLUTION=5, // Set constrained values in solution.
+        NUM_EVENTS=6, // Number of events.
+    };
+
     // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -82,6 +96,73 @@ public:
                          const PylithInt tindex,
                          const pylith::topology::Field& solution);
 
+    /** Get identifier of physics implemented.
+     *
+     * @returns Identifier of physics.
+     */
+    const char* getPhysicsIdentifier(void) const;
+
+    /** Write auxiliary field, including state variables, to checkpoint file.
+     *
+     * @param[in] viewer PETSc HDF5 viewer for checkpoint file.
+     */
+    void writeCheckpoint(PetscViewer viewer) const;
+
+    /** Read auxiliary field, including state variables, from checkpoint file.
+     *
+     * @param[in] viewer PETSc HDF5 viewer for checkpoint file.
+     */
+    void readCheckpoint(PetscViewer viewer);
+
+    /** Get name of event.
+     *
+     * @param[in] event Event.
+     * @returns Name of event.
+     */
+    static
+    const char* getEventName(const EventEnum event);
+
+    /** Get number of times event has been logged on this process.
+     *
+     * @param[in] event Event.
+     * @returns Number of times event has been logged.
+     */
+    size_t getEventCount(const EventEnum event) const;
+
+    /** Get accumulated wall clock time for event on this process.
+     *
+     * @param[in] event Event.
+     * @returns Accumulated time (s) for event.
+     */
+    PylithReal getEventTime(const EventEnum event) const;
+
+    /** Get accumulated floating point operations for event on this process.
+     *
+     * Only operations logged with PetscLogFlops() are included.
+     *
+     * @param[in] event Event.
+     * @returns Accumulated floating point operations for event.
+     */
+    PylithReal getEventFlops(const EventEnum event) const;
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /// Setup event logging with events named by the identifier of the physics.
+    void _initializeLogger(void);
+
+    /** Log beginning of event.
+     *
+     * @param[in] event Event.
+     */
+    void _eventBegin(const EventEnum event);
+
+    /** Log end of event.
+     *
+     * @param[in] event Event.
+     */
+    void _eventEnd(const EventEnum event);
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -92,6 +173,16 @@ protected:
 
     pylith::utils::EventLogger* _logger; ///< Event logger.
 
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    int _eventIds[NUM_EVENTS]; ///< PETSc identifiers for events.
+    size_t _eventCounts[NUM_EVENTS]; ///< Number of times each event has been logged.
+    PylithReal _eventTimes[NUM_EVENTS]; ///< Accumulated time for each event.
+    PylithReal _eventFlops[NUM_EVENTS]; ///< Accumulated floating point operations for each event.
+    PylithReal _eventStartTimes[NUM_EVENTS]; ///< Time at beginning of current event.
+    PylithReal _eventStartFlops[NUM_EVENTS]; ///< Floating point operations at beginning of current event.
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
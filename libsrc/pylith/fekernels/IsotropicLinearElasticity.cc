@@ -70,24 +70,24 @@ pylith::fekernels::IsotropicLinearElasticityPlaneStrain::f1v(const PylithInt dim
     assert(aOff[i_bulkModulus] >= 0);
     assert(f1);
 
-    const PylithInt _numS = 1; // Number passed on to stress kernels.
-    const PylithInt sOffDisp[1] = { sOff[i_disp] };
-    const PylithInt sOffDisp_x[1] = { sOff_x[i_disp] };
+    // Same stress as meanStress() + deviatoricStress(), computed directly because this kernel is called at every
+    // quadrature point of every residual evaluation.
+    const PylithScalar* disp_x = &s_x[sOff_x[i_disp]];
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar bulkModulus = a[aOff[i_bulkModulus]];
 
-    const PylithInt numAMean = 1; // Number passed to mean stress kernel.
-    const PylithInt aOffMean[1] = { aOff[i_bulkModulus] };
+    const PylithReal strainTrace = disp_x[0*_dim+0] + disp_x[1*_dim+1];
+    const PylithReal diagonalTerm = (bulkModulus - 2.0/3.0*shearModulus) * strainTrace;
+    const PylithReal twomu = 2.0*shearModulus;
 
-    const PylithInt numADev = 1; // Number passed to deviatoric stress kernel.
-    const PylithInt aOffDev[1] = { aOff[i_shearModulus] };
+    const PylithScalar stress_xx = twomu*disp_x[0*_dim+0] + diagonalTerm;
+    const PylithScalar stress_yy = twomu*disp_x[1*_dim+1] + diagonalTerm;
+    const PylithScalar stress_xy = shearModulus * (disp_x[0*_dim+1] + disp_x[1*_dim+0]);
 
-    PylithScalar stressTensor[4] = {0.0, 0.0, 0.0, 0.0};
-    meanStress(_dim, _numS, numAMean, sOffDisp, sOffDisp_x, s, s_t, s_x, aOffMean, NULL, a, a_t, NULL,
-               t, x, numConstants, constants, stressTensor);
-    deviatoricStress(_dim, _numS, numADev, sOffDisp, sOffDisp_x, s, s_t, s_x, aOffDev, NULL, a, a_t, NULL,
-                     t, x, numConstants, constants, stressTensor);
-    for (PylithInt i = 0; i < _dim*_dim; ++i) {
-        f1[i] -= stressTensor[i];
-    } // for
+    f1[0*_dim+0] -= stress_xx;
+    f1[1*_dim+1] -= stress_yy;
+    f1[0*_dim+1] -= stress_xy;
+    f1[1*_dim+0] -= stress_xy;
 } // f1v
 
 
@@ -724,24 +724,32 @@ pylith::fekernels::IsotropicLinearElasticity3D::f1v(const PylithInt dim,
     assert(aOff[i_bulkModulus] >= 0);
     assert(f1);
 
-    const PylithInt _numS = 1; // Number passed on to stress kernels.
-    const PylithInt sOffDisp[1] = { sOff[i_disp] };
-    const PylithInt sOffDisp_x[1] = { sOff_x[i_disp] };
+    // Same stress as meanStress() + deviatoricStress(), computed directly because this kernel is called at every
+    // quadrature point of every residual evaluation.
+    const PylithScalar* disp_x = &s_x[sOff_x[i_disp]];
+    const PylithScalar shearModulus = a[aOff[i_shearModulus]];
+    const PylithScalar bulkModulus = a[aOff[i_bulkModulus]];
 
-    const PylithInt numAMean = 1; // Number passed to mean stress kernel.
-    const PylithInt aOffMean[1] = { aOff[i_bulkModulus] };
+    const PylithReal strainTrace = disp_x[0*_dim+0] + disp_x[1*_dim+1] + disp_x[2*_dim+2];
+    const PylithReal diagonalTerm = (bulkModulus - 2.0/3.0*shearModulus) * strainTrace;
+    const PylithReal twomu = 2.0*shearModulus;
 
-    const PylithInt numADev = 1; // Number passed to deviatoric stress kernel.
-    const PylithInt aOffDev[1] = { aOff[i_shearModulus] };
+    const PylithScalar stress_xx = twomu*disp_x[0*_dim+0] + diagonalTerm;
+    const PylithScalar stress_yy = twomu*disp_x[1*_dim+1] + diagonalTerm;
+    const PylithScalar stress_zz = twomu*disp_x[2*_dim+2] + diagonalTerm;
+    const PylithScalar stress_xy = shearModulus * (disp_x[0*_dim+1] + disp_x[1*_dim+0]);
+    const PylithScalar stress_yz = shearModulus * (disp_x[1*_dim+2] + disp_x[2*_dim+1]);
+    const PylithScalar stress_xz = shearModulus * (disp_x[0*_dim+2] + disp_x[2*_dim+0]);
 
-    PylithScalar stressTensor[9] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
-    meanStress(_dim, _numS, numAMean, sOffDisp, sOffDisp_x, s, s_t, s_x, aOffMean, NULL, a, a_t, NULL,
-               t, x, numConstants, constants, stressTensor);
-    deviatoricStress(_dim, _numS, numADev, sOffDisp, sOffDisp_x, s, s_t, s_x, aOffDev, NULL, a, a_t, NULL,
-                     t, x, numConstants, constants, stressTensor);
-    for (PylithInt i = 0; i < _dim*_dim; ++i) {
-        f1[i] -= stressTensor[i];
-    } // for
+    f1[0*_dim+0] -= stress_xx;
+    f1[1*_dim+1] -= stress_yy;
+    f1[2*_dim+2] -= stress_zz;
+    f1[0*_dim+1] -= stress_xy;
+    f1[1*_dim+0] -= stress_xy;
+    f1[1*_dim+2] -= stress_yz;
+    f1[2*_dim+1] -= stress_yz;
+    f1[0*_dim+2] -= stress_xz;
+    f1[2*_dim+0] -= stress_xz;
 } // f1v
 
 
@@ -158,6 +158,7 @@ pylith::materials::Elasticity::createIntegrator(const pylith::topology::Field& s
     case DYNAMIC_IMEX:
         _useInertia = true;
         integrator->setLHSJacobianTriggers(pylith::feassemble::Integrator::NEW_JACOBIAN_TIME_STEP_CHANGE);
+        integrator->setLHSJacobianLinearInShift(true); // LHS Jacobian only has s_tshift * mass terms.
         break;
     default:
         PYLITH_COMPONENT_LOGICERROR("Unknown formulation for equations (" << _formulation << ").");
@@ -439,6 +440,9 @@ pylith::materials::Elasticity::_setKernelsLHSJacobian(pylith::feassemble::Integr
         const PetscPointJac Jf2uu = NULL;
         const PetscPointJac Jf3uu = _rheology->getKernelJacobianElasticConstants(coordsys);
         integrator->setLHSJacobianTriggers(_rheology->getLHSJacobianTriggers());
+        // Jacobian of rheologies that do not depend on the time step (linear elastic) has no s_tshift terms.
+        integrator->setLHSJacobianLinearInShift(!(_rheology->getLHSJacobianTriggers() &
+                                                  pylith::feassemble::Integrator::NEW_JACOBIAN_TIME_STEP_CHANGE));
 
         kernels.resize(1);
         kernels[0] = JacobianKernels("displacement", "displacement", Jf0uu, Jf1uu, Jf2uu, Jf3uu);
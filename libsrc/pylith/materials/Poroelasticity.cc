@@ -174,6 +174,8 @@ pylith::materials::Poroelasticity::createIntegrator(const pylith::topology::Fiel
     switch (_formulation) {
     case QUASISTATIC:
         _useInertia = false;
+        integrator->setLHSJacobianTriggers(pylith::feassemble::Integrator::NEW_JACOBIAN_TIME_STEP_CHANGE);
+        integrator->setLHSJacobianLinearInShift(true); // LHS Jacobian only has s_tshift * storage and trace strain terms.
         break;
     case DYNAMIC:
         _useInertia = true;
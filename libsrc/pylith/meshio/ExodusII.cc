@@ -368,6 +368,96 @@ pylith::meshio::ExodusII::getVar(int* values,
   PYLITH_METHOD_END;
 } // getVar
 
+// ----------------------------------------------------------------------
+// Get hyperslab of values for variable as an array of PylithScalars.
+void
+pylith::meshio::ExodusII::getVar(PylithScalar* values,
+				 const int* start,
+				 const int* count,
+				 int ndims,
+				 const char* name) const
+{ // getVar
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(values);
+
+  int vid = -1;
+  if (!hasVar(name, &vid)) {
+    std::ostringstream msg;
+    msg << "Missing real variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _checkHyperslab(vid, start, count, ndims, name);
+
+  size_t* startN = (ndims > 0) ? new size_t[ndims] : 0;
+  size_t* countN = (ndims > 0) ? new size_t[ndims] : 0;
+  for (int iDim=0; iDim < ndims; ++iDim) {
+    startN[iDim] = start[iDim];
+    countN[iDim] = count[iDim];
+  } // for
+
+  int err = NC_NOERR;
+  if (sizeof(PylithScalar) == sizeof(double)) {
+    err = nc_get_vara_double(_file, vid, startN, countN, values);
+  } else {
+    delete[] startN; startN = 0;
+    delete[] countN; countN = 0;
+    assert(0);
+    throw std::logic_error("Unknown size of PylithScalar in ExodusII::getVar().");
+  } // if/else
+  delete[] startN; startN = 0;
+  delete[] countN; countN = 0;
+  if (err != NC_NOERR) {
+    std::ostringstream msg;
+    msg << "Could not get hyperslab of values for variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // getVar
+
+// ----------------------------------------------------------------------
+// Get hyperslab of values for variable as an array of ints.
+void
+pylith::meshio::ExodusII::getVar(int* values,
+				 const int* start,
+				 const int* count,
+				 int ndims,
+				 const char* name) const
+{ // getVar
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(values);
+
+  int vid = -1;
+  if (!hasVar(name, &vid)) {
+    std::ostringstream msg;
+    msg << "Missing integer variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  _checkHyperslab(vid, start, count, ndims, name);
+
+  size_t* startN = (ndims > 0) ? new size_t[ndims] : 0;
+  size_t* countN = (ndims > 0) ? new size_t[ndims] : 0;
+  for (int iDim=0; iDim < ndims; ++iDim) {
+    startN[iDim] = start[iDim];
+    countN[iDim] = count[iDim];
+  } // for
+
+  const int err = nc_get_vara_int(_file, vid, startN, countN, values);
+  delete[] startN; startN = 0;
+  delete[] countN; countN = 0;
+  if (err != NC_NOERR) {
+    std::ostringstream msg;
+    msg << "Could not get hyperslab of values for variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // getVar
+
 // ----------------------------------------------------------------------
 // Get values for variable as an array of strings.
 void
@@ -450,4 +540,58 @@ pylith::meshio::ExodusII::getVar(string_vector* values,
 } // getVar
 
 
+// ----------------------------------------------------------------------
+// Check hyperslab against dimensions of variable.
+void
+pylith::meshio::ExodusII::_checkHyperslab(const int vid,
+					  const int* start,
+					  const int* count,
+					  int ndims,
+					  const char* name) const
+{ // _checkHyperslab
+  PYLITH_METHOD_BEGIN;
+
+  assert(_file);
+  assert(!ndims || (start && count));
+
+  int vndims = 0;
+  int err = nc_inq_varndims(_file, vid, &vndims);
+  if (ndims != vndims) {
+    std::ostringstream msg;
+    msg << "Expecting " << ndims << " dimensions for variable '" << name
+	<< "' but variable only has " << vndims << " dimensions.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  int* dimIds = (ndims > 0) ? new int[ndims] : 0;
+  err = nc_inq_vardimid(_file, vid, dimIds);
+  if (err != NC_NOERR) {
+    delete[] dimIds; dimIds = 0;
+    std::ostringstream msg;
+    msg << "Could not get dimensions for variable '" << name << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  for (int iDim=0; iDim < ndims; ++iDim) {
+    size_t dimSize = 0;
+    err = nc_inq_dimlen(_file, dimIds[iDim], &dimSize);
+    if (err != NC_NOERR) {
+      delete[] dimIds; dimIds = 0;
+      std::ostringstream msg;
+      msg << "Could not get dimension '" << iDim << "' for variable '" << name << "'.";
+      throw std::runtime_error(msg.str());
+    } // if
+    if ((start[iDim] < 0) || (count[iDim] < 0) || (size_t(start[iDim] + count[iDim]) > dimSize)) {
+      delete[] dimIds; dimIds = 0;
+      std::ostringstream msg;
+      msg << "Hyperslab [" << start[iDim] << ", " << start[iDim]+count[iDim] << ") in dimension " << iDim
+	  << " of variable '" << name << "' exceeds dimension size " << dimSize << ".";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // for
+  delete[] dimIds; dimIds = 0;
+
+  PYLITH_METHOD_END;
+} // _checkHyperslab
+
 // End of file 
@@ -96,4 +96,57 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 } // buildMesh
 
 
+// ----------------------------------------------------------------------
+// Set vertices and cells in mesh using slabs of cells and vertices on each process.
+void
+pylith::meshio::MeshBuilder::buildMeshParallel(topology::Mesh* mesh,
+                                               scalar_array* coordinates,
+                                               const int numVertices,
+                                               const int spaceDim,
+                                               const int_array& cells,
+                                               const int numCells,
+                                               const int numCorners,
+                                               const int meshDim,
+                                               PetscSF* vertexSF) { // buildMeshParallel
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(coordinates);
+    assert(vertexSF);
+    assert(cells.size() == size_t(numCells*numCorners));
+    assert(coordinates->size() == size_t(numVertices*spaceDim));
+    MPI_Comm comm = mesh->comm();
+    const PetscInt dim = meshDim;
+    PetscErrorCode err;
+
+    // Vertices not in any cell on any process are silently dropped by PETSc; we cannot check for them without
+    // gathering the cells, so we rely on the serial reader checks for mesh validity.
+
+    /* DMPlex */
+    PetscDM dmMesh = NULL;
+    PetscBool interpolate = PETSC_TRUE;
+
+    const PetscInt bound = numCells*numCorners;
+    for (PetscInt coff = 0; coff < bound; coff += numCorners) {
+        DMPolytopeType ct;
+
+        if (dim < 3) { continue;}
+        switch (numCorners) {
+        case 4: ct = DM_POLYTOPE_TETRAHEDRON;break;
+        case 6: ct = DM_POLYTOPE_TRI_PRISM;break;
+        case 8: ct = DM_POLYTOPE_HEXAHEDRON;break;
+        default: continue;
+        }
+        err = DMPlexInvertCell(ct, (int *) &cells[coff]);PYLITH_CHECK_ERROR(err);
+    }
+    const PetscInt* cellsPtr = numCells > 0 ? &cells[0] : NULL;
+    const PetscReal* coordsPtr = numVertices > 0 ? &(*coordinates)[0] : NULL;
+    err = DMPlexCreateFromCellListParallelPetsc(comm, dim, numCells, numVertices, PETSC_DECIDE, numCorners, interpolate,
+                                                cellsPtr, spaceDim, coordsPtr, vertexSF, NULL, &dmMesh);PYLITH_CHECK_ERROR(err);
+    mesh->dmMesh(dmMesh);
+
+    PYLITH_METHOD_END;
+} // buildMeshParallel
+
+
 // End of file
@@ -72,6 +72,35 @@ void buildMesh(topology::Mesh* mesh,
                const int numCorners,
                const int meshDim,
                const bool isParallel =false);
+
+/** Build mesh topology and set vertex coordinates from contiguous slabs of cells and vertices on each process.
+ *
+ * Each process provides a contiguous block of the global vertices (in order of process rank) and a block of cells
+ * with global (zero based) indices of the vertices. The resulting mesh is distributed but has no overlap; it is
+ * usually redistributed using a partitioner.
+ *
+ * @param mesh PyLith finite-element mesh.
+ * @param coordinates Array of coordinates of vertices in block owned by this process.
+ * @param numVertices Number of vertices in block owned by this process.
+ * @param spaceDim Dimension of vector space for vertex coordinates.
+ * @param cells Array of global indices of vertices in cells on this process (first index is 0).
+ * @param numCells Number of cells on this process.
+ * @param numCorners Number of vertices per cell.
+ * @param meshDim Dimension of cells in mesh.
+ * @param vertexSF Star forest from local vertices (leaves) to vertices in blocks (roots), caller is responsible
+ *   for destroying it.
+ */
+static
+void buildMeshParallel(topology::Mesh* mesh,
+                       scalar_array* coordinates,
+                       const int numVertices,
+                       const int spaceDim,
+                       const int_array& cells,
+                       const int numCells,
+                       const int numCorners,
+                       const int meshDim,
+                       PetscSF* vertexSF);
+
 }; // MeshBuilder
 
 #endif // pylith_meshio_meshbuilder_hh
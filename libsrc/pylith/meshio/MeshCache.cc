@@ -0,0 +1,269 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshCache.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <petscviewerhdf5.h> // USES PetscViewerHDF5
+
+#include <vector> // USES std::vector
+#include <string> // USES std::string
+#include <cstdio> // USES std::rename()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+const char* pylith::meshio::MeshCache::_partitionLabelName = "cache_partition";
+const char* pylith::meshio::MeshCache::_cellTypeLabelName = "cache_celltype";
+const char* pylith::meshio::MeshCache::_numProcessesAttribute = "num_processes";
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Write mesh to cache file.
+void
+pylith::meshio::MeshCache::write(const pylith::topology::Mesh& mesh,
+                                 const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(filename);
+
+    PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+    PetscErrorCode err = 0;
+    const int commRank = mesh.commRank();
+    int commSize = 1;
+    err = MPI_Comm_size(mesh.comm(), &commSize);PYLITH_CHECK_ERROR(err);
+
+    // Temporary labels with the owner of each cell and the tensor product cell types.
+    PetscDMLabel partitionLabel = NULL;
+    err = DMCreateLabel(dmMesh, _partitionLabelName);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dmMesh, _partitionLabelName, &partitionLabel);PYLITH_CHECK_ERROR(err);
+    pylith::topology::Stratum cellsStratum(dmMesh, pylith::topology::Stratum::HEIGHT, 0);
+    for (PetscInt c = cellsStratum.begin(); c < cellsStratum.end(); ++c) {
+        err = DMLabelSetValue(partitionLabel, c, commRank);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    PetscDMLabel cellTypeLabel = NULL;
+    err = DMCreateLabel(dmMesh, _cellTypeLabelName);PYLITH_CHECK_ERROR(err);
+    err = DMGetLabel(dmMesh, _cellTypeLabelName, &cellTypeLabel);PYLITH_CHECK_ERROR(err);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        DMPolytopeType ct;
+        err = DMPlexGetCellType(dmMesh, p, &ct);PYLITH_CHECK_ERROR(err);
+        switch (ct) {
+        case DM_POLYTOPE_POINT_PRISM_TENSOR:
+        case DM_POLYTOPE_SEG_PRISM_TENSOR:
+        case DM_POLYTOPE_TRI_PRISM_TENSOR:
+        case DM_POLYTOPE_QUAD_PRISM_TENSOR:
+            err = DMLabelSetValue(cellTypeLabel, p, ct);PYLITH_CHECK_ERROR(err);
+            break;
+        default:
+            break;
+        } // switch
+    } // for
+
+    // Write to a temporary file, so an interrupted run does not leave a corrupt cache file.
+    const std::string tmpFilename = std::string(filename) + ".tmp";
+    PetscViewer viewer = NULL;
+    const PetscInt numProcesses = commSize;
+    err = PetscViewerHDF5Open(mesh.comm(), tmpFilename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMView(dmMesh, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5WriteAttribute(viewer, "/", _numProcessesAttribute, PETSC_INT, &numProcesses);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    _removeLabel(dmMesh, _partitionLabelName);
+    _removeLabel(dmMesh, _cellTypeLabelName);
+
+    int renameErr = 0;
+    if (!commRank) {
+        renameErr = std::rename(tmpFilename.c_str(), filename);
+    } // if
+    err = MPI_Bcast(&renameErr, 1, MPI_INT, 0, mesh.comm());PYLITH_CHECK_ERROR(err);
+    if (renameErr) {
+        std::ostringstream msg;
+        msg << "Could not rename temporary mesh cache file '" << tmpFilename << "' to '" << filename << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // write
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh from cache file.
+bool
+pylith::meshio::MeshCache::read(pylith::topology::Mesh* mesh,
+                                const char* filename) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    assert(filename);
+
+    PetscErrorCode err = 0;
+    int commSize = 1;
+    err = MPI_Comm_size(mesh->comm(), &commSize);PYLITH_CHECK_ERROR(err);
+
+    // Name of DM must match name of DM when it was written.
+    PetscDM dmMesh = NULL;
+    err = DMCreate(mesh->comm(), &dmMesh);PYLITH_CHECK_ERROR(err);
+    err = DMSetType(dmMesh, DMPLEX);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject) dmMesh, "domain");PYLITH_CHECK_ERROR(err);
+
+    PetscViewer viewer = NULL;
+    const PetscInt numProcessesDefault = 0;
+    PetscInt numProcesses = 0;
+    err = PetscViewerHDF5Open(mesh->comm(), filename, FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);PYLITH_CHECK_ERROR(err);
+    err = DMLoad(dmMesh, viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerPopFormat(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerHDF5ReadAttribute(viewer, "/", _numProcessesAttribute, PETSC_INT, &numProcessesDefault,
+                                       &numProcesses);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    _restoreCellTypes(dmMesh);
+
+    const bool isDistributed = (1 == commSize) || (numProcesses == commSize);
+    if (isDistributed && (commSize > 1)) {
+        _restoreDistribution(&dmMesh);
+    } // if
+    _removeLabel(dmMesh, _partitionLabelName);
+    _removeLabel(dmMesh, _cellTypeLabelName);
+
+    mesh->dmMesh(dmMesh);
+
+    PYLITH_METHOD_RETURN(isDistributed);
+} // read
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Distribute loaded mesh using owner of each cell when cache was written.
+void
+pylith::meshio::MeshCache::_restoreDistribution(PetscDM* dmMesh) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(dmMesh);
+    assert(*dmMesh);
+
+    PetscErrorCode err = 0;
+    PetscMPIInt commSize = 1;
+    err = MPI_Comm_size(PetscObjectComm((PetscObject)*dmMesh), &commSize);PYLITH_CHECK_ERROR(err);
+
+    PetscDMLabel partitionLabel = NULL;
+    err = DMGetLabel(*dmMesh, _partitionLabelName, &partitionLabel);PYLITH_CHECK_ERROR(err);
+    if (!partitionLabel) {
+        throw std::runtime_error("Could not find owner of cells in mesh cache file.");
+    } // if
+
+    // Shell partitioner sends the loaded cells to the processes that owned them when the cache was written.
+    pylith::topology::Stratum cellsStratum(*dmMesh, pylith::topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    std::vector<PetscInt> cellRanks(cEnd-cStart);
+    std::vector<PetscInt> partitionSizes(commSize, 0);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscInt rank = -1;
+        err = DMLabelGetValue(partitionLabel, c, &rank);PYLITH_CHECK_ERROR(err);
+        if ((rank < 0) || (rank >= commSize)) {
+            std::ostringstream msg;
+            msg << "Invalid owner (" << rank << ") of cell " << c << " in mesh cache file.";
+            throw std::runtime_error(msg.str());
+        } // if
+        cellRanks[c-cStart] = rank;
+        ++partitionSizes[rank];
+    } // for
+    std::vector<PetscInt> partitionOffsets(commSize, 0);
+    for (PetscMPIInt rank = 1; rank < commSize; ++rank) {
+        partitionOffsets[rank] = partitionOffsets[rank-1] + partitionSizes[rank-1];
+    } // for
+    std::vector<PetscInt> partitionPoints(cEnd-cStart);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        partitionPoints[partitionOffsets[cellRanks[c-cStart]]++] = c - cStart;
+    } // for
+
+    PetscPartitioner partitioner = NULL;
+    err = DMPlexGetPartitioner(*dmMesh, &partitioner);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerSetType(partitioner, PETSCPARTITIONERSHELL);PYLITH_CHECK_ERROR(err);
+    err = PetscPartitionerShellSetPartition(partitioner, commSize, &partitionSizes[0],
+                                            partitionPoints.size() > 0 ? &partitionPoints[0] : NULL);PYLITH_CHECK_ERROR(err);
+
+    PetscDM dmDist = NULL;
+    err = DMPlexDistribute(*dmMesh, 0, NULL, &dmDist);PYLITH_CHECK_ERROR(err);
+    if (dmDist) {
+        err = DMDestroy(dmMesh);PYLITH_CHECK_ERROR(err);
+        *dmMesh = dmDist;
+    } // if
+
+    PYLITH_METHOD_END;
+} // _restoreDistribution
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Restore cell types of points with tensor product cell types.
+void
+pylith::meshio::MeshCache::_restoreCellTypes(PetscDM dmMesh) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(dmMesh);
+
+    PetscErrorCode err = 0;
+    PetscDMLabel cellTypeLabel = NULL;
+    err = DMGetLabel(dmMesh, _cellTypeLabelName, &cellTypeLabel);PYLITH_CHECK_ERROR(err);
+    if (!cellTypeLabel) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        PetscInt cellType = -1;
+        err = DMLabelGetValue(cellTypeLabel, p, &cellType);PYLITH_CHECK_ERROR(err);
+        if (cellType >= 0) {
+            err = DMPlexSetCellType(dmMesh, p, DMPolytopeType(cellType));PYLITH_CHECK_ERROR(err);
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // _restoreCellTypes
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Remove label from mesh.
+void
+pylith::meshio::MeshCache::_removeLabel(PetscDM dmMesh,
+                                        const char* name) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(dmMesh);
+
+    PetscErrorCode err = 0;
+    PetscDMLabel label = NULL;
+    err = DMRemoveLabel(dmMesh, name, &label);PYLITH_CHECK_ERROR(err);
+    err = DMLabelDestroy(&label);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _removeLabel
+
+
+// End of file
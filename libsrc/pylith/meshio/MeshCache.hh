@@ -0,0 +1,106 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshCache.hh
+ *
+ * @brief Write and read a fully prepared (reordered, with cohesive cells, distributed, and refined) mesh using
+ * PETSc DMPlex HDF5 I/O.
+ *
+ * The cache stores the topology, coordinates, and labels of the mesh along with the process that owns each cell. PETSc
+ * DMPlex HDF5 I/O loads the mesh in slabs, so the owner of each cell is used to restore the original distribution
+ * when the cache is read with the same number of processes.
+ */
+
+#if !defined(pylith_meshio_meshcache_hh)
+#define pylith_meshio_meshcache_hh
+
+#include "meshiofwd.hh" // forward declarations
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
+class pylith::meshio::MeshCache {
+    friend class TestMeshCache; // unit testing
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Write mesh to cache file.
+     *
+     * @param[in] mesh Finite-element mesh (dimensioned coordinates).
+     * @param[in] filename Name of cache file.
+     */
+    static
+    void write(const pylith::topology::Mesh& mesh,
+               const char* filename);
+
+    /** Read mesh from cache file.
+     *
+     * If the cache was written with the same number of processes, the mesh is distributed as it was when it was
+     * written. Otherwise the mesh is left in the slabs in which it was loaded and must be redistributed.
+     *
+     * @param[out] mesh Finite-element mesh.
+     * @param[in] filename Name of cache file.
+     * @returns True if the mesh is distributed (or there is only one process), false if it must be redistributed.
+     */
+    static
+    bool read(pylith::topology::Mesh* mesh,
+              const char* filename);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Distribute loaded mesh using owner of each cell when cache was written.
+     *
+     * @param[inout] dmMesh PETSc DM for loaded mesh, replaced by distributed DM.
+     */
+    static
+    void _restoreDistribution(PetscDM* dmMesh);
+
+    /** Restore cell types of points with tensor product cell types (cohesive cells and their faces).
+     *
+     * The cell types of cohesive cells cannot be inferred from the topology when the mesh is loaded.
+     *
+     * @param[inout] dmMesh PETSc DM for loaded mesh.
+     */
+    static
+    void _restoreCellTypes(PetscDM dmMesh);
+
+    /** Remove label from mesh.
+     *
+     * @param[inout] dmMesh PETSc DM for mesh.
+     * @param[in] name Name of label.
+     */
+    static
+    void _removeLabel(PetscDM dmMesh,
+                      const char* name);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    static const char* _partitionLabelName; ///< Name of label with owner of each cell.
+    static const char* _cellTypeLabelName; ///< Name of label with tensor product cell types.
+    static const char* _numProcessesAttribute; ///< Name of attribute with number of processes.
+
+}; // MeshCache
+
+#endif // pylith_meshio_meshcache_hh
+
+// End of file
@@ -29,6 +29,7 @@
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_INFO
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
+#include <algorithm> // USES std::sort(), std::binary_search(), std::min()
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
 #include <stdexcept>
@@ -37,7 +38,10 @@
 // Constructor
 pylith::meshio::MeshIO::MeshIO(void) :
     _mesh(0),
-    _debug(false) { // constructor
+    _debug(false),
+    _parallelRead(false),
+    _vertexSF(NULL),
+    _cellOffset(0) { // constructor
 } // constructor
 
 
@@ -52,6 +56,11 @@ pylith::meshio::MeshIO::~MeshIO(void) { // destructor
 // Deallocate PETSc and local data structures.
 void
 pylith::meshio::MeshIO::deallocate(void) { // deallocate
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = PetscSFDestroy(&_vertexSF);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
 } // deallocate
 
 
@@ -74,7 +83,11 @@ pylith::meshio::MeshIO::read(topology::Mesh* mesh) {
 
     _mesh = mesh;
     _mesh->debug(_debug);
-    _read();
+    if (_parallelRead) {
+        _readParallel();
+    } else {
+        _read();
+    } // if/else
 
     PetscErrorCode err = 0;
 
@@ -108,6 +121,8 @@ pylith::meshio::MeshIO::read(topology::Mesh* mesh) {
     // Respond to PETSc diagnostic output
     err = DMViewFromOptions(_mesh->dmMesh(), NULL, "-pylith_dm_view");PYLITH_CHECK_ERROR(err);
 
+    err = PetscSFDestroy(&_vertexSF);PYLITH_CHECK_ERROR(err);
+    _cellOffset = 0;
     _mesh = NULL;
 
     PYLITH_METHOD_END;
@@ -131,6 +146,45 @@ pylith::meshio::MeshIO::write(topology::Mesh* const mesh) { // write
 } // write
 
 
+// ----------------------------------------------------------------------
+// Read mesh with each process reading a slab of cells and vertices.
+void
+pylith::meshio::MeshIO::_readParallel(void) { // _readParallel
+    PYLITH_METHOD_BEGIN;
+
+    PYLITH_COMPONENT_WARNING("Mesh reader does not support reading the mesh in parallel. Reading mesh on process 0.");
+    _read();
+
+    PYLITH_METHOD_END;
+} // _readParallel
+
+
+// ----------------------------------------------------------------------
+// Get contiguous slab of entities read by this process.
+void
+pylith::meshio::MeshIO::_getSlab(const int numGlobal,
+                                 int* offset,
+                                 int* size) const { // _getSlab
+    PYLITH_METHOD_BEGIN;
+
+    assert(offset);
+    assert(size);
+    assert(_mesh);
+
+    int commSize = 1;
+    PetscErrorCode err = MPI_Comm_size(_mesh->comm(), &commSize);PYLITH_CHECK_ERROR(err);
+    const int commRank = _mesh->commRank();
+
+    // Distribute remainder over the first processes, consistent with PetscLayout.
+    const int base = numGlobal / commSize;
+    const int remainder = numGlobal % commSize;
+    *offset = commRank*base + std::min(commRank, remainder);
+    *size = base + ((commRank < remainder) ? 1 : 0);
+
+    PYLITH_METHOD_END;
+} // _getSlab
+
+
 // ----------------------------------------------------------------------
 // Get coordinates of vertices in mesh.
 void
@@ -240,7 +294,8 @@ pylith::meshio::MeshIO::_setMaterials(const int_array& materialIds) { // _setMat
 
     assert(_mesh);
 
-    if (!_mesh->commRank()) {
+    // Mesh built from slabs has cells on all processes; otherwise only process 0 has cells.
+    if (!_mesh->commRank() || _vertexSF) {
         PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
         topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
         const PetscInt cStart = cellsStratum.begin();
@@ -301,7 +356,12 @@ pylith::meshio::MeshIO::_setGroup(const std::string& name,
     assert(_mesh);
 
     PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
-    const PetscInt numPoints = points.size();
+    int_array localPoints;
+    if (_vertexSF) {
+        _getLocalPoints(&localPoints, type, points);
+    } // if
+    const int_array& groupPoints = (_vertexSF) ? localPoints : points;
+    const PetscInt numPoints = groupPoints.size();
     DMLabel label;
     PetscErrorCode err;
 
@@ -309,7 +369,7 @@ pylith::meshio::MeshIO::_setGroup(const std::string& name,
     err = DMGetLabel(dmMesh, name.c_str(), &label);PYLITH_CHECK_ERROR(err);
     if (CELL == type) {
         for (PetscInt p = 0; p < numPoints; ++p) {
-            err = DMLabelSetValue(label, points[p], 1);PYLITH_CHECK_ERROR(err);
+            err = DMLabelSetValue(label, groupPoints[p], 1);PYLITH_CHECK_ERROR(err);
         } // for
     } else if (VERTEX == type) {
         PetscInt cStart, cEnd, vStart, vEnd, numCells;
@@ -318,11 +378,11 @@ pylith::meshio::MeshIO::_setGroup(const std::string& name,
         err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
         numCells = cEnd - cStart;
         for (PetscInt p = 0; p < numPoints; ++p) {
-            err = DMLabelSetValue(label, numCells+points[p], 1);PYLITH_CHECK_ERROR(err);
+            err = DMLabelSetValue(label, numCells+groupPoints[p], 1);PYLITH_CHECK_ERROR(err);
         } // for
           // Also add any non-cells which have all vertices marked
         for (PetscInt p = 0; p < numPoints; ++p) {
-            const PetscInt vertex = numCells+points[p];
+            const PetscInt vertex = numCells+groupPoints[p];
             PetscInt      *star = NULL, starSize, s;
 
             err = DMPlexGetTransitiveClosure(dmMesh, vertex, PETSC_FALSE, &starSize, &star);PYLITH_CHECK_ERROR(err);
@@ -350,6 +410,72 @@ pylith::meshio::MeshIO::_setGroup(const std::string& name,
 } // _setGroup
 
 
+// ----------------------------------------------------------------------
+// Get local points for group with points given by global indices in file.
+void
+pylith::meshio::MeshIO::_getLocalPoints(int_array* localPoints,
+                                        const GroupPtType type,
+                                        const int_array& points) const { // _getLocalPoints
+    PYLITH_METHOD_BEGIN;
+
+    assert(localPoints);
+    assert(_mesh);
+    assert(_vertexSF);
+
+    PetscDM dmMesh = _mesh->dmMesh();assert(dmMesh);
+    PetscInt cStart, cEnd;
+    PetscErrorCode err;
+    err = DMPlexGetHeightStratum(dmMesh, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+    const PetscInt numCells = cEnd - cStart;
+
+    int_vector local;
+    if (CELL == type) {
+        for (size_t p = 0; p < points.size(); ++p) {
+            const PetscInt cell = points[p] - _cellOffset;
+            if ((cell >= 0) && (cell < numCells)) {
+                local.push_back(cell);
+            } // if
+        } // for
+    } else if (VERTEX == type) {
+        // Get global index of each local vertex by broadcasting indices of vertices in slabs to the local vertices.
+        PetscInt numRoots = 0, numLeaves = 0, minLeaf = 0, maxLeaf = -1;
+        err = PetscSFGetGraph(_vertexSF, &numRoots, &numLeaves, NULL, NULL);PYLITH_CHECK_ERROR(err);
+        err = PetscSFGetLeafRange(_vertexSF, &minLeaf, &maxLeaf);PYLITH_CHECK_ERROR(err);
+        PetscInt rootOffset = 0;
+        err = MPI_Scan(&numRoots, &rootOffset, 1, MPIU_INT, MPI_SUM, _mesh->comm());PYLITH_CHECK_ERROR(err);
+        rootOffset -= numRoots;
+
+        std::vector<PetscInt> rootIndices(numRoots);
+        for (PetscInt i = 0; i < numRoots; ++i) {
+            rootIndices[i] = rootOffset + i;
+        } // for
+        std::vector<PetscInt> leafIndices(maxLeaf+1, -1);
+        const PetscInt* rootData = (numRoots > 0) ? &rootIndices[0] : NULL;
+        PetscInt* leafData = (maxLeaf >= 0) ? &leafIndices[0] : NULL;
+        err = PetscSFBcastBegin(_vertexSF, MPIU_INT, rootData, leafData, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastEnd(_vertexSF, MPIU_INT, rootData, leafData, MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+
+        int_vector sorted(points.size());
+        for (size_t i = 0; i < points.size(); ++i) {
+            sorted[i] = points[i];
+        } // for
+        std::sort(sorted.begin(), sorted.end());
+        for (PetscInt v = 0; v <= maxLeaf; ++v) {
+            if ((leafIndices[v] >= 0) && std::binary_search(sorted.begin(), sorted.end(), int(leafIndices[v]))) {
+                local.push_back(v);
+            } // if
+        } // for
+    } // if/else
+
+    localPoints->resize(local.size());
+    for (size_t i = 0; i < local.size(); ++i) {
+        (*localPoints)[i] = local[i];
+    } // for
+
+    PYLITH_METHOD_END;
+} // _getLocalPoints
+
+
 // ----------------------------------------------------------------------
 // Create empty groups on other processes
 void
@@ -33,6 +33,7 @@
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
 #include "pylith/utils/arrayfwd.hh" // USES scalar_array, int_array, string_vector
+#include "pylith/utils/petscfwd.h" // HASA PetscSF
 
 // MeshIO ---------------------------------------------------------------
 /// C++ abstract base class for managing mesh input/output.
@@ -71,6 +72,21 @@ public:
      */
     bool debug(void) const;
 
+    /** Set flag for reading mesh in parallel.
+     *
+     * When reading in parallel, each process reads a contiguous slab of cells and vertices, and the mesh is built
+     * in parallel instead of building the entire mesh on process 0.
+     *
+     * @param value True if each process reads a slab of the mesh, false if process 0 reads the entire mesh.
+     */
+    void setParallelRead(const bool value);
+
+    /** Get flag for reading mesh in parallel.
+     *
+     * @returns True if each process reads a slab of the mesh, false if process 0 reads the entire mesh.
+     */
+    bool getParallelRead(void) const;
+
     /** Read mesh from file.
      *
      * @param mesh PyLith finite-element mesh.
@@ -94,6 +110,23 @@ protected:
     virtual
     void _read(void) = 0;
 
+    /** Read mesh with each process reading a contiguous slab of cells and vertices.
+     *
+     * Default implementation reads the mesh on process 0.
+     */
+    virtual
+    void _readParallel(void);
+
+    /** Get contiguous slab of entities read by this process.
+     *
+     * @param[in] numGlobal Number of entities in file.
+     * @param[out] offset Index of first entity in slab.
+     * @param[out] size Number of entities in slab.
+     */
+    void _getSlab(const int numGlobal,
+                  int* offset,
+                  int* size) const;
+
     /** Get spatial dimension of mesh.
      *
      * @returns Spatial dimension of mesh
@@ -131,6 +164,8 @@ protected:
                    int* meshDim) const;
 
     /** Tag cells in mesh with material identifiers.
+     *
+     * If the mesh was built from slabs, materialIds contains the identifiers of the local cells on each process.
      *
      * @param materialIds Material identifiers [numCells]
      */
@@ -147,6 +182,9 @@ protected:
      * The indices in the points array must use zero based indices. In
      * other words, the lowest index MUST be 0 not 1.
      *
+     * If the mesh was built from slabs, the points are the global indices of the vertices or cells in the file and
+     * each process marks the points it holds.
+     *
      * @param name The group name
      * @param type The point type, e.g. VERTEX, CELL
      * @param points An array of the points in the group.
@@ -178,12 +216,31 @@ protected:
     /// Create empty groups on other processes
     void _distributeGroups();
 
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /** Get local points for group with points given by global indices in file.
+     *
+     * Only used when the mesh is built from slabs.
+     *
+     * @param[out] localPoints Local indices of vertices or cells in group.
+     * @param[in] type The point type, e.g. VERTEX, CELL
+     * @param[in] points Global indices of vertices or cells in group.
+     */
+    void _getLocalPoints(int_array* localPoints,
+                         const GroupPtType type,
+                         const int_array& points) const;
+
     // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected:
 
     topology::Mesh* _mesh; ///< Pointer to finite-element mesh.
 
     bool _debug; ///< True to turn of mesh debugging output.
+    bool _parallelRead; ///< True if each process reads a slab of the mesh.
+
+    PetscSF _vertexSF; ///< Map from local vertices to vertex slabs (only when mesh is built from slabs).
+    int _cellOffset; ///< Global index of first local cell (only when mesh is built from slabs).
 
 }; // MeshIO
 
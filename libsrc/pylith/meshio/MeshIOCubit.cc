@@ -28,6 +28,7 @@
 
 #include "petsc.h" // USES MPI_Comm
 
+#include <algorithm> // USES std::min(), std::max()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
@@ -116,6 +117,51 @@ pylith::meshio::MeshIOCubit::_read(void) {
 } // read
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read mesh with each process reading a contiguous slab of cells and vertices.
+void
+pylith::meshio::MeshIOCubit::_readParallel(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readParallel()");
+
+    assert(_mesh);
+
+    int spaceDim = 0;
+    int numVertices = 0;
+    int numCells = 0;
+    int numCorners = 0;
+    scalar_array coordinates;
+    int_array cells;
+    int_array materialIds;
+
+    try {
+        ExodusII exofile(_filename.c_str());
+
+        const int meshDim = exofile.getDim("num_dim");
+
+        _readVerticesSlab(exofile, &coordinates, &numVertices, &spaceDim);
+        _readCellsSlab(exofile, &cells, &materialIds, &_cellOffset, &numCells, &numCorners);
+        _orientCells(&cells, numCells, numCorners, meshDim);
+        MeshBuilder::buildMeshParallel(_mesh, &coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim,
+                                       &_vertexSF);
+        _setMaterials(materialIds);
+
+        _readGroups(exofile);
+    } catch (std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while reading Cubit Exodus file '" << _filename << "' in parallel.\n"
+            << err.what();
+        throw std::runtime_error(msg.str());
+    } catch (...) {
+        std::ostringstream msg;
+        msg << "Unknown error while reading Cubit Exodus file '" << _filename << "' in parallel.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // _readParallel
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Write mesh to file.
 void
@@ -266,6 +312,168 @@ pylith::meshio::MeshIOCubit::_readCells(ExodusII& exofile,
 } // _readCells
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Read slab of mesh vertices for this process.
+void
+pylith::meshio::MeshIOCubit::_readVerticesSlab(ExodusII& exofile,
+                                               scalar_array* coordinates,
+                                               int* numVertices,
+                                               int* numDims) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readVerticesSlab(exofile="<<typeid(exofile).name()<<", coordinates="<<coordinates<<", numVertices="<<numVertices<<", numDims="<<numDims<<")");
+
+    assert(coordinates);
+    assert(numVertices);
+    assert(numDims);
+    assert(_mesh);
+
+    *numDims = exofile.getDim("num_dim");
+
+    const int numVerticesGlobal = exofile.getDim("num_nodes");
+    int vertexOffset = 0;
+    _getSlab(numVerticesGlobal, &vertexOffset, numVertices);
+
+    if (0 == _mesh->commRank()) {
+        PYLITH_COMPONENT_INFO("Reading " << numVerticesGlobal << " vertices in slabs of about " << *numVertices << " vertices.");
+    } // if
+
+    coordinates->resize(*numVertices * *numDims);
+    if (0 == *numVertices) {
+        PYLITH_METHOD_END;
+    } // if
+
+    if (exofile.hasVar("coord", NULL)) {
+        const int ndims = 2;
+        int start[2];
+        int count[2];
+        start[0] = 0;
+        start[1] = vertexOffset;
+        count[0] = *numDims;
+        count[1] = *numVertices;
+        scalar_array buffer(*numVertices * *numDims);
+        exofile.getVar(&buffer[0], start, count, ndims, "coord");
+
+        for (int iVertex = 0; iVertex < *numVertices; ++iVertex) {
+            for (int iDim = 0; iDim < *numDims; ++iDim) {
+                (*coordinates)[iVertex*(*numDims)+iDim] =
+                    buffer[iDim*(*numVertices)+iVertex];
+            }
+        }
+
+    } else {
+        const char* coordNames[3] = { "coordx", "coordy", "coordz" };
+
+        scalar_array buffer(*numVertices);
+
+        const int ndims = 1;
+        int start[1];
+        int count[1];
+        start[0] = vertexOffset;
+        count[0] = *numVertices;
+
+        for (int i = 0; i < *numDims; ++i) {
+            exofile.getVar(&buffer[0], start, count, ndims, coordNames[i]);
+
+            for (int iVertex = 0; iVertex < *numVertices; ++iVertex) {
+                (*coordinates)[iVertex*(*numDims)+i] = buffer[iVertex];
+            }
+        } // for
+    } // else
+
+    PYLITH_METHOD_END;
+} // _readVerticesSlab
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Read slab of mesh cells for this process.
+void
+pylith::meshio::MeshIOCubit::_readCellsSlab(ExodusII& exofile,
+                                            int_array* cells,
+                                            int_array* materialIds,
+                                            int* cellOffset,
+                                            int* numCells,
+                                            int* numCorners) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readCellsSlab(exofile="<<typeid(exofile).name()<<", cells="<<cells<<", materialIds="<<materialIds<<", cellOffset="<<cellOffset<<", numCells="<<numCells<<", numCorners="<<numCorners<<")");
+
+    assert(cells);
+    assert(materialIds);
+    assert(cellOffset);
+    assert(numCells);
+    assert(numCorners);
+    assert(_mesh);
+
+    const int numCellsGlobal = exofile.getDim("num_elem");
+    const int numMaterials = exofile.getDim("num_el_blk");
+    _getSlab(numCellsGlobal, cellOffset, numCells);
+
+    if (0 == _mesh->commRank()) {
+        PYLITH_COMPONENT_INFO("Reading " << numCellsGlobal << " cells in " << numMaterials << " blocks in slabs of about "
+                                         << *numCells << " cells.");
+    } // if
+
+    int_array blockIds(numMaterials);
+    int ndims = 1;
+    int dims[2];
+    dims[0] = numMaterials;
+    dims[1] = 0;
+    exofile.getVar(&blockIds[0], dims, ndims, "eb_prop1");
+
+    materialIds->resize(*numCells);
+    *numCorners = 0;
+    const int slabBegin = *cellOffset;
+    const int slabEnd = *cellOffset + *numCells;
+    for (int iMaterial = 0, blockBegin = 0; iMaterial < numMaterials; ++iMaterial) {
+        std::ostringstream varname;
+        varname << "num_nod_per_el" << iMaterial+1;
+        if (0 == *numCorners) {
+            *numCorners = exofile.getDim(varname.str().c_str());
+            cells->resize((*numCells) * (*numCorners));
+        } else if (exofile.getDim(varname.str().c_str()) != *numCorners) {
+            std::ostringstream msg;
+            msg << "All materials must have the same number of vertices per cell.\n"
+                << "Expected " << *numCorners << " vertices per cell, but block "
+                << blockIds[iMaterial] << " has "
+                << exofile.getDim(varname.str().c_str())
+                << " vertices.";
+            throw std::runtime_error(msg.str());
+        } // if
+
+        varname.str("");
+        varname << "num_el_in_blk" << iMaterial+1;
+        const int blockSize = exofile.getDim(varname.str().c_str());
+        const int blockEnd = blockBegin + blockSize;
+
+        // Read portion of block that overlaps the slab.
+        const int readBegin = std::max(blockBegin, slabBegin);
+        const int readEnd = std::min(blockEnd, slabEnd);
+        if (readBegin < readEnd) {
+            varname.str("");
+            varname << "connect" << iMaterial+1;
+            ndims = 2;
+            int start[2];
+            int count[2];
+            start[0] = readBegin - blockBegin;
+            start[1] = 0;
+            count[0] = readEnd - readBegin;
+            count[1] = *numCorners;
+            exofile.getVar(&(*cells)[(readBegin-slabBegin) * (*numCorners)], start, count, ndims,
+                           varname.str().c_str());
+
+            for (int i = readBegin; i < readEnd; ++i) {
+                (*materialIds)[i-slabBegin] = blockIds[iMaterial];
+            } // for
+        } // if
+
+        blockBegin = blockEnd;
+    } // for
+
+    *cells -= 1; // use zero index
+
+    PYLITH_METHOD_END;
+} // _readCellsSlab
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Read mesh groups.
 void
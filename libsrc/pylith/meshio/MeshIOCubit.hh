@@ -71,6 +71,9 @@ protected:
     /// Read mesh
     void _read(void);
 
+    /// Read mesh with each process reading a contiguous slab of cells and vertices.
+    void _readParallel(void);
+
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -100,6 +103,36 @@ private:
                     int* numCells,
                     int* numCorners) const;
 
+    /** Read slab of mesh vertices for this process.
+     *
+     * @param ncfile Cubit Exodus file.
+     * @param coordinates Pointer to array of vertex coordinates in slab.
+     * @param numVertices Pointer to number of vertices in slab.
+     * @param spaceDim Pointer to dimension of coordinates vector space.
+     */
+    void _readVerticesSlab(ExodusII& filein,
+                           scalar_array* coordinates,
+                           int* numVertices,
+                           int* spaceDim) const;
+
+    /** Read slab of mesh cells for this process.
+     *
+     * The slab may span several blocks.
+     *
+     * @param ncfile Cubit Exodus file.
+     * @param pCells Pointer to array of global indices of cell vertices
+     * @param pMaterialIds Pointer to array of material identifiers
+     * @param pCellOffset Pointer to global index of first cell in slab.
+     * @param pNumCells Pointer to number of cells in slab.
+     * @param pNumCorners Pointer to number of corners
+     */
+    void _readCellsSlab(ExodusII& filein,
+                        int_array* pCells,
+                        int_array* pMaterialIds,
+                        int* cellOffset,
+                        int* numCells,
+                        int* numCorners) const;
+
     /** Read point groups.
      *
      * @param ncfile Cubit Exodus file.
@@ -182,4 +182,36 @@ pylith::meshio::OutputObserver::_appendField(const PylithReal t,
 } // _appendField
 
 
+// ------------------------------------------------------------------------------------------------
+// Get state of output trigger for checkpointing.
+void
+pylith::meshio::OutputObserver::_getTriggerState(std::map<std::string, PylithReal>* states,
+                                                 const std::string& prefix) const {
+    assert(states);
+    assert(_trigger);
+
+    (*states)[prefix + getIdentifier()] = _trigger->getState();
+} // _getTriggerState
+
+
+// ------------------------------------------------------------------------------------------------
+// Set state of output trigger when restarting from a checkpoint.
+void
+pylith::meshio::OutputObserver::_setTriggerState(const std::map<std::string, PylithReal>& states,
+                                                 const std::string& prefix) {
+    PYLITH_METHOD_BEGIN;
+    assert(_trigger);
+
+    const std::map<std::string, PylithReal>::const_iterator iter = states.find(prefix + getIdentifier());
+    if (iter == states.end()) {
+        PYLITH_COMPONENT_WARNING("Checkpoint does not contain state of output trigger for '" << prefix + getIdentifier()
+                                                                                              << "'. Using initial state.");
+        PYLITH_METHOD_END;
+    } // if
+    _trigger->setState(iter->second);
+
+    PYLITH_METHOD_END;
+} // _setTriggerState
+
+
 // End of file
@@ -108,6 +108,22 @@ protected:
     void _appendField(const PylithReal t,
                       const pylith::meshio::OutputSubfield& subfield);
 
+    /** Get state of output trigger for checkpointing.
+     *
+     * @param[inout] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void _getTriggerState(std::map<std::string, PylithReal>* states,
+                          const std::string& prefix) const;
+
+    /** Set state of output trigger when restarting from a checkpoint.
+     *
+     * @param[in] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void _setTriggerState(const std::map<std::string, PylithReal>& states,
+                          const std::string& prefix);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
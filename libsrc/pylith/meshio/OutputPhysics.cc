@@ -197,6 +197,34 @@ pylith::meshio::OutputPhysics::update(const PylithReal t,
 } // update
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether observer will write output at time t when it receives the next update.
+bool
+pylith::meshio::OutputPhysics::willWrite(const PylithReal t,
+                                         const PylithInt tindex) const {
+    assert(_trigger);
+    return _trigger->willWrite(t, tindex);
+} // willWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Get state of observer for checkpointing.
+void
+pylith::meshio::OutputPhysics::getCheckpointState(std::map<std::string, PylithReal>* states,
+                                                  const std::string& prefix) const {
+    _getTriggerState(states, prefix);
+} // getCheckpointState
+
+
+// ------------------------------------------------------------------------------------------------
+// Set state of observer when restarting from a checkpoint.
+void
+pylith::meshio::OutputPhysics::setCheckpointState(const std::map<std::string, PylithReal>& states,
+                                                  const std::string& prefix) {
+    _setTriggerState(states, prefix);
+} // setCheckpointState
+
+
 // ------------------------------------------------------------------------------------------------
 // Write output for step in solution.
 void
@@ -103,6 +103,31 @@ public:
                 const pylith::topology::Field& solution,
                 const bool infoOnly);
 
+    /** Check whether observer will write output at time t when it receives the next update.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if observer will write output at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const;
+
+    /** Get state of observer for checkpointing.
+     *
+     * @param[inout] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void getCheckpointState(std::map<std::string, PylithReal>* states,
+                            const std::string& prefix) const;
+
+    /** Set state of observer when restarting from a checkpoint.
+     *
+     * @param[in] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void setCheckpointState(const std::map<std::string, PylithReal>& states,
+                            const std::string& prefix);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
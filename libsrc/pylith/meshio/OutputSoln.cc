@@ -131,6 +131,24 @@ pylith::meshio::OutputSoln::update(const PylithReal t,
 } // update
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get state of observer for checkpointing.
+void
+pylith::meshio::OutputSoln::getCheckpointState(std::map<std::string, PylithReal>* states,
+                                               const std::string& prefix) const {
+    _getTriggerState(states, prefix);
+} // getCheckpointState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set state of observer when restarting from a checkpoint.
+void
+pylith::meshio::OutputSoln::setCheckpointState(const std::map<std::string, PylithReal>& states,
+                                               const std::string& prefix) {
+    _setTriggerState(states, prefix);
+} // setCheckpointState
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Prepare for output.
 void
@@ -88,6 +88,22 @@ public:
                 const PylithInt tindex,
                 const pylith::topology::Field& solution);
 
+    /** Get state of observer for checkpointing.
+     *
+     * @param[inout] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void getCheckpointState(std::map<std::string, PylithReal>* states,
+                            const std::string& prefix) const;
+
+    /** Set state of observer when restarting from a checkpoint.
+     *
+     * @param[in] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void setCheckpointState(const std::map<std::string, PylithReal>& states,
+                            const std::string& prefix);
+
     // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -64,9 +64,8 @@ pylith::meshio::OutputTriggerStep::shouldWrite(const PylithReal t,
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("OutputTriggerStep::shouldWrite(t="<<t<<", tindex="<<tindex<<")");
 
-    bool isWrite = false;
-    if (tindex - _stepWrote > _numStepsSkip) {
-        isWrite = true;
+    const bool isWrite = willWrite(t, tindex);
+    if (isWrite) {
         _stepWrote = tindex;
     } // if
 
@@ -74,4 +73,31 @@ pylith::meshio::OutputTriggerStep::shouldWrite(const PylithReal t,
 } // shouldWrite
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output will be written at time t without updating the state of the trigger.
+bool
+pylith::meshio::OutputTriggerStep::willWrite(const PylithReal,
+                                             const PylithInt tindex) const {
+    return tindex - _stepWrote > _numStepsSkip;
+} // willWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get state of trigger (when output was previously written) for checkpointing.
+PylithReal
+pylith::meshio::OutputTriggerStep::getState(void) const {
+    return _stepWrote;
+} // getState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set state of trigger (when output was previously written) when restarting from a checkpoint.
+void
+pylith::meshio::OutputTriggerStep::setState(const PylithReal value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerStep::setState(value="<<value<<")");
+
+    _stepWrote = PylithInt(value);
+} // setState
+
+
 // End of file
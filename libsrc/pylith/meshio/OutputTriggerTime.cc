@@ -64,9 +64,8 @@ pylith::meshio::OutputTriggerTime::shouldWrite(const PylithReal t,
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("OutputTriggerTime::shouldWrite(t="<<t<<", timeStep="<<timeStep<<")");
 
-    bool isWrite = false;
-    if (t - _timeNondimWrote >= _timeSkip / _timeScale) {
-        isWrite = true;
+    const bool isWrite = willWrite(t, timeStep);
+    if (isWrite) {
         _timeNondimWrote = t;
     } // if
 
@@ -74,4 +73,31 @@ pylith::meshio::OutputTriggerTime::shouldWrite(const PylithReal t,
 } // shouldWrite
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether output will be written at time t without updating the state of the trigger.
+bool
+pylith::meshio::OutputTriggerTime::willWrite(const PylithReal t,
+                                             const PylithInt) const {
+    return t - _timeNondimWrote >= _timeSkip / _timeScale;
+} // willWrite
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get state of trigger (when output was previously written) for checkpointing.
+PylithReal
+pylith::meshio::OutputTriggerTime::getState(void) const {
+    return _timeNondimWrote;
+} // getState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set state of trigger (when output was previously written) when restarting from a checkpoint.
+void
+pylith::meshio::OutputTriggerTime::setState(const PylithReal value) {
+    PYLITH_COMPONENT_DEBUG("OutputTriggerTime::setState(value="<<value<<")");
+
+    _timeNondimWrote = value;
+} // setState
+
+
 // End of file
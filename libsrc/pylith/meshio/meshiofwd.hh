@@ -33,6 +33,7 @@ namespace pylith {
 
         class MeshIO;
         class MeshBuilder;
+        class MeshCache;
         class MeshIOAscii;
         class MeshIOCubit;
         class MeshIOLagrit;
@@ -0,0 +1,510 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2015 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "GreensFns.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
+#include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
+#include "pylith/faults/FaultCohesiveImpulses.hh" // USES FaultCohesiveImpulses
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include "petscksp.h" // USES PetscKSP
+#include "petsctime.h" // USES PetscTime()
+
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+#include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include <algorithm> // USES std::min()
+#include <cassert> // USES assert()
+#include <cstring> // USES strcmp()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _GreensFns {
+public:
+
+            static const char* pyreComponent;
+        }; // _GreensFns
+
+        const char* _GreensFns::pyreComponent = "greensfns";
+    } // problems
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Constructor
+pylith::problems::GreensFns::GreensFns(void) :
+    _faultImpulses(NULL),
+    _integratorImpulses(NULL),
+    _solutionDot(NULL),
+    _residual(NULL),
+    _jacobianMat(NULL),
+    _ksp(NULL),
+    _rhsBlockSize(1),
+    _logger(NULL),
+    _eventComputeJacobian(-1),
+    _eventComputeRHS(-1),
+    _eventSolve(-1),
+    _eventPoststep(-1) {
+    PyreComponent::setName(_GreensFns::pyreComponent);
+} // constructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Destructor
+pylith::problems::GreensFns::~GreensFns(void) {
+    deallocate();
+} // destructor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::GreensFns::deallocate(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Problem::deallocate();
+
+    _faultImpulses = NULL; // Memory handled in Python.
+    _integratorImpulses = NULL; // Memory handled in Problem.
+    delete _solutionDot;_solutionDot = NULL;
+    delete _residual;_residual = NULL;
+
+    PetscErrorCode err = KSPDestroy(&_ksp);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    delete _logger;_logger = NULL;
+
+    PYLITH_METHOD_END;
+} // deallocate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set fault with slip impulses.
+void
+pylith::problems::GreensFns::setFaultImpulses(pylith::faults::FaultCohesiveImpulses* fault) {
+    PYLITH_COMPONENT_DEBUG("GreensFns::setFaultImpulses(fault="<<fault<<")");
+
+    _faultImpulses = fault;
+} // setFaultImpulses
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of impulses solved together as a block of right hand sides.
+void
+pylith::problems::GreensFns::setRHSBlockSize(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("GreensFns::setRHSBlockSize(value="<<value<<")");
+
+    if (0 == value) {
+        std::ostringstream msg;
+        msg << "Number of impulses in each block of right hand sides (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _rhsBlockSize = value;
+} // setRHSBlockSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of impulses solved together as a block of right hand sides.
+size_t
+pylith::problems::GreensFns::getRHSBlockSize(void) const {
+    return _rhsBlockSize;
+} // getRHSBlockSize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get Petsc DM associated with problem.
+PetscDM
+pylith::problems::GreensFns::getPetscDM(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dm = NULL;
+    PetscErrorCode err = KSPGetDM(_ksp, &dm);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(dm);
+} // getPetscDM
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get PETSc linear solver.
+PetscKSP
+pylith::problems::GreensFns::getPetscKSP(void) {
+    return _ksp;
+} // getPetscKSP
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Verify configuration.
+void
+pylith::problems::GreensFns::verifyConfiguration(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("GreensFns::verifyConfiguration(void)");
+
+    Problem::verifyConfiguration();
+
+    if (!_faultImpulses) {
+        throw std::logic_error("Fault with slip impulses not set for Green's functions problem.");
+    } // if
+
+    if (pylith::problems::Physics::QUASISTATIC != _formulation) {
+        std::ostringstream msg;
+        msg << "Green's functions problem '" << PyreComponent::getIdentifier() << "' requires a quasistatic formulation.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    if (LINEAR != _solverType) {
+        std::ostringstream msg;
+        msg << "Green's functions problem '" << PyreComponent::getIdentifier() << "' requires a linear solver. "
+            << "Impulse responses are superposed, so the problem must be linear.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    bool foundFault = false;
+    const size_t numInterfaces = _interfaces.size();
+    for (size_t i = 0; i < numInterfaces; ++i) {
+        if (_interfaces[i] == _faultImpulses) {
+            foundFault = true;
+            break;
+        } // if
+    } // for
+    if (!foundFault) {
+        std::ostringstream msg;
+        msg << "Fault with slip impulses '" << _faultImpulses->getIdentifier() << "' is not one of the interfaces in "
+            << "Green's functions problem '" << PyreComponent::getIdentifier() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // verifyConfiguration
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Initialize.
+void
+pylith::problems::GreensFns::initialize(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("GreensFns::initialize()");
+
+    Problem::initialize();
+
+    delete _logger;_logger = new pylith::utils::EventLogger;assert(_logger);
+    _logger->setClassName("GreensFns");
+    _logger->initialize();
+    _eventComputeJacobian = _logger->registerEvent("Py-GreensFns-computeJacobian");
+    _eventComputeRHS = _logger->registerEvent("Py-GreensFns-computeRHS");
+    _eventSolve = _logger->registerEvent("Py-GreensFns-solve");
+    _eventPoststep = _logger->registerEvent("Py-GreensFns-poststep");
+
+    // Find integrator for fault with impulses, so that we only update its auxiliary field for each impulse.
+    assert(_faultImpulses);
+    _integratorImpulses = NULL;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        if (0 == strcmp(_integrators[i]->getPhysicsIdentifier(), _faultImpulses->getIdentifier())) {
+            _integratorImpulses = _integrators[i];
+            break;
+        } // if
+    } // for
+    if (!_integratorImpulses) {
+        std::ostringstream msg;
+        msg << "Could not find integrator for fault with slip impulses '" << _faultImpulses->getIdentifier() << "'.";
+        throw std::logic_error(msg.str());
+    } // if
+
+    assert(_solution);
+    delete _residual;_residual = new pylith::topology::Field(*_solution);assert(_residual);
+    _residual->setLabel("residual");
+
+    delete _solutionDot;_solutionDot = new pylith::topology::Field(*_solution);assert(_solutionDot);
+    _solutionDot->setLabel("solutionDot");
+    _solutionDot->zeroLocal();
+
+    // All auxiliary fields, except the slip impulses, stay at their values at time 0.
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->updateState(0.0);
+    } // for
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->updateState(0.0);
+    } // for
+
+    _computeJacobian();
+
+    // Set up linear solver once; the operator and preconditioner are reused for every impulse.
+    const pylith::topology::Mesh& mesh = _solution->mesh();
+    PetscErrorCode err = KSPDestroy(&_ksp);PYLITH_CHECK_ERROR(err);assert(!_ksp);
+    err = KSPCreate(mesh.comm(), &_ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPSetDM(_ksp, _solution->dmMesh());PYLITH_CHECK_ERROR(err);
+    err = KSPSetDMActive(_ksp, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(_ksp, _jacobianMat, _jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = KSPSetFromOptions(_ksp);PYLITH_CHECK_ERROR(err);
+    err = KSPSetUp(_ksp);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // initialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute Green's functions for all impulses.
+void
+pylith::problems::GreensFns::solve(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("GreensFns::solve()");
+
+    assert(_faultImpulses);
+    assert(_solution);
+    assert(_ksp);
+
+    const size_t numImpulses = _faultImpulses->getNumImpulses();
+    PYLITH_COMPONENT_INFO("Computing Green's functions for " << numImpulses << " impulses with right hand side block size "
+                                                             << _rhsBlockSize << ".");
+
+    PetscLogDouble timeStart = 0.0;
+    PetscErrorCode err = PetscTime(&timeStart);PYLITH_CHECK_ERROR(err);
+
+    if (1 == _rhsBlockSize) {
+        PetscVec rhsVec = NULL;
+        PetscVec solutionVec = NULL;
+        err = VecDuplicate(_solution->globalVector(), &rhsVec);PYLITH_CHECK_ERROR(err);
+        err = VecDuplicate(_solution->globalVector(), &solutionVec);PYLITH_CHECK_ERROR(err);
+
+        for (size_t impulse = 0; impulse < numImpulses; ++impulse) {
+            _computeRHS(rhsVec, impulse);
+
+            _logger->eventBegin(_eventSolve);
+            err = KSPSolve(_ksp, rhsVec, solutionVec);PYLITH_CHECK_ERROR(err);
+            _logger->eventEnd(_eventSolve);
+
+            _poststep(solutionVec, impulse);
+        } // for
+
+        err = VecDestroy(&rhsVec);PYLITH_CHECK_ERROR(err);
+        err = VecDestroy(&solutionVec);PYLITH_CHECK_ERROR(err);
+    } else {
+        // Columns of dense matrices hold right hand sides and solutions for a block of impulses.
+        PetscInt sizeLocal = 0;
+        PetscInt sizeGlobal = 0;
+        err = VecGetLocalSize(_solution->globalVector(), &sizeLocal);PYLITH_CHECK_ERROR(err);
+        err = VecGetSize(_solution->globalVector(), &sizeGlobal);PYLITH_CHECK_ERROR(err);
+
+        PetscMat rhsMat = NULL;
+        PetscMat solutionMat = NULL;
+        size_t numColumns = 0;
+        for (size_t impulseStart = 0; impulseStart < numImpulses; impulseStart += _rhsBlockSize) {
+            const size_t blockSize = std::min(_rhsBlockSize, numImpulses - impulseStart);
+            if (blockSize != numColumns) {
+                err = MatDestroy(&rhsMat);PYLITH_CHECK_ERROR(err);
+                err = MatDestroy(&solutionMat);PYLITH_CHECK_ERROR(err);
+                err = MatCreateDense(_solution->mesh().comm(), sizeLocal, PETSC_DECIDE, sizeGlobal, blockSize, NULL,
+                                     &rhsMat);PYLITH_CHECK_ERROR(err);
+                err = MatCreateDense(_solution->mesh().comm(), sizeLocal, PETSC_DECIDE, sizeGlobal, blockSize, NULL,
+                                     &solutionMat);PYLITH_CHECK_ERROR(err);
+                numColumns = blockSize;
+            } // if
+
+            for (size_t iColumn = 0; iColumn < blockSize; ++iColumn) {
+                PetscVec rhsVec = NULL;
+                err = MatDenseGetColumnVecWrite(rhsMat, iColumn, &rhsVec);PYLITH_CHECK_ERROR(err);
+                _computeRHS(rhsVec, impulseStart + iColumn);
+                err = MatDenseRestoreColumnVecWrite(rhsMat, iColumn, &rhsVec);PYLITH_CHECK_ERROR(err);
+            } // for
+
+            _logger->eventBegin(_eventSolve);
+            err = KSPMatSolve(_ksp, rhsMat, solutionMat);PYLITH_CHECK_ERROR(err);
+            _logger->eventEnd(_eventSolve);
+
+            for (size_t iColumn = 0; iColumn < blockSize; ++iColumn) {
+                // Fault output must correspond to the impulse for this column, not the last one in the block.
+                _setImpulse(impulseStart + iColumn);
+
+                PetscVec solutionVec = NULL;
+                err = MatDenseGetColumnVecRead(solutionMat, iColumn, &solutionVec);PYLITH_CHECK_ERROR(err);
+                _poststep(solutionVec, impulseStart + iColumn);
+                err = MatDenseRestoreColumnVecRead(solutionMat, iColumn, &solutionVec);PYLITH_CHECK_ERROR(err);
+            } // for
+        } // for
+
+        err = MatDestroy(&rhsMat);PYLITH_CHECK_ERROR(err);
+        err = MatDestroy(&solutionMat);PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    PetscLogDouble timeEnd = 0.0;
+    err = PetscTime(&timeEnd);PYLITH_CHECK_ERROR(err);
+    const PetscLogDouble elapsedTime = timeEnd - timeStart;
+    if (elapsedTime > 0.0) {
+        PYLITH_COMPONENT_INFO("Computed " << numImpulses << " Green's functions in " << elapsedTime << " s ("
+                                          << 60.0*numImpulses/elapsedTime << " impulses per minute).");
+    } // if
+
+    PYLITH_METHOD_END;
+} // solve
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Assemble Jacobian for solution with constraints and zero displacement.
+void
+pylith::problems::GreensFns::_computeJacobian(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("GreensFns::_computeJacobian()");
+
+    assert(_solution);
+    assert(_solutionDot);
+
+    _logger->eventBegin(_eventComputeJacobian);
+
+    PetscErrorCode err = MatDestroy(&_jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = DMCreateMatrix(_solution->dmMesh(), &_jacobianMat);PYLITH_CHECK_ERROR(err);
+    err = MatZeroEntries(_jacobianMat);PYLITH_CHECK_ERROR(err);
+
+    _solution->zeroLocal();
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->setSolution(_solution, 0.0);
+    } // for
+
+    // Quasistatic problems have no time derivatives in the LHS Jacobian, so s_tshift and dt are arbitrary.
+    const PylithReal t = 0.0;
+    const PylithReal dt = 1.0;
+    const PylithReal s_tshift = 1.0;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->computeLHSJacobian(_jacobianMat, _jacobianMat, t, dt, s_tshift, *_solution, *_solutionDot);
+    } // for
+
+    err = MatAssemblyBegin(_jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_jacobianMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    _logger->eventEnd(_eventComputeJacobian);
+
+    PYLITH_METHOD_END;
+} // _computeJacobian
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set slip impulse and compute right hand side of linear solve.
+void
+pylith::problems::GreensFns::_computeRHS(PetscVec rhsVec,
+                                         const size_t impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("GreensFns::_computeRHS(rhsVec="<<rhsVec<<", impulse="<<impulse<<")");
+
+    assert(_solution);
+    assert(_solutionDot);
+    assert(_residual);
+
+    _setImpulse(impulse);
+
+    _logger->eventBegin(_eventComputeRHS);
+
+    // The problem is linear, so J*s = -F(0) where F(0) is the residual at zero solution (with constraints).
+    _solution->zeroLocal();
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->setSolution(_solution, 0.0);
+    } // for
+
+    const PylithReal t = 0.0;
+    const PylithReal dt = 1.0;
+    _residual->zeroLocal();
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->computeLHSResidual(_residual, t, dt, *_solution, *_solutionDot);
+    } // for
+
+    PetscErrorCode err = VecSet(rhsVec, 0.0);PYLITH_CHECK_ERROR(err);
+    _residual->scatterLocalToVector(rhsVec, ADD_VALUES);
+    err = VecScale(rhsVec, -1.0);PYLITH_CHECK_ERROR(err);
+
+    _logger->eventEnd(_eventComputeRHS);
+
+    PYLITH_METHOD_END;
+} // _computeRHS
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update integrators, constraints, and observers with solution for impulse.
+void
+pylith::problems::GreensFns::_poststep(PetscVec solutionVec,
+                                       const size_t impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("GreensFns::_poststep(solutionVec="<<solutionVec<<", impulse="<<impulse<<")");
+
+    assert(_solution);
+    assert(_normalizer);
+
+    _logger->eventBegin(_eventPoststep);
+
+    // Output uses the impulse index as the time stamp and time step.
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    const PylithReal t = PylithReal(impulse) / timeScale;
+    const PylithReal dt = 1.0 / timeScale;
+    const PylithInt tindex = impulse;
+
+    _solution->scatterVectorToLocal(solutionVec);
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->setSolution(_solution, 0.0);
+    } // for
+    _solution->scatterLocalToOutput();
+
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->poststep(t, tindex, dt, *_solution);
+    } // for
+    for (size_t i = 0; i < numConstraints; ++i) {
+        _constraints[i]->poststep(t, tindex, dt, *_solution);
+    } // for
+
+    assert(_observers);
+    _observers->notifyObservers(t, tindex, *_solution);
+
+    _logger->eventEnd(_eventPoststep);
+
+    PYLITH_METHOD_END;
+} // _poststep
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update auxiliary field of fault with slip impulses.
+void
+pylith::problems::GreensFns::_setImpulse(const size_t impulse) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("GreensFns::_setImpulse(impulse="<<impulse<<")");
+
+    assert(_integratorImpulses);
+    assert(_normalizer);
+
+    // FaultCohesiveImpulses interprets the (nondimensional) time as the index of the impulse.
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    _integratorImpulses->updateState(PylithReal(impulse) / timeScale);
+
+    PYLITH_METHOD_END;
+} // _setImpulse
+
+
+// End of file
@@ -0,0 +1,146 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2015 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/GreensFns.hh
+ *
+ * @brief Object for computing Green's functions for slip impulses on a fault.
+ *
+ * The problem is linear, so the Jacobian is assembled and the preconditioner is set up only once. Each impulse only
+ * changes the residual at zero solution, which is the right hand side of the linear solve. Impulses are solved one at
+ * a time or in blocks of right hand sides that share the Krylov solver.
+ *
+ * Observers receive the solution for each impulse with the impulse index as the time stamp and time step.
+ */
+
+#if !defined(pylith_problems_greensfns_hh)
+#define pylith_problems_greensfns_hh
+
+#include "Problem.hh" // ISA Problem
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
+
+class pylith::problems::GreensFns : public pylith::problems::Problem {
+    friend class TestGreensFns; // unit testing
+
+    // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    GreensFns(void);
+
+    /// Destructor
+    ~GreensFns(void);
+
+    /// Deallocate PETSc and local data structures.
+    void deallocate(void);
+
+    /** Set fault with slip impulses.
+     *
+     * @param[in] fault Fault with slip impulses (must also be one of the interfaces).
+     */
+    void setFaultImpulses(pylith::faults::FaultCohesiveImpulses* fault);
+
+    /** Set number of impulses solved together as a block of right hand sides.
+     *
+     * @param[in] value Number of impulses in each block (1 means solve impulses one at a time).
+     */
+    void setRHSBlockSize(const size_t value);
+
+    /** Get number of impulses solved together as a block of right hand sides.
+     *
+     * @returns Number of impulses in each block.
+     */
+    size_t getRHSBlockSize(void) const;
+
+    /** Get Petsc DM for problem.
+     *
+     * @returns PETSc DM for problem.
+     */
+    PetscDM getPetscDM(void);
+
+    /** Get PETSc linear solver.
+     *
+     * @returns PETSc KSP for problem.
+     */
+    PetscKSP getPetscKSP(void);
+
+    /// Verify configuration.
+    void verifyConfiguration(void) const;
+
+    /// Initialize.
+    void initialize(void);
+
+    /// Compute Green's functions for all impulses.
+    void solve(void);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Assemble Jacobian for solution with constraints and zero displacement.
+    void _computeJacobian(void);
+
+    /** Set slip impulse and compute right hand side of linear solve.
+     *
+     * @param[out] rhsVec PETSc Vec (global) for right hand side.
+     * @param[in] impulse Index of impulse.
+     */
+    void _computeRHS(PetscVec rhsVec,
+                     const size_t impulse);
+
+    /** Update integrators, constraints, and observers with solution for impulse.
+     *
+     * @param[in] solutionVec PETSc Vec (global) with solution for impulse.
+     * @param[in] impulse Index of impulse.
+     */
+    void _poststep(PetscVec solutionVec,
+                   const size_t impulse);
+
+    /** Update auxiliary field of fault with slip impulses.
+     *
+     * @param[in] impulse Index of impulse.
+     */
+    void _setImpulse(const size_t impulse);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::faults::FaultCohesiveImpulses* _faultImpulses; ///< Fault with slip impulses.
+    pylith::feassemble::Integrator* _integratorImpulses; ///< Integrator for fault with slip impulses.
+    pylith::topology::Field* _solutionDot; ///< Time derivative of solution (zero).
+    pylith::topology::Field* _residual; ///< Handle to residual field.
+    PetscMat _jacobianMat; ///< Jacobian matrix, assembled once.
+    PetscKSP _ksp; ///< PETSc linear solver.
+    size_t _rhsBlockSize; ///< Number of impulses solved together.
+
+    pylith::utils::EventLogger* _logger; ///< Event logger.
+    int _eventComputeJacobian; ///< Event for assembling Jacobian.
+    int _eventComputeRHS; ///< Event for computing right hand sides.
+    int _eventSolve; ///< Event for linear solves.
+    int _eventPoststep; ///< Event for updates after solves (includes output).
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    GreensFns(const GreensFns&); ///< Not implemented
+    const GreensFns& operator=(const GreensFns&); ///< Not implemented
+
+}; // GreensFns
+
+#endif // pylith_problems_greensfns_hh
+
+// End of file
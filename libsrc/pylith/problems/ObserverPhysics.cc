@@ -55,4 +55,32 @@ pylith::problems::ObserverPhysics::setPhysicsImplementation(const pylith::feasse
 } // setPhysicsImplemetation
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether observer will write output at time t when it receives the next update.
+bool
+pylith::problems::ObserverPhysics::willWrite(const PylithReal t,
+                                             const PylithInt tindex) const {
+    // Default is to assume observer always needs fields for output.
+    return true;
+} // willWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Get state of observer for checkpointing.
+void
+pylith::problems::ObserverPhysics::getCheckpointState(std::map<std::string, PylithReal>* states,
+                                                      const std::string& prefix) const {
+    // Default is no state.
+} // getCheckpointState
+
+
+// ------------------------------------------------------------------------------------------------
+// Set state of observer when restarting from a checkpoint.
+void
+pylith::problems::ObserverPhysics::setCheckpointState(const std::map<std::string, PylithReal>& states,
+                                                      const std::string& prefix) {
+    // Default is no state.
+} // setCheckpointState
+
+
 // End of file
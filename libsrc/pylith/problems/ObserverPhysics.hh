@@ -33,6 +33,9 @@
 #include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/types.hh" // USES PylithReal, PylithInt
 
+#include <map> // USES std::map
+#include <string> // USES std::string
+
 class pylith::problems::ObserverPhysics {
     friend class TestObserverPhysics; // unit testing
 
@@ -83,6 +86,36 @@ public:
                 const pylith::topology::Field& solution,
                 const bool infoOnly) = 0;
 
+    /** Check whether observer will write output at time t when it receives the next update.
+     *
+     * Physics implementations use this to skip computing fields only needed for output.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if observer will write output at time t, false otherwise.
+     */
+    virtual
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const;
+
+    /** Get state of observer for checkpointing.
+     *
+     * @param[inout] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    virtual
+    void getCheckpointState(std::map<std::string, PylithReal>* states,
+                            const std::string& prefix) const;
+
+    /** Set state of observer when restarting from a checkpoint.
+     *
+     * @param[in] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    virtual
+    void setCheckpointState(const std::map<std::string, PylithReal>& states,
+                            const std::string& prefix);
+
     // PROTECTED MEMBERS //////////////////////////////////////////////////////////////////////////
 protected:
 
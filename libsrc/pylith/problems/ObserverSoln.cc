@@ -38,4 +38,22 @@ void
 pylith::problems::ObserverSoln::deallocate(void) {}
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get state of observer for checkpointing.
+void
+pylith::problems::ObserverSoln::getCheckpointState(std::map<std::string, PylithReal>* states,
+                                                   const std::string& prefix) const {
+    // Default is no state.
+} // getCheckpointState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set state of observer when restarting from a checkpoint.
+void
+pylith::problems::ObserverSoln::setCheckpointState(const std::map<std::string, PylithReal>& states,
+                                                   const std::string& prefix) {
+    // Default is no state.
+} // setCheckpointState
+
+
 // End of file
@@ -30,6 +30,9 @@
 #include "pylith/topology/topologyfwd.hh" // USES Field
 #include "pylith/utils/types.hh" // USES PylithReal, PylithInt
 
+#include <map> // USES std::map
+#include <string> // USES std::string
+
 class pylith::problems::ObserverSoln {
     friend class TestObserverSoln; // unit testing
 
@@ -72,6 +75,24 @@ public:
                 const PylithInt tindex,
                 const pylith::topology::Field& solution) = 0;
 
+    /** Get state of observer for checkpointing.
+     *
+     * @param[inout] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    virtual
+    void getCheckpointState(std::map<std::string, PylithReal>* states,
+                            const std::string& prefix) const;
+
+    /** Set state of observer when restarting from a checkpoint.
+     *
+     * @param[in] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    virtual
+    void setCheckpointState(const std::map<std::string, PylithReal>& states,
+                            const std::string& prefix);
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
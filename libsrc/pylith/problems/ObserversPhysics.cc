@@ -156,4 +156,54 @@ pylith::problems::ObserversPhysics::notifyObservers(const PylithReal t,
 } // notifyObservers
 
 
+// ------------------------------------------------------------------------------------------------
+// Check whether any observer will write output at time t when it receives the next update.
+bool
+pylith::problems::ObserversPhysics::willWrite(const PylithReal t,
+                                             const PylithInt tindex) const {
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        if ((*iter)->willWrite(t, tindex)) {
+            return true;
+        } // if
+    } // for
+
+    return false;
+} // willWrite
+
+
+// ------------------------------------------------------------------------------------------------
+// Get state of observers for checkpointing.
+void
+pylith::problems::ObserversPhysics::getCheckpointState(std::map<std::string, PylithReal>* states,
+                                                       const std::string& prefix) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("getCheckpointState(states="<<states<<", prefix="<<prefix<<")");
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->getCheckpointState(states, prefix);
+    } // for
+
+    PYLITH_METHOD_END;
+} // getCheckpointState
+
+
+// ------------------------------------------------------------------------------------------------
+// Set state of observers when restarting from a checkpoint.
+void
+pylith::problems::ObserversPhysics::setCheckpointState(const std::map<std::string, PylithReal>& states,
+                                                       const std::string& prefix) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setCheckpointState(prefix="<<prefix<<")");
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->setCheckpointState(states, prefix);
+    } // for
+
+    PYLITH_METHOD_END;
+} // setCheckpointState
+
+
 // End of file
@@ -34,6 +34,8 @@
 #include "pylith/utils/types.hh" // USES PylithReal, PylithInt
 
 #include <set> // USES std::set
+#include <map> // USES std::map
+#include <string> // USES std::string
 
 class pylith::problems::ObserversPhysics : public pylith::utils::GenericComponent {
     friend class TestObserversPhysics; // unit testing
@@ -100,6 +102,31 @@ public:
                          const pylith::topology::Field& solution,
                          const bool infoOnly);
 
+    /** Check whether any observer will write output at time t when it receives the next update.
+     *
+     * @param[in] t Current time.
+     * @param[in] tindex Current time step.
+     * @returns True if at least one observer will write output at time t, false otherwise.
+     */
+    bool willWrite(const PylithReal t,
+                   const PylithInt tindex) const;
+
+    /** Get state of observers for checkpointing.
+     *
+     * @param[inout] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void getCheckpointState(std::map<std::string, PylithReal>* states,
+                            const std::string& prefix) const;
+
+    /** Set state of observers when restarting from a checkpoint.
+     *
+     * @param[in] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void setCheckpointState(const std::map<std::string, PylithReal>& states,
+                            const std::string& prefix);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -130,4 +130,38 @@ pylith::problems::ObserversSoln::notifyObservers(const PylithReal t,
 } // notifyObservers
 
 
+// ----------------------------------------------------------------------
+// Get state of observers for checkpointing.
+void
+pylith::problems::ObserversSoln::getCheckpointState(std::map<std::string, PylithReal>* states,
+                                                    const std::string& prefix) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("getCheckpointState(states="<<states<<", prefix="<<prefix<<")");
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->getCheckpointState(states, prefix);
+    } // for
+
+    PYLITH_METHOD_END;
+} // getCheckpointState
+
+
+// ----------------------------------------------------------------------
+// Set state of observers when restarting from a checkpoint.
+void
+pylith::problems::ObserversSoln::setCheckpointState(const std::map<std::string, PylithReal>& states,
+                                                    const std::string& prefix) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_JOURNAL_DEBUG("setCheckpointState(prefix="<<prefix<<")");
+
+    for (iterator iter = _observers.begin(); iter != _observers.end(); ++iter) {
+        assert(*iter);
+        (*iter)->setCheckpointState(states, prefix);
+    } // for
+
+    PYLITH_METHOD_END;
+} // setCheckpointState
+
+
 // End of file
@@ -33,6 +33,8 @@
 #include "pylith/utils/types.hh" // USES PylithReal, PylithInt
 
 #include <set> // USES std::set
+#include <map> // USES std::map
+#include <string> // USES std::string
 
 class pylith::problems::ObserversSoln : public pylith::utils::GenericComponent {
     friend class TestObserversSoln; // unit testing
@@ -86,6 +88,22 @@ public:
                          const PylithInt tindex,
                          const pylith::topology::Field& solution);
 
+    /** Get state of observers for checkpointing.
+     *
+     * @param[inout] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void getCheckpointState(std::map<std::string, PylithReal>* states,
+                            const std::string& prefix) const;
+
+    /** Set state of observers when restarting from a checkpoint.
+     *
+     * @param[in] states Observer states keyed by name.
+     * @param[in] prefix Prefix for names of observer states.
+     */
+    void setCheckpointState(const std::map<std::string, PylithReal>& states,
+                            const std::string& prefix);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
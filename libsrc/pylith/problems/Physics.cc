@@ -106,6 +106,22 @@ pylith::problems::Physics::setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB
 } // setAuxiliaryFieldDB
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for skipping query of auxiliary field database.
+void
+pylith::problems::Physics::setSkipAuxiliaryFieldDB(const bool value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setSkipAuxiliaryFieldDB(value="<<value<<")");
+
+    pylith::feassemble::AuxiliaryFactory* factory = _getAuxiliaryFactory();
+    if (factory) {
+        factory->setSkipQueryDB(value);
+    } // if
+
+    PYLITH_METHOD_END;
+} // setSkipAuxiliaryFieldDB
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set discretization information for auxiliary subfield.
 void
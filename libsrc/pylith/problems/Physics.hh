@@ -84,6 +84,14 @@ public:
      */
     void setAuxiliaryFieldDB(spatialdata::spatialdb::SpatialDB* const value);
 
+    /** Set flag for skipping query of auxiliary field database.
+     *
+     * Used when restarting from a checkpoint, which supplies the auxiliary field.
+     *
+     * @param[in] value True if query should be skipped, false otherwise.
+     */
+    void setSkipAuxiliaryFieldDB(const bool value);
+
     /** Set discretization information for auxiliary subfield.
      *
      * @param[in] subfieldName Name of auxiliary subfield.
@@ -41,6 +41,12 @@
 
 #include <cassert> // USES assert()
 #include <typeinfo> // USES typeid()
+#include <sstream> // USES std::ostringstream
+#include <iomanip> // USES std::setw()
+#include <stdexcept> // USES std::runtime_error
+#include <map> // USES std::map
+#include <algorithm> // USES std::sort(), std::min()
+#include <functional> // USES std::greater
 
 // ----------------------------------------------------------------------
 // Constructor
@@ -50,7 +56,8 @@ pylith::problems::Problem::Problem() :
     _gravityField(NULL),
     _observers(new pylith::problems::ObserversSoln),
     _formulation(pylith::problems::Physics::QUASISTATIC),
-    _solverType(LINEAR) {}
+    _solverType(LINEAR),
+    _geometryCacheBudget(512.0) {}
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -126,6 +133,29 @@ pylith::problems::Problem::getSolverType(void) const {
 } // getSolverType
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set per-process memory budget for caching cell geometry in integration domains.
+void
+pylith::problems::Problem::setGeometryCacheBudget(const PylithReal value) {
+    PYLITH_COMPONENT_DEBUG("Problem::setGeometryCacheBudget(value="<<value<<")");
+
+    if (value < 0.0) {
+        std::ostringstream msg;
+        msg << "Memory budget for geometry cache (" << value << " MB) must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _geometryCacheBudget = value;
+} // setGeometryCacheBudget
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get per-process memory budget for caching cell geometry in integration domains.
+PylithReal
+pylith::problems::Problem::getGeometryCacheBudget(void) const {
+    return _geometryCacheBudget;
+} // getGeometryCacheBudget
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set manager of scales used to nondimensionalize problem.
 void
@@ -337,12 +367,18 @@ pylith::problems::Problem::initialize(void) {
     const pylith::topology::Mesh& mesh = _solution->mesh();
     pylith::topology::CoordsVisitor::optimizeClosure(mesh.dmMesh());
 
-    // Initialize integrators.
+    // Initialize integrators. Integrators share the budget for cached cell geometry in the order they are initialized.
     _createIntegrators();
+    size_t geometryCacheAvailable = size_t(_geometryCacheBudget * 1024.0 * 1024.0);
     const size_t numIntegrators = _integrators.size();
     for (size_t i = 0; i < numIntegrators; ++i) {
         assert(_integrators[i]);
+        _integrators[i]->setGeometryCacheBudget(geometryCacheAvailable);
         _integrators[i]->initialize(*_solution);
+
+        const size_t geometryCacheSize = _integrators[i]->getGeometryCacheSize();
+        assert(geometryCacheSize <= geometryCacheAvailable);
+        geometryCacheAvailable -= geometryCacheSize;
     } // for
 
     // Initialize constraints.
@@ -356,6 +392,7 @@ pylith::problems::Problem::initialize(void) {
     _solution->allocate();
     _solution->createGlobalVector();
     _solution->createOutputVector();
+    _setupMatrixType();
 
     pythia::journal::debug_t debug(PyreComponent::getName());
     if (debug.state()) {
@@ -367,6 +404,152 @@ pylith::problems::Problem::initialize(void) {
 } // initialize
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Write summary of time spent in each physics, ranked by time.
+void
+pylith::problems::Problem::logPerformanceSummary(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::logPerformanceSummary()");
+
+    if (!_solution) {
+        PYLITH_METHOD_END;
+    } // if
+
+    typedef pylith::feassemble::PhysicsImplementation PhysicsImplementation;
+    const int numEvents = PhysicsImplementation::NUM_EVENTS;
+
+    // Combine integrators and constraints implementing the same physics. Every process holds the same physics, so the
+    // ordering of the map is consistent across processes.
+    std::vector<const PhysicsImplementation*> implementations(_integrators.begin(), _integrators.end());
+    implementations.insert(implementations.end(), _constraints.begin(), _constraints.end());
+    typedef std::map<std::string, size_t> physics_map_type;
+    physics_map_type physicsIndex;
+    for (size_t i = 0; i < implementations.size(); ++i) {
+        assert(implementations[i]);
+        const std::string identifier = implementations[i]->getPhysicsIdentifier();
+        if (physicsIndex.find(identifier) == physicsIndex.end()) {
+            const size_t index = physicsIndex.size();
+            physicsIndex[identifier] = index;
+        } // if
+    } // for
+    const size_t numPhysics = physicsIndex.size();
+    if (!numPhysics) {
+        PYLITH_METHOD_END;
+    } // if
+
+    pylith::real_array countsLocal(0.0, numPhysics*numEvents);
+    pylith::real_array timesLocal(0.0, numPhysics*numEvents);
+    pylith::real_array flopsLocal(0.0, numPhysics*numEvents);
+    for (size_t i = 0; i < implementations.size(); ++i) {
+        const size_t index = physicsIndex[implementations[i]->getPhysicsIdentifier()];
+        for (int iEvent = 0; iEvent < numEvents; ++iEvent) {
+            const PhysicsImplementation::EventEnum event = PhysicsImplementation::EventEnum(iEvent);
+            countsLocal[index*numEvents+iEvent] += implementations[i]->getEventCount(event);
+            timesLocal[index*numEvents+iEvent] += implementations[i]->getEventTime(event);
+            flopsLocal[index*numEvents+iEvent] += implementations[i]->getEventFlops(event);
+        } // for
+    } // for
+
+    // Load imbalance shows up as the slowest process, so report the maximum time rather than the sum.
+    PetscErrorCode err;
+    const MPI_Comm comm = _solution->mesh().comm();
+    const int size = numPhysics*numEvents;
+    pylith::real_array counts(size);
+    pylith::real_array times(size);
+    pylith::real_array flops(size);
+    err = MPI_Allreduce(&countsLocal[0], &counts[0], size, MPIU_REAL, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&timesLocal[0], &times[0], size, MPIU_REAL, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&flopsLocal[0], &flops[0], size, MPIU_REAL, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+    // Calibrate partition weights from the time per cell of each material and fault. Each cell is integrated on only
+    // one process, so use the total time and number of cells over all processes.
+    const size_t numMaterials = _materials.size();
+    const size_t numInterfaces = _interfaces.size();
+    const size_t numCosts = numMaterials + numInterfaces;
+    pylith::real_array costs(0.0, 2*numCosts);
+    if (numCosts > 0) {
+        pylith::real_array costsLocal(0.0, 2*numCosts); // time, number of cells
+        PetscDM dmSoln = _solution->mesh().dmMesh();assert(dmSoln);
+        const char* const cellsLabelName = pylith::topology::Mesh::getCellsLabelName();
+        for (size_t i = 0; i < numCosts; ++i) {
+            const bool isMaterial = i < numMaterials;
+            const char* identifier = isMaterial ? _materials[i]->getIdentifier() : _interfaces[i-numMaterials]->getIdentifier();
+            const int labelValue = isMaterial ? _materials[i]->getMaterialId() : _interfaces[i-numMaterials]->getInterfaceId();
+            const physics_map_type::const_iterator iter = physicsIndex.find(identifier);
+            if (iter != physicsIndex.end()) {
+                costsLocal[2*i] = pylith::real_array(timesLocal[std::slice(iter->second*numEvents, numEvents, 1)]).sum();
+            } // if
+            PetscInt numCells = 0;
+            err = DMGetStratumSize(dmSoln, cellsLabelName, labelValue, &numCells);PYLITH_CHECK_ERROR(err);
+            costsLocal[2*i+1] = numCells;
+        } // for
+        err = MPI_Allreduce(&costsLocal[0], &costs[0], 2*numCosts, MPIU_REAL, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    int rank = 0;
+    err = MPI_Comm_rank(comm, &rank);PYLITH_CHECK_ERROR(err);
+    if (rank) {
+        PYLITH_METHOD_END;
+    } // if
+
+    std::vector<std::pair<PylithReal, std::string> > ranking;
+    PylithReal timeTotal = 0.0;
+    for (physics_map_type::const_iterator iter = physicsIndex.begin(); iter != physicsIndex.end(); ++iter) {
+        const PylithReal timePhysics = pylith::real_array(times[std::slice(iter->second*numEvents, numEvents, 1)]).sum();
+        ranking.push_back(std::make_pair(timePhysics, iter->first));
+        timeTotal += timePhysics;
+    } // for
+    std::sort(ranking.begin(), ranking.end(), std::greater<std::pair<PylithReal, std::string> >());
+
+    std::ostringstream msg;
+    msg << "Summary of time spent in physics (maximum over processes):\n"
+        << std::setw(24) << std::left << "Physics/Event" << std::right
+        << std::setw(10) << "Count" << std::setw(14) << "Time (s)" << std::setw(8) << "%" << std::setw(14) << "MFlop/s"
+        << "\n";
+    for (size_t iPhysics = 0; iPhysics < ranking.size(); ++iPhysics) {
+        const PylithReal timePhysics = ranking[iPhysics].first;
+        const size_t index = physicsIndex[ranking[iPhysics].second];
+        msg << std::setw(24) << std::left << ranking[iPhysics].second << std::right
+            << std::setw(10) << "" << std::setw(14) << std::scientific << std::setprecision(4) << timePhysics
+            << std::setw(8) << std::fixed << std::setprecision(1) << (timeTotal > 0.0 ? 100.0*timePhysics/timeTotal : 0.0)
+            << "\n";
+        for (int iEvent = 0; iEvent < numEvents; ++iEvent) {
+            const size_t i = index*numEvents+iEvent;
+            if (!counts[i]) { continue; }
+            msg << "  " << std::setw(22) << std::left << PhysicsImplementation::getEventName(PhysicsImplementation::EventEnum(iEvent))
+                << std::right << std::setw(10) << size_t(counts[i])
+                << std::setw(14) << std::scientific << std::setprecision(4) << times[i]
+                << std::setw(8) << std::fixed << std::setprecision(1) << (timeTotal > 0.0 ? 100.0*times[i]/timeTotal : 0.0)
+                << std::setw(14) << std::scientific << std::setprecision(4) << (times[i] > 0.0 ? 1.0e-6*flops[i]/times[i] : 0.0)
+                << "\n";
+        } // for
+    } // for
+
+    // Weights relative to the least expensive material, for the partition_weight of materials and faults.
+    PylithReal costMin = 0.0;
+    for (size_t i = 0; i < numMaterials; ++i) {
+        if ((costs[2*i] > 0.0) && (costs[2*i+1] > 0.0)) {
+            const PylithReal cost = costs[2*i] / costs[2*i+1];
+            costMin = (costMin > 0.0) ? std::min(costMin, cost) : cost;
+        } // if
+    } // for
+    if (costMin > 0.0) {
+        msg << "Partition weights from time per cell (relative to least expensive material):\n";
+        for (size_t i = 0; i < numCosts; ++i) {
+            if ((costs[2*i] <= 0.0) || (costs[2*i+1] <= 0.0)) { continue; }
+            const char* identifier = (i < numMaterials) ? _materials[i]->getIdentifier() : _interfaces[i-numMaterials]->getIdentifier();
+            msg << "  " << std::setw(22) << std::left << identifier << std::right
+                << std::setw(10) << size_t(costs[2*i+1]) << " cells"
+                << std::setw(10) << std::fixed << std::setprecision(2) << costs[2*i] / costs[2*i+1] / costMin
+                << "\n";
+        } // for
+    } // if
+    PYLITH_COMPONENT_INFO(msg.str());
+
+    PYLITH_METHOD_END;
+} // logPerformanceSummary
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Check material and interface ids.
 void
@@ -394,6 +577,21 @@ pylith::problems::Problem::_checkMaterialIds(void) const {
 } // _checkMaterialIds
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Get memory in the budget for cached cell geometry that is not used by any integrator.
+size_t
+pylith::problems::Problem::_getGeometryCacheAvailable(void) const {
+    size_t geometryCacheAvailable = size_t(_geometryCacheBudget * 1024.0 * 1024.0);
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        geometryCacheAvailable -= std::min(geometryCacheAvailable, _integrators[i]->getGeometryCacheSize());
+    } // for
+
+    return geometryCacheAvailable;
+} // _getGeometryCacheAvailable
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Create array of integrators from materials, interfaces, and boundary conditions.
 void
@@ -518,6 +716,83 @@ pylith::problems::Problem::_setupSolution(void) {
 } // _setupSolution
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Use blocked sparse matrices if the solution layout has a uniform block size and the user did not set one.
+void
+pylith::problems::Problem::_setupMatrixType(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("Problem::_setupMatrixType()");
+
+    assert(_solution);
+    PetscErrorCode err;
+
+    // Honor a matrix type set by the user, including any options prefix on the solution DM.
+    PetscDM dmSoln = _solution->dmMesh();assert(dmSoln);
+    const char* prefix = NULL;
+    char userMatType[256];
+    PetscBool hasMatType = PETSC_FALSE;
+    err = DMGetOptionsPrefix(dmSoln, &prefix);PYLITH_CHECK_ERROR(err);
+    err = PetscOptionsGetString(NULL, prefix, "-dm_mat_type", userMatType, sizeof(userMatType), &hasMatType);PYLITH_CHECK_ERROR(err);
+    if (hasMatType) {
+        PYLITH_COMPONENT_INFO("Using sparse matrix type '"<<userMatType<<"' set by -"<<(prefix ? prefix : "")<<"dm_mat_type.");
+        PYLITH_METHOD_END;
+    } // if
+
+    // Candidate block size is the number of components common to all subfields.
+    const pylith::string_vector subfieldNames = _solution->subfieldNames();
+    PetscInt blockSize = -1;
+    for (size_t i = 0; i < subfieldNames.size(); ++i) {
+        const PetscInt numComponents = PetscInt(_solution->subfieldInfo(subfieldNames[i].c_str()).description.numComponents);
+        blockSize = (blockSize < 0 || blockSize == numComponents) ? numComponents : 1;
+    } // for
+    const PetscInt blockSizeSubfields = blockSize;
+
+    // Match the block size DMCreateMatrix() computes from the section: every point with degrees of freedom must hold
+    // exactly one block that is either unconstrained or fully constrained.
+    PetscSection solutionSection = _solution->localSection();assert(solutionSection);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscInt numPointsMultipleBlocks = 0;
+    PetscInt numPointsPartiallyConstrained = 0;
+    err = PetscSectionGetChart(solutionSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    for (PetscInt point = pStart; point < pEnd && blockSize > 1; ++point) {
+        PetscInt dof = 0, cdof = 0;
+        err = PetscSectionGetDof(solutionSection, point, &dof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetConstraintDof(solutionSection, point, &cdof);PYLITH_CHECK_ERROR(err);
+        if (dof && (dof != blockSize)) {
+            ++numPointsMultipleBlocks;
+            blockSize = 1;
+        } else if (cdof && (cdof != dof)) {
+            ++numPointsPartiallyConstrained;
+            blockSize = 1;
+        } // if/else
+    } // for
+    PetscInt blockSizeGlobal = 1;
+    PetscInt reasonsLocal[2] = { numPointsMultipleBlocks, numPointsPartiallyConstrained };
+    PetscInt reasonsGlobal[2] = { 0, 0 };
+    MPI_Comm comm = _solution->mesh().comm();
+    err = MPI_Allreduce(&blockSize, &blockSizeGlobal, 1, MPIU_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(reasonsLocal, reasonsGlobal, 2, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+    if (blockSizeGlobal > 1) {
+        PYLITH_COMPONENT_INFO("Using blocked sparse matrices (BAIJ) with block size "<<blockSizeGlobal<<"; every point "
+                              <<"holds one block that is either unconstrained or fully constrained.");
+        err = DMSetMatType(dmSoln, MATBAIJ);PYLITH_CHECK_ERROR(err);
+    } else {
+        std::ostringstream reason;
+        if (blockSizeSubfields <= 1) {
+            reason << "solution subfields do not have a common number of components greater than 1";
+        } else if (reasonsGlobal[0] > 0) {
+            reason << "points hold more than one block of " << blockSizeSubfields << " degrees of freedom";
+        } else {
+            reason << "points have partially constrained blocks of " << blockSizeSubfields << " degrees of freedom";
+        } // if/else
+        PYLITH_COMPONENT_INFO("Using default sparse matrix type (AIJ); "<<reason.str()<<".");
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // _setupMatrixType
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Setup field so Lagrange multiplier subfield is limited to degrees of freedom associated with the cohesive cells.
 void
@@ -95,6 +95,18 @@ public:
      */
     SolverTypeEnum getSolverType(void) const;
 
+    /** Set per-process memory budget for caching cell geometry in integration domains.
+     *
+     * @param[in] value Maximum memory (in MB) for cached cell geometry.
+     */
+    void setGeometryCacheBudget(const PylithReal value);
+
+    /** Get per-process memory budget for caching cell geometry in integration domains.
+     *
+     * @returns Maximum memory (in MB) for cached cell geometry.
+     */
+    PylithReal getGeometryCacheBudget(void) const;
+
     /** Set manager of scales used to nondimensionalize problem.
      *
      * @param[in] dim Nondimensionalizer.
@@ -166,6 +178,22 @@ public:
     virtual
     void initialize(void);
 
+    /** Write summary of time spent in each physics, ranked by time.
+     *
+     * Times are the maximum over processes; floating point operations are the sum over processes. Also reports the time
+     * per cell of each material and fault relative to the least expensive material for use as partition weights.
+     */
+    void logPerformanceSummary(void) const;
+
+    // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+    /** Get memory in the budget for cached cell geometry that is not used by any integrator.
+     *
+     * @returns Number of bytes available.
+     */
+    size_t _getGeometryCacheAvailable(void) const;
+
     // PROTECTED MEMBERS ///////////////////////////////////////////////////////////////////////////////////////////////
 protected:
 
@@ -184,6 +212,7 @@ protected:
 
     pylith::problems::Physics::FormulationEnum _formulation; ///< Formulation for equations.
     SolverTypeEnum _solverType; ///< Problem (solver) type.
+    PylithReal _geometryCacheBudget; ///< Per-process memory budget (MB) for cached cell geometry.
 
     // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
@@ -203,6 +232,9 @@ private:
     // Setup field so Lagrange multiplier subfield is limited to degrees of freedom associated with the cohesive cells.
     void _setupLagrangeMultiplier(void);
 
+    /// Use blocked sparse matrices if the solution layout has a uniform block size and the user did not set one.
+    void _setupMatrixType(void);
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -22,20 +22,33 @@
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/FieldOps.hh" // USES FieldOps
 
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
 #include "pylith/feassemble/Constraint.hh" // USES Constraint
 #include "pylith/problems/ObserversSoln.hh" // USES ObserversSoln
 #include "pylith/problems/InitialCondition.hh" // USES InitialCondition
 #include "pylith/problems/ProgressMonitorTime.hh" // USES ProgressMonitorTime
+#include "pylith/problems/ObserversPhysics.hh" // USES ObserversPhysics
+#include "pylith/materials/Material.hh" // USES Material
+#include "pylith/bc/BoundaryCondition.hh" // USES BoundaryCondition
+#include "pylith/faults/FaultCohesive.hh" // USES FaultCohesive
+#include "pylith/meshio/HDF5.hh" // USES HDF5
 
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "petscts.h" // USES PetscTS
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
 
 #include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
 #include "pylith/utils/journals.hh" // USES PYLITH_COMPONENT_*
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/array.hh" // USES int_array
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+#include <algorithm> // USES std::min()
 #include <cassert> // USES assert()
+#include <cstdio> // USES std::rename()
+#include <sstream> // USES std::ostringstream
 
 // ---------------------------------------------------------------------------------------------------------------------
 namespace pylith {
@@ -62,12 +75,50 @@ pylith::problems::TimeDependent::TimeDependent(void) :
     _solutionDot(NULL),
     _residual(NULL),
     _jacobianLHSLumpedInv(NULL),
+    _jacobianAction(NULL),
+    _jacobianType(JACOBIAN_ASSEMBLED),
+    _predictor(PREDICTOR_NONE),
+    _jacobianMatrixFree(NULL),
+    _precondMat(NULL),
+    _solutionJacobianVec(NULL),
+    _solutionDotJacobianVec(NULL),
+    _tJacobianAction(0.0),
+    _dtJacobianAction(0.0),
+    _sTShiftJacobianAction(0.0),
+    _jacobianStiffness(NULL),
+    _jacobianMass(NULL),
+    _sTShiftJacobian(-1.0),
+    _useJacobianSplit(false),
     _dtJacobian(-1.0),
     _dtLHSJacobianLumped(-1.0),
     _tResidual(-1.0e+30),
     _needNewLHSJacobian(true),
     _haveNewLHSJacobian(false),
-    _shouldNotifyIC(false) {
+    _haveShiftOnlyLHSJacobian(false),
+    _shouldNotifyIC(false),
+    _assemblePreconditioner(true),
+    _checkpointFilename("checkpoint.h5"),
+    _checkpointInterval(0),
+    _restart(false),
+    _multirate(false),
+    _residualMultirateVec(NULL),
+    _dtStableMultirate(0.0),
+    _overlapHaloExchange(false),
+    _residualInterior(NULL),
+    _reusePreconditioner(false),
+    _pcRebuildFactor(2.0),
+    _pcNeedRebuild(false),
+    _pcRebuilt(false),
+    _pcRebuildIterations(0),
+    _pcLinearIterations(0),
+    _pcSetUpTime(0.0),
+    _pcSolveTime(0.0),
+    _eventPCSetUp(-1),
+    _eventKSPSolve(-1),
+    _logger(NULL),
+    _eventSetSolutionLocal(-1),
+    _eventSetSolutionLocalSkipped(-1) {
+    _solutionLocalState.isValid = false;
     PyreComponent::setName(_TimeDependent::pyreComponent);
 } // constructor
 
@@ -90,9 +141,27 @@ pylith::problems::TimeDependent::deallocate(void) {
     _monitor = NULL; // Memory handle in Python. :TODO: Use shared pointer.
     delete _solutionDot;_solutionDot = NULL;
     delete _residual;_residual = NULL;
+    delete _residualInterior;_residualInterior = NULL;
     delete _jacobianLHSLumpedInv;_jacobianLHSLumpedInv = NULL;
+    delete _jacobianAction;_jacobianAction = NULL;
 
     PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_jacobianMatrixFree);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_precondMat);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_solutionJacobianVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_solutionDotJacobianVec);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_jacobianStiffness);PYLITH_CHECK_ERROR(err);
+    err = MatDestroy(&_jacobianMass);PYLITH_CHECK_ERROR(err);
+
+    err = VecDestroy(&_residualMultirateVec);PYLITH_CHECK_ERROR(err);
+
+    delete _logger;_logger = NULL;
+
+    for (size_t i = 0; i < _predictorSolutions.size(); ++i) {
+        err = VecDestroy(&_predictorSolutions[i]);PYLITH_CHECK_ERROR(err);
+    } // for
+    _predictorSolutions.clear();
+    _predictorTimes.clear();
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -194,6 +263,60 @@ pylith::problems::TimeDependent::getInitialTimeStep(void) const {
 } // getInitialTimeStep
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set type of Jacobian for implicit time stepping.
+void
+pylith::problems::TimeDependent::setJacobianType(const JacobianTypeEnum value) {
+    PYLITH_COMPONENT_DEBUG("setJacobianType(value="<<value<<")");
+
+    _jacobianType = value;
+} // setJacobianType
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get type of Jacobian for implicit time stepping.
+pylith::problems::TimeDependent::JacobianTypeEnum
+pylith::problems::TimeDependent::getJacobianType(void) const {
+    return _jacobianType;
+} // getJacobianType
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set predictor for initial guess of nonlinear solve in implicit time stepping.
+void
+pylith::problems::TimeDependent::setPredictor(const PredictorEnum value) {
+    PYLITH_COMPONENT_DEBUG("setPredictor(value="<<value<<")");
+
+    _predictor = value;
+} // setPredictor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get predictor for initial guess of nonlinear solve in implicit time stepping.
+pylith::problems::TimeDependent::PredictorEnum
+pylith::problems::TimeDependent::getPredictor(void) const {
+    return _predictor;
+} // getPredictor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for assembling sparse matrix for preconditioner with matrix-free Jacobian.
+void
+pylith::problems::TimeDependent::setAssemblePreconditioner(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setAssemblePreconditioner(value="<<value<<")");
+
+    _assemblePreconditioner = value;
+} // setAssemblePreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag for assembling sparse matrix for preconditioner with matrix-free Jacobian.
+bool
+pylith::problems::TimeDependent::getAssemblePreconditioner(void) const {
+    return _assemblePreconditioner;
+} // getAssemblePreconditioner
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set initial conditions.
 void
@@ -229,6 +352,145 @@ pylith::problems::TimeDependent::setProgressMonitor(pylith::problems::ProgressMo
 } // setProgressMonitor
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set name of checkpoint file.
+void
+pylith::problems::TimeDependent::setCheckpointFilename(const char* filename) {
+    PYLITH_COMPONENT_DEBUG("setCheckpointFilename(filename="<<filename<<")");
+
+    if (!filename || std::string(filename).empty()) {
+        throw std::runtime_error("Name of checkpoint file must not be empty.");
+    } // if
+    _checkpointFilename = filename;
+} // setCheckpointFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of checkpoint file.
+const char*
+pylith::problems::TimeDependent::getCheckpointFilename(void) const {
+    return _checkpointFilename.c_str();
+} // getCheckpointFilename
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set number of time steps between writing checkpoints.
+void
+pylith::problems::TimeDependent::setCheckpointInterval(const size_t value) {
+    PYLITH_COMPONENT_DEBUG("setCheckpointInterval(value="<<value<<")");
+
+    _checkpointInterval = value;
+} // setCheckpointInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get number of time steps between writing checkpoints.
+size_t
+pylith::problems::TimeDependent::getCheckpointInterval(void) const {
+    return _checkpointInterval;
+} // getCheckpointInterval
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for restarting from checkpoint file.
+void
+pylith::problems::TimeDependent::setRestart(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setRestart(value="<<value<<")");
+
+    _restart = value;
+} // setRestart
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag for restarting from checkpoint file.
+bool
+pylith::problems::TimeDependent::getRestart(void) const {
+    return _restart;
+} // getRestart
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for multirate explicit time stepping.
+void
+pylith::problems::TimeDependent::setMultirate(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setMultirate(value="<<value<<")");
+
+    _multirate = value;
+} // setMultirate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag for multirate explicit time stepping.
+bool
+pylith::problems::TimeDependent::getMultirate(void) const {
+    return _multirate;
+} // getMultirate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for overlapping halo exchange with residual assembly.
+void
+pylith::problems::TimeDependent::setOverlapHaloExchange(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setOverlapHaloExchange(value="<<value<<")");
+
+    _overlapHaloExchange = value;
+} // setOverlapHaloExchange
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag for overlapping halo exchange with residual assembly.
+bool
+pylith::problems::TimeDependent::getOverlapHaloExchange(void) const {
+    return _overlapHaloExchange;
+} // getOverlapHaloExchange
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for managing reuse of the preconditioner across time steps.
+void
+pylith::problems::TimeDependent::setReusePreconditioner(const bool value) {
+    PYLITH_COMPONENT_DEBUG("setReusePreconditioner(value="<<value<<")");
+
+    _reusePreconditioner = value;
+} // setReusePreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get flag for managing reuse of the preconditioner across time steps.
+bool
+pylith::problems::TimeDependent::getReusePreconditioner(void) const {
+    return _reusePreconditioner;
+} // getReusePreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set factor for growth in linear iterations that triggers rebuilding the preconditioner.
+void
+pylith::problems::TimeDependent::setPreconditionerRebuildFactor(const double value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("setPreconditionerRebuildFactor(value="<<value<<")");
+
+    if (value < 1.0) {
+        std::ostringstream msg;
+        msg << "Factor for growth in linear iterations that triggers rebuilding the preconditioner (" << value
+            << ") must be at least 1.0.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    _pcRebuildFactor = value;
+
+    PYLITH_METHOD_END;
+} // setPreconditionerRebuildFactor
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get factor for growth in linear iterations that triggers rebuilding the preconditioner.
+double
+pylith::problems::TimeDependent::getPreconditionerRebuildFactor(void) const {
+    return _pcRebuildFactor;
+} // getPreconditionerRebuildFactor
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Get Petsc DM associated with problem.
 PetscDM
@@ -284,6 +546,19 @@ pylith::problems::TimeDependent::verifyConfiguration(void) const {
         _ic[i]->verifyConfiguration(*_solution);
     } // for
 
+    if (JACOBIAN_MATRIX_FREE == _jacobianType) {
+        if (pylith::problems::Physics::QUASISTATIC != _formulation) {
+            std::ostringstream msg;
+            msg << "Matrix-free Jacobian is only supported for the quasistatic formulation.";
+            throw std::runtime_error(msg.str());
+        } // if
+        if (_interfaces.size() > 0) {
+            std::ostringstream msg;
+            msg << "Matrix-free Jacobian is not supported for problems with fault interfaces.";
+            throw std::runtime_error(msg.str());
+        } // if
+    } // if
+
     PYLITH_METHOD_END;
 } // verifyConfiguration
 
@@ -295,9 +570,24 @@ pylith::problems::TimeDependent::initialize(void) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("initialize()");
 
+    // On restart, the checkpoint supplies the auxiliary fields, so skip querying the spatial databases.
+    if (_restart) {
+        _setSkipAuxiliaryFieldDB(true);
+    } // if
     Problem::initialize();
+    if (_restart) {
+        _setSkipAuxiliaryFieldDB(false);
+        _readAuxiliaryCheckpoint();
+    } // if
 
     assert(_solution);
+    _solutionLocalState.isValid = false;
+
+    delete _logger;_logger = new pylith::utils::EventLogger;assert(_logger);
+    _logger->setClassName("TimeDependent");
+    _logger->initialize();
+    _eventSetSolutionLocal = _logger->registerEvent("Py-TimeDependent-setSolutionLocal");
+    _eventSetSolutionLocalSkipped = _logger->registerEvent("Py-TimeDependent-setSolutionLocalSkipped");
 
     PetscErrorCode err = TSDestroy(&_ts);PYLITH_CHECK_ERROR(err);assert(!_ts);
     const pylith::topology::Mesh& mesh = _solution->mesh();
@@ -360,7 +650,13 @@ pylith::problems::TimeDependent::initialize(void) {
     case pylith::problems::Physics::QUASISTATIC:
         PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks computeIFunction() and computeIJacobian().");
         err = TSSetIFunction(_ts, NULL, computeLHSResidual, (void*)this);PYLITH_CHECK_ERROR(err);
-        err = TSSetIJacobian(_ts, NULL, NULL, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        if (JACOBIAN_MATRIX_FREE == _jacobianType) {
+            _createJacobianMatrixFree();
+            PetscMat precondMat = (_precondMat) ? _precondMat : _jacobianMatrixFree;
+            err = TSSetIJacobian(_ts, _jacobianMatrixFree, precondMat, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        } else {
+            err = TSSetIJacobian(_ts, NULL, NULL, computeLHSJacobian, (void*)this);PYLITH_CHECK_ERROR(err);
+        } // if/else
         break;
     case pylith::problems::Physics::DYNAMIC_IMEX:
         PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks computeLHSJacobian() and computeLHSFunction().");
@@ -380,9 +676,78 @@ pylith::problems::TimeDependent::initialize(void) {
     } // default
     } // switch
 
+    // Avoid reassembling LHS Jacobian when only the time step changes if some integrators permit it. Integrators with
+    // Jacobians that do not change with the time step gain nothing from the split, so they do not turn it on.
+    _useJacobianSplit = false;
+    if (JACOBIAN_ASSEMBLED == _jacobianType) {
+        const size_t numIntegrators = _integrators.size();
+        for (size_t i = 0; i < numIntegrators; ++i) {
+            if (_integrators[i]->isLHSJacobianLinearInShift() &&
+                (_integrators[i]->getLHSJacobianTriggers() & pylith::feassemble::Integrator::NEW_JACOBIAN_TIME_STEP_CHANGE)) {
+                _useJacobianSplit = true;
+                break;
+            } // if
+        } // for
+    } // if
+    PYLITH_COMPONENT_DEBUG("Combining LHS Jacobian from K and M on time step change: " << _useJacobianSplit);
+
+    bool isMultirate = false;
+    if (_multirate) {
+        if (pylith::problems::Physics::DYNAMIC == _formulation) {
+            isMultirate = _setupMultirate();
+        } else {
+            PYLITH_COMPONENT_WARNING("Multirate time stepping requires the dynamic formulation. Ignoring multirate time "
+                                     "stepping.");
+        } // if/else
+    } // if
+
+    if (_overlapHaloExchange) {
+        if (isMultirate) {
+            PYLITH_COMPONENT_WARNING("Overlapping halo exchange with residual assembly is not supported with multirate "
+                                     "time stepping. Assembling residual before halo exchange.");
+            _overlapHaloExchange = false;
+        } else {
+            _overlapHaloExchange = _setupHaloOverlap();
+        } // if/else
+    } // if
+
     err = TSSetFromOptions(_ts);PYLITH_CHECK_ERROR(err);
+    if (isMultirate) {
+        _checkMultirateStability();
+    } // if
     err = TSSetUp(_ts);PYLITH_CHECK_ERROR(err);
 
+    if (_reusePreconditioner) {
+        if (pylith::problems::Physics::DYNAMIC == _formulation) {
+            PYLITH_COMPONENT_WARNING("Explicit time stepping does not use a preconditioner. Ignoring preconditioner reuse.");
+            _reusePreconditioner = false;
+        } else {
+            err = PetscLogEventGetId("PCSetUp", &_eventPCSetUp);PYLITH_CHECK_ERROR(err);
+            err = PetscLogEventGetId("KSPSolve", &_eventKSPSolve);PYLITH_CHECK_ERROR(err);
+        } // if/else
+        _pcNeedRebuild = false;
+        _pcRebuilt = false;
+        _pcRebuildIterations = 0;
+        _pcLinearIterations = 0;
+        _pcSetUpTime = 0.0;
+        _pcSolveTime = 0.0;
+    } // if
+
+    // Predictor assumes the nonlinear solve is for the solution at the end of the time step (backward Euler).
+    if (PREDICTOR_NONE != _predictor) {
+        PetscBool isBEuler = PETSC_FALSE;
+        err = PetscObjectTypeCompare((PetscObject)_ts, TSBEULER, &isBEuler);PYLITH_CHECK_ERROR(err);
+        if ((pylith::problems::Physics::QUASISTATIC == _formulation) && isBEuler) {
+            PetscSNES snes = NULL;
+            err = TSGetSNES(_ts, &snes);PYLITH_CHECK_ERROR(err);
+            err = SNESSetComputeInitialGuess(snes, computeInitialGuess, (void*)this);PYLITH_CHECK_ERROR(err);
+        } else {
+            PYLITH_COMPONENT_WARNING("Predictor requires quasistatic formulation with backward Euler time stepping. "
+                                     << "Starting nonlinear solve from solution at previous time step.");
+            _predictor = PREDICTOR_NONE;
+        } // if/else
+    } // if
+
 #if 0
     // Set solve type for solution fields defined over the domain (not Lagrange multipliers).
     PetscDS prob = NULL;
@@ -402,8 +767,18 @@ pylith::problems::TimeDependent::initialize(void) {
         PetscDSView(prob, PETSC_VIEWER_STDOUT_SELF);
     } // if
 
-    if (_shouldNotifyIC) {
+    if (_restart) {
+        _restartFromCheckpoint();
+    } else if (_shouldNotifyIC) {
         _notifyObserversInitialSoln();
+    } // if/else
+
+    if (PREDICTOR_NONE != _predictor) {
+        PylithReal t = 0.0;
+        PetscVec solutionVec = NULL;
+        err = TSGetTime(_ts, &t);PYLITH_CHECK_ERROR(err);
+        err = TSGetSolution(_ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+        _savePredictorSolution(t, solutionVec);
     } // if
 
     if (_monitor) {
@@ -421,12 +796,117 @@ pylith::problems::TimeDependent::solve(void) {
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("solve()");
 
-    PetscErrorCode err = TSSolve(_ts, NULL);PYLITH_CHECK_ERROR(err);
+    PylithInt stepStart = 0;
+    PetscErrorCode err = TSGetStepNumber(_ts, &stepStart);PYLITH_CHECK_ERROR(err);
+
+    err = TSSolve(_ts, NULL);PYLITH_CHECK_ERROR(err);
+
+    // Report iterations per time step, so the effect of the predictor is easy to assess.
+    PylithInt stepEnd = 0;
+    PetscInt numNonlinearIterations = 0;
+    PetscInt numLinearIterations = 0;
+    err = TSGetStepNumber(_ts, &stepEnd);PYLITH_CHECK_ERROR(err);
+    err = TSGetSNESIterations(_ts, &numNonlinearIterations);PYLITH_CHECK_ERROR(err);
+    err = TSGetKSPIterations(_ts, &numLinearIterations);PYLITH_CHECK_ERROR(err);
+    const PylithInt numSteps = stepEnd - stepStart;
+    if (numSteps > 0) {
+        const char* predictorNames[3] = { "none", "linear", "quadratic" };
+        PYLITH_COMPONENT_INFO("Predictor '" << predictorNames[_predictor] << "': " << numSteps << " time steps, "
+                                            << double(numNonlinearIterations) / numSteps << " nonlinear iterations per step, "
+                                            << double(numLinearIterations) / numSteps << " linear iterations per step.");
+    } // if
+
+    if (pylith::problems::Physics::QUASISTATIC == _formulation) {
+        _logJacobianPerformance();
+    } // if
 
     PYLITH_METHOD_END;
 } // solve
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Write checkpoint with current solution, auxiliary fields, time stepping state, and output trigger state.
+void
+pylith::problems::TimeDependent::checkpoint(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("checkpoint()");
+
+    assert(_ts);
+    assert(_solution);
+
+    PetscErrorCode err;
+    PylithReal t = 0.0, dt = 0.0;
+    PylithInt tindex = 0;
+    PetscVec solutionVec = NULL;
+    err = TSGetTime(_ts, &t);PYLITH_CHECK_ERROR(err);
+    err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+    err = TSGetStepNumber(_ts, &tindex);PYLITH_CHECK_ERROR(err);
+    err = TSGetSolution(_ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+    _solution->scatterVectorToLocal(solutionVec);
+
+    // Write to a temporary file, so a failure while writing does not destroy the previous checkpoint.
+    const std::string tmpFilename = _checkpointFilename + ".tmp";
+    const MPI_Comm comm = _solution->mesh().comm();
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(comm, tmpFilename.c_str(), FILE_MODE_WRITE, &viewer);PYLITH_CHECK_ERROR(err);
+
+    err = PetscViewerHDF5PushGroup(viewer, "/");PYLITH_CHECK_ERROR(err);
+    pylith::topology::FieldOps::writeCheckpoint(viewer, *_solution);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        _integrators[i]->writeCheckpoint(viewer);
+    } // for
+
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        assert(_constraints[i]);
+        _constraints[i]->writeCheckpoint(viewer);
+    } // for
+
+    // Time stepping and output trigger state are attributes of the solution dataset.
+    hid_t h5 = -1;
+    err = PetscViewerHDF5GetFileId(viewer, &h5);PYLITH_CHECK_ERROR(err);assert(h5 >= 0);
+    const std::string solutionDataset = std::string("/") + _solution->getLabel();
+    const double time = t;
+    const double timeStep = dt;
+    const int step = tindex;
+    pylith::meshio::HDF5::writeAttribute(h5, solutionDataset.c_str(), "time", (void*)&time, H5T_NATIVE_DOUBLE);
+    pylith::meshio::HDF5::writeAttribute(h5, solutionDataset.c_str(), "time_step", (void*)&timeStep, H5T_NATIVE_DOUBLE);
+    pylith::meshio::HDF5::writeAttribute(h5, solutionDataset.c_str(), "step", (void*)&step, H5T_NATIVE_INT);
+
+    std::map<std::string, PylithReal> observerStates;
+    _getObserversCheckpointState(&observerStates);
+    for (std::map<std::string, PylithReal>::const_iterator iter = observerStates.begin(); iter != observerStates.end(); ++iter) {
+        const std::string name = "output_trigger." + iter->first;
+        const double value = iter->second;
+        pylith::meshio::HDF5::writeAttribute(h5, solutionDataset.c_str(), name.c_str(), (void*)&value, H5T_NATIVE_DOUBLE);
+    } // for
+
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    int rank = 0;
+    int renameErr = 0;
+    err = MPI_Comm_rank(comm, &rank);PYLITH_CHECK_ERROR(err);
+    if (!rank) {
+        renameErr = std::rename(tmpFilename.c_str(), _checkpointFilename.c_str());
+    } // if
+    err = MPI_Bcast(&renameErr, 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+    if (renameErr) {
+        std::ostringstream msg;
+        msg << "Could not rename temporary checkpoint file '" << tmpFilename << "' to '" << _checkpointFilename << "'.";
+        PYLITH_COMPONENT_ERROR(msg.str());
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_COMPONENT_INFO("Wrote checkpoint for time step " << tindex << " to '" << _checkpointFilename << "'.");
+
+    PYLITH_METHOD_END;
+} // checkpoint
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Perform operations after advancing solution one time step.
 void
@@ -444,6 +924,10 @@ pylith::problems::TimeDependent::poststep(void) {
     err = TSGetStepNumber(_ts, &tindex);PYLITH_CHECK_ERROR(err);
     err = TSGetSolution(_ts, &solutionVec);PYLITH_CHECK_ERROR(err);
 
+    if (_reusePreconditioner) {
+        _monitorPreconditioner(tindex);
+    } // if
+
     // Update PyLith view of the solution.
     assert(_solution);
     _solution->scatterVectorToLocal(solutionVec);
@@ -461,10 +945,19 @@ pylith::problems::TimeDependent::poststep(void) {
         _constraints[i]->poststep(t, tindex, dt, *_solution);
     } // for
 
+    if (PREDICTOR_NONE != _predictor) {
+        _savePredictorSolution(t, solutionVec);
+    } // if
+
     // Notify problem observers of updated solution.
     assert(_observers);
     _observers->notifyObservers(t, tindex, *_solution);
 
+    // Checkpoint after observers, so output trigger state includes this time step.
+    if (_checkpointInterval > 0 && 0 == tindex % _checkpointInterval) {
+        checkpoint();
+    } // if
+
     if (_monitor) {
         assert(_normalizer);
         const PylithReal timeScale = _normalizer->getTimeScale();
@@ -484,17 +977,28 @@ pylith::problems::TimeDependent::setSolutionLocal(const PylithReal t,
     PYLITH_METHOD_BEGIN;
     PYLITH_COMPONENT_DEBUG("setSolutionLocal(t="<<t<<", solutionVec="<<solutionVec<<", solutionDotVec="<<solutionDotVec<<")");
 
-    // Update PyLith view of the solution.
-    assert(_solution);
-    _solution->scatterVectorToLocal(solutionVec);
-
-    if (solutionDotVec) {
-        if (!_solutionDot) {
-            _solutionDot = new pylith::topology::Field(*_solution);
-            _solutionDot->setLabel("solutionDot");
+    // PETSc often evaluates the residual and Jacobian with the same vectors, so skip scattering and setting
+    // constraints when nothing has changed. Logging the skipped calls as an event gives their count.
+    if (_isSolutionLocalCurrent(t, solutionVec, solutionDotVec)) {
+        if (_logger) {
+            _logger->eventBegin(_eventSetSolutionLocalSkipped);
+            _logger->eventEnd(_eventSetSolutionLocalSkipped);
         } // if
-        _solutionDot->scatterVectorToLocal(solutionDotVec);
+        PYLITH_METHOD_END;
     } // if
+    if (_logger) { _logger->eventBegin(_eventSetSolutionLocal); }
+
+    // Update PyLith view of the solution. The constraints must be applied to the local solution before any cells are
+    // integrated, so only the scatters of the solution and its time derivative overlap.
+    assert(_solution);
+    if (solutionDotVec && !_solutionDot) {
+        _solutionDot = new pylith::topology::Field(*_solution);
+        _solutionDot->setLabel("solutionDot");
+    } // if
+    _solution->scatterVectorToLocalBegin(solutionVec);
+    if (solutionDotVec) { _solutionDot->scatterVectorToLocalBegin(solutionDotVec); }
+    _solution->scatterVectorToLocalEnd(solutionVec);
+    if (solutionDotVec) { _solutionDot->scatterVectorToLocalEnd(solutionDotVec); }
 
     const size_t numConstraints = _constraints.size();
     for (size_t i = 0; i < numConstraints; ++i) {
@@ -506,6 +1010,9 @@ pylith::problems::TimeDependent::setSolutionLocal(const PylithReal t,
 
     // _solution->view("SOLUTION AFTER SETTING VALUES");
 
+    _saveSolutionLocalState(t, solutionVec, solutionDotVec);
+    if (_logger) { _logger->eventEnd(_eventSetSolutionLocal); }
+
     PYLITH_METHOD_END;
 } // setSolutionLocal
 
@@ -530,17 +1037,7 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscVec residualVec,
     PetscVec solutionDotVec = NULL;
     setSolutionLocal(t, solutionVec, solutionDotVec);
 
-    // Sum residual contributions across integrators.
-    _residual->zeroLocal();
-    const size_t numIntegrators = _integrators.size();
-    assert(numIntegrators > 0); // must have at least 1 integrator
-    for (size_t i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeRHSResidual(_residual, t, dt, *_solution);
-    } // for
-
-    // Assemble residual values across processes.
-    PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
-    _residual->scatterLocalToVector(residualVec, ADD_VALUES);
+    _assembleResidual(residualVec, false, t, dt);
 
     _tResidual = t;
 
@@ -569,17 +1066,7 @@ pylith::problems::TimeDependent::computeLHSResidual(PetscVec residualVec,
     // Update PyLith view of the solution.
     setSolutionLocal(t, solutionVec, solutionDotVec);
 
-    // Sum residual across integrators.
-    _residual->zeroLocal();
-    const int numIntegrators = _integrators.size();
-    assert(numIntegrators > 0); // must have at least 1 integrator
-    for (int i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeLHSResidual(_residual, t, dt, *_solution, *_solutionDot);
-    } // for
-
-    // Assemble residual values across processes.
-    PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
-    _residual->scatterLocalToVector(residualVec, ADD_VALUES);
+    _assembleResidual(residualVec, true, t, dt);
 
     _tResidual = t;
 
@@ -606,33 +1093,70 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
     assert(solutionDotVec);
     assert(s_tshift > 0);
 
+    if (JACOBIAN_MATRIX_FREE == _jacobianType) {
+        // Matrix-free action always uses the current trial solution. Only the preconditioner matrix may be reused.
+        assert(_solutionJacobianVec);
+        assert(_solutionDotJacobianVec);
+        PetscErrorCode err = VecCopy(solutionVec, _solutionJacobianVec);PYLITH_CHECK_ERROR(err);
+        err = VecCopy(solutionDotVec, _solutionDotJacobianVec);PYLITH_CHECK_ERROR(err);
+        _tJacobianAction = t;
+        _dtJacobianAction = dt;
+        _sTShiftJacobianAction = s_tshift;
+
+        if (jacobianMat == precondMat) {
+            PYLITH_COMPONENT_DEBUG("Matrix-free LHS Jacobian without preconditioner matrix; t=" << t << ", dt=" << dt);
+            _haveNewLHSJacobian = true;
+            _haveShiftOnlyLHSJacobian = false;
+            PYLITH_METHOD_END;
+        } // if
+        jacobianMat = precondMat; // Assemble only the preconditioner matrix.
+    } // if
+
     if (!_needNewJacobian(dt)) {
+        if (_useJacobianSplit && (s_tshift != _sTShiftJacobian)) {
+            PYLITH_COMPONENT_DEBUG("COMBINE LHS Jacobian; t=" << t << ", dt=" << dt);
+            _combineLHSJacobianSplit(jacobianMat, precondMat, s_tshift);
+            _haveNewLHSJacobian = true;
+            _haveShiftOnlyLHSJacobian = true;
+            _dtJacobian = dt;
+            PYLITH_METHOD_END;
+        } // if
         PYLITH_COMPONENT_DEBUG("KEEP LHS Jacobian; t=" << t << ", dt=" << dt);
         _haveNewLHSJacobian = false;
+        _haveShiftOnlyLHSJacobian = false;
         PYLITH_METHOD_END;
     } // if
     PYLITH_COMPONENT_DEBUG("NEW LHS Jacobian; t=" << t << ", dt=" << dt);
 
-    // Zero LHS Jacobian
-    PetscErrorCode err = 0;
-    PetscDS solnDS = NULL;
-    PetscBool hasJacobian = PETSC_FALSE;
-    err = DMGetDS(_solution->dmMesh(), &solnDS);PYLITH_CHECK_ERROR(err);
-    err = PetscDSHasJacobian(solnDS, &hasJacobian);PYLITH_CHECK_ERROR(err);
-    if (hasJacobian) { err = MatZeroEntries(jacobianMat);PYLITH_CHECK_ERROR(err); }
-    err = MatZeroEntries(precondMat);PYLITH_CHECK_ERROR(err);
-
-    // Update PyLith view of the solution.
-    setSolutionLocal(t, solutionVec, solutionDotVec);
-
-    // Sum Jacobian contributions across integrators.
-    const size_t numIntegrators = _integrators.size();
-    for (size_t i = 0; i < numIntegrators; ++i) {
-        _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, t, dt, s_tshift, *_solution, *_solutionDot);
-    } // for
+    if (_useJacobianSplit) {
+        // Update PyLith view of the solution.
+        setSolutionLocal(t, solutionVec, solutionDotVec);
+
+        _computeLHSJacobianSplit(t, dt);
+        _combineLHSJacobianSplit(jacobianMat, precondMat, s_tshift);
+    } else {
+        // Zero LHS Jacobian
+        PetscErrorCode err = 0;
+        PetscDS solnDS = NULL;
+        PetscBool hasJacobian = PETSC_FALSE;
+        err = DMGetDS(_solution->dmMesh(), &solnDS);PYLITH_CHECK_ERROR(err);
+        err = PetscDSHasJacobian(solnDS, &hasJacobian);PYLITH_CHECK_ERROR(err);
+        if (hasJacobian) { err = MatZeroEntries(jacobianMat);PYLITH_CHECK_ERROR(err); }
+        err = MatZeroEntries(precondMat);PYLITH_CHECK_ERROR(err);
+
+        // Update PyLith view of the solution.
+        setSolutionLocal(t, solutionVec, solutionDotVec);
+
+        // Sum Jacobian contributions across integrators.
+        const size_t numIntegrators = _integrators.size();
+        for (size_t i = 0; i < numIntegrators; ++i) {
+            _integrators[i]->computeLHSJacobian(jacobianMat, precondMat, t, dt, s_tshift, *_solution, *_solutionDot);
+        } // for
+    } // if/else
 
     _needNewLHSJacobian = false;
     _haveNewLHSJacobian = true;
+    _haveShiftOnlyLHSJacobian = false;
     _dtJacobian = dt;
 
     // Solver handles assembly.
@@ -641,6 +1165,48 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscMat jacobianMat,
 } // computeLHSJacobian
 
 
+// ----------------------------------------------------------------------
+// Compute action of LHS Jacobian for F(t,s,\dot{s}) for matrix-free implicit time stepping.
+void
+pylith::problems::TimeDependent::computeLHSJacobianAction(PetscVec actionVec,
+                                                          PetscVec inputVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("TimeDependent::computeLHSJacobianAction(actionVec="<<actionVec<<", inputVec="<<inputVec<<")");
+
+    assert(actionVec);
+    assert(inputVec);
+    assert(_solution);
+    assert(_jacobianAction);
+
+    // Update PyLith view of the solution at which the Jacobian is evaluated.
+    setSolutionLocal(_tJacobianAction, _solutionJacobianVec, _solutionDotJacobianVec);
+
+    // Constrained degrees of freedom do not appear in the global vector, so they must be zero in the local input.
+    PetscErrorCode err;
+    PetscDM dmSoln = _solution->dmMesh();assert(dmSoln);
+    PetscVec inputLocalVec = NULL;
+    err = DMGetLocalVector(dmSoln, &inputLocalVec);PYLITH_CHECK_ERROR(err);
+    err = VecSet(inputLocalVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalBegin(dmSoln, inputVec, INSERT_VALUES, inputLocalVec);PYLITH_CHECK_ERROR(err);
+    err = DMGlobalToLocalEnd(dmSoln, inputVec, INSERT_VALUES, inputLocalVec);PYLITH_CHECK_ERROR(err);
+
+    // Sum action across integrators.
+    _jacobianAction->zeroLocal();
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->computeLHSJacobianAction(_jacobianAction, _tJacobianAction, _dtJacobianAction,
+                                                  _sTShiftJacobianAction, *_solution, *_solutionDot, inputLocalVec);
+    } // for
+    err = DMRestoreLocalVector(dmSoln, &inputLocalVec);PYLITH_CHECK_ERROR(err);
+
+    // Assemble action across processes.
+    err = VecSet(actionVec, 0.0);PYLITH_CHECK_ERROR(err);
+    _jacobianAction->scatterLocalToVector(actionVec, ADD_VALUES);
+
+    PYLITH_METHOD_END;
+} // computeLHSJacobianAction
+
+
 // ----------------------------------------------------------------------
 // Compute inverse of LHS Jacobian for F(t,s,\dot{s}) for explicit time stepping.
 void
@@ -723,6 +1289,57 @@ pylith::problems::TimeDependent::computeRHSResidual(PetscTS ts,
 } // computeRHSResidual
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing residual for RHS, G(t,s), for degrees of freedom advanced at the slow rate.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualSlow(PetscTS ts,
+                                                        PetscReal t,
+                                                        PetscVec solutionVec,
+                                                        PetscVec residualVec,
+                                                        void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeRHSResidualSlow(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;
+
+    // Time step of the slow rate is the time step of the multirate time stepper, not the one for the split.
+    PylithReal dt;
+    PetscErrorCode err = TSGetTimeStep(problem->_ts, &dt);PYLITH_CHECK_ERROR(err);
+
+    const bool isFast = false;
+    problem->_computeRHSResidualMultirate(residualVec, isFast, t, dt, solutionVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualSlow
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for computing residual for RHS, G(t,s), for degrees of freedom advanced at the fast rate.
+PetscErrorCode
+pylith::problems::TimeDependent::computeRHSResidualFast(PetscTS ts,
+                                                        PetscReal t,
+                                                        PetscVec solutionVec,
+                                                        PetscVec residualVec,
+                                                        void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeRHSResidualFast(ts="<<ts<<", t="<<t<<", solutionVec="<<solutionVec<<", residualVec="<<residualVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;
+
+    PylithReal dt;
+    PetscErrorCode err = TSGetTimeStep(problem->_ts, &dt);PYLITH_CHECK_ERROR(err);
+
+    const bool isFast = true;
+    problem->_computeRHSResidualMultirate(residualVec, isFast, t, dt, solutionVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeRHSResidualFast
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Callback static method for computing residual for LHS, F(t,s,\dot{s}).
 PetscErrorCode
@@ -771,11 +1388,31 @@ pylith::problems::TimeDependent::computeLHSJacobian(PetscTS ts,
 
     pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;
     problem->computeLHSJacobian(jacobianMat, precondMat, t, dt, s_tshift, solutionVec, solutionDotVec);
+    problem->_setPreconditionerReuse(precondMat);
 
     PYLITH_METHOD_RETURN(0);
 } // computeLHSJacobian
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Callback static method for action of LHS Jacobian (MatMult of PETSc MatShell).
+PetscErrorCode
+pylith::problems::TimeDependent::computeLHSJacobianAction(PetscMat jacobianMat,
+                                                          PetscVec inputVec,
+                                                          PetscVec actionVec) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeLHSJacobianAction(jacobianMat="<<jacobianMat<<", inputVec="<<inputVec<<", actionVec="<<actionVec<<")" << pythia::journal::endl;
+
+    TimeDependent* problem = NULL;
+    PetscErrorCode err = MatShellGetContext(jacobianMat, (void*)&problem);PYLITH_CHECK_ERROR(err);assert(problem);
+    problem->computeLHSJacobianAction(actionVec, inputVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeLHSJacobianAction
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Callback static method for operations after advancing solution one time step.
 PetscErrorCode
@@ -794,9 +1431,27 @@ pylith::problems::TimeDependent::poststep(PetscTS ts) {
 
 
 // ---------------------------------------------------------------------------------------------------------------------
-// Check whether we need to reform the Jacobian.
-bool
-pylith::problems::TimeDependent::_needNewJacobian(const PylithReal dt) {
+// Callback static method for computing initial guess for nonlinear solve by extrapolating previous solutions.
+PetscErrorCode
+pylith::problems::TimeDependent::computeInitialGuess(PetscSNES snes,
+                                                     PetscVec solutionVec,
+                                                     void* context) {
+    PYLITH_METHOD_BEGIN;
+    pythia::journal::debug_t debug(_TimeDependent::pyreComponent);
+    debug << pythia::journal::at(__HERE__)
+          << "computeInitialGuess(snes="<<snes<<", solutionVec="<<solutionVec<<", context="<<context<<")" << pythia::journal::endl;
+
+    pylith::problems::TimeDependent* problem = (pylith::problems::TimeDependent*)context;assert(problem);
+    problem->_predictSolution(solutionVec);
+
+    PYLITH_METHOD_RETURN(0);
+} // computeInitialGuess
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether we need to reform the Jacobian.
+bool
+pylith::problems::TimeDependent::_needNewJacobian(const PylithReal dt) {
     PYLITH_METHOD_BEGIN;
 
     // If we already know we need to recompute the LHS Jacobian, then return true.
@@ -806,7 +1461,9 @@ pylith::problems::TimeDependent::_needNewJacobian(const PylithReal dt) {
     const size_t numIntegrators = _integrators.size();
 
     for (size_t i = 0; i < numIntegrators; ++i) {
-        if (_integrators[i]->needNewLHSJacobian(dtChanged)) {
+        // Time step changes are handled by combining K and M for Jacobians that depend on time step only via s_tshift.
+        const bool dtChangedJacobian = (_useJacobianSplit && _integrators[i]->isLHSJacobianLinearInShift()) ? false : dtChanged;
+        if (_integrators[i]->needNewLHSJacobian(dtChangedJacobian)) {
             _needNewLHSJacobian = true;
             break;
         } // if
@@ -816,6 +1473,779 @@ pylith::problems::TimeDependent::_needNewJacobian(const PylithReal dt) {
 } // _needNewJacobian
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Set whether the linear solver reuses the current preconditioner with the LHS Jacobian.
+void
+pylith::problems::TimeDependent::_setPreconditionerReuse(PetscMat precondMat) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setPreconditionerReuse(precondMat="<<precondMat<<")");
+
+    if (!_reusePreconditioner) { PYLITH_METHOD_END; }
+
+    assert(_ts);
+    assert(precondMat);
+    PetscErrorCode err;
+    PetscSNES snes = NULL;
+    PetscKSP ksp = NULL;
+    err = TSGetSNES(_ts, &snes);PYLITH_CHECK_ERROR(err);
+    err = SNESGetKSP(snes, &ksp);PYLITH_CHECK_ERROR(err);
+
+    const bool isReformed = _haveNewLHSJacobian && !_haveShiftOnlyLHSJacobian;
+    const bool rebuild = isReformed || _pcNeedRebuild;
+    if (rebuild && !_haveNewLHSJacobian) {
+        // PETSc only sets up the preconditioner again if the matrix has changed.
+        err = PetscObjectStateIncrease((PetscObject)precondMat);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = KSPSetReusePreconditioner(ksp, rebuild ? PETSC_FALSE : PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+    if (rebuild) {
+        _pcNeedRebuild = false;
+        _pcRebuilt = true;
+    } // if
+    PYLITH_COMPONENT_DEBUG((rebuild ? "REBUILD" : "REUSE") << " preconditioner.");
+
+    PYLITH_METHOD_END;
+} // _setPreconditionerReuse
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check linear iterations in time step and report preconditioner setup and solve time.
+void
+pylith::problems::TimeDependent::_monitorPreconditioner(const PylithInt tindex) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_monitorPreconditioner(tindex="<<tindex<<")");
+
+    assert(_ts);
+    PetscErrorCode err;
+    PetscInt numIterations = 0;
+    err = TSGetKSPIterations(_ts, &numIterations);PYLITH_CHECK_ERROR(err);
+    const PylithInt stepIterations = numIterations - _pcLinearIterations;
+    _pcLinearIterations = numIterations;
+
+    // Iteration count with the preconditioner when it was built is the reference for later time steps.
+    if (_pcRebuilt) {
+        _pcRebuildIterations = stepIterations;
+    } else if ((_pcRebuildIterations > 0) && (stepIterations > _pcRebuildFactor * _pcRebuildIterations)) {
+        _pcNeedRebuild = true;
+    } // if/else
+
+    // Times are accumulated by PETSc logging, so they are zero unless logging is active (for example, -log_view).
+    PetscEventPerfInfo setUpInfo, solveInfo;
+    err = PetscLogEventGetPerfInfo(PETSC_DETERMINE, _eventPCSetUp, &setUpInfo);PYLITH_CHECK_ERROR(err);
+    err = PetscLogEventGetPerfInfo(PETSC_DETERMINE, _eventKSPSolve, &solveInfo);PYLITH_CHECK_ERROR(err);
+    const PylithReal stepSetUpTime = setUpInfo.time - _pcSetUpTime;
+    const PylithReal stepSolveTime = solveInfo.time - _pcSolveTime;
+    _pcSetUpTime = setUpInfo.time;
+    _pcSolveTime = solveInfo.time;
+
+    PYLITH_COMPONENT_INFO("Time step " << tindex << ": " << stepIterations << " linear iterations with "
+                                       << (_pcRebuilt ? "new" : "reused") << " preconditioner, PCSetUp "
+                                       << stepSetUpTime << " s, KSPSolve " << stepSolveTime << " s."
+                                       << (_pcNeedRebuild ? " Rebuilding preconditioner at next time step." : ""));
+    _pcRebuilt = false;
+
+    PYLITH_METHOD_END;
+} // _monitorPreconditioner
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Bin cells by stable time step and set up RHS splits for multirate explicit time stepping.
+bool
+pylith::problems::TimeDependent::_setupMultirate(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupMultirate()");
+
+    assert(_solution);
+    assert(_normalizer);
+    assert(_ts);
+
+    PetscErrorCode err;
+    PetscDM dmSoln = _solution->dmMesh();assert(dmSoln);
+    const MPI_Comm comm = _solution->mesh().comm();
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmSoln, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(0 == pStart);
+
+    // Cells that are unstable with the initial time step are advanced at the fast rate.
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    const PylithReal dtSlow = _dtInitial / timeScale;
+    pylith::int_array fastPoints(PylithInt(0), pEnd - pStart);
+    PylithReal dtStableLocal = pylith::PYLITH_MAXSCALAR;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        dtStableLocal = std::min(dtStableLocal, _integrators[i]->markMultirateFastPoints(&fastPoints, dtSlow, *_solution));
+    } // for
+
+    // Points shared across processes must be in the same bin on every process.
+    PetscSF sf = NULL;
+    err = DMGetPointSF(dmSoln, &sf);PYLITH_CHECK_ERROR(err);
+    PetscInt numRoots = -1;
+    err = PetscSFGetGraph(sf, &numRoots, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+    if ((numRoots >= 0) && (pEnd > pStart)) {
+        pylith::int_array rootPoints(fastPoints);
+        err = PetscSFReduceBegin(sf, MPIU_INT, &fastPoints[0], &rootPoints[0], MPI_MAX);PYLITH_CHECK_ERROR(err);
+        err = PetscSFReduceEnd(sf, MPIU_INT, &fastPoints[0], &rootPoints[0], MPI_MAX);PYLITH_CHECK_ERROR(err);
+        fastPoints = rootPoints;
+        err = PetscSFBcastBegin(sf, MPIU_INT, &rootPoints[0], &fastPoints[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+        err = PetscSFBcastEnd(sf, MPIU_INT, &rootPoints[0], &fastPoints[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    // Geometry cached for the cells in each bin is charged against what remains of the budget.
+    size_t geometryCacheAvailable = _getGeometryCacheAvailable();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        const size_t geometryCacheSize = _integrators[i]->getGeometryCacheSize();
+        _integrators[i]->setGeometryCacheBudget(geometryCacheSize + geometryCacheAvailable);
+        _integrators[i]->setMultirateFastPoints(fastPoints, *_solution);
+        geometryCacheAvailable += geometryCacheSize;
+        geometryCacheAvailable -= _integrators[i]->getGeometryCacheSize();
+    } // for
+
+    // Split degrees of freedom owned by this process into the slow and fast bins.
+    PetscSection globalSection = _solution->globalSection();assert(globalSection);
+    std::vector<PetscInt> indicesSlow;
+    std::vector<PetscInt> indicesFast;
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        PetscInt dof = 0, cdof = 0, off = 0;
+        err = PetscSectionGetDof(globalSection, point, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; } // Not owned by this process.
+        err = PetscSectionGetConstraintDof(globalSection, point, &cdof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(globalSection, point, &off);PYLITH_CHECK_ERROR(err);
+        std::vector<PetscInt>& indices = fastPoints[point-pStart] ? indicesFast : indicesSlow;
+        for (PetscInt iDof = 0; iDof < dof-cdof; ++iDof) {
+            indices.push_back(off+iDof);
+        } // for
+    } // for
+
+    PetscInt numDOFLocal[2] = { PetscInt(indicesSlow.size()), PetscInt(indicesFast.size()) };
+    PetscInt numDOF[2] = { 0, 0 };
+    err = MPI_Allreduce(numDOFLocal, numDOF, 2, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    PylithReal dtStable = 0.0;
+    err = MPI_Allreduce(&dtStableLocal, &dtStable, 1, MPIU_REAL, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+    _dtStableMultirate = dtStable;
+
+    if (!numDOF[1]) {
+        PYLITH_COMPONENT_INFO("Multirate time stepping: All cells are stable with the initial time step of "
+                              << _dtInitial << " s, so all degrees of freedom use the same time step.");
+        for (size_t i = 0; i < numIntegrators; ++i) {
+            _integrators[i]->setMultirateBin(pylith::feassemble::Integrator::MULTIRATE_ALL);
+        } // for
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    PYLITH_COMPONENT_INFO("Multirate time stepping: " << numDOF[1] << " of " << numDOF[0]+numDOF[1]
+                          << " degrees of freedom advance at the fast rate. Minimum stable time step is "
+                          << dtStable*timeScale << " s and slow time step is " << _dtInitial << " s.");
+
+    err = TSSetType(_ts, TSMPRK);PYLITH_CHECK_ERROR(err);
+
+    PetscIS isSlow = NULL;
+    PetscIS isFast = NULL;
+    err = ISCreateGeneral(comm, indicesSlow.size(), indicesSlow.size() ? &indicesSlow[0] : NULL, PETSC_COPY_VALUES,
+                          &isSlow);PYLITH_CHECK_ERROR(err);
+    err = ISCreateGeneral(comm, indicesFast.size(), indicesFast.size() ? &indicesFast[0] : NULL, PETSC_COPY_VALUES,
+                          &isFast);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetIS(_ts, "slow", isSlow);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetIS(_ts, "fast", isFast);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&isSlow);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&isFast);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_COMPONENT_DEBUG("Setting PetscTS callbacks computeRHSResidualSlow() and computeRHSResidualFast().");
+    err = TSRHSSplitSetRHSFunction(_ts, "slow", NULL, computeRHSResidualSlow, (void*)this);PYLITH_CHECK_ERROR(err);
+    err = TSRHSSplitSetRHSFunction(_ts, "fast", NULL, computeRHSResidualFast, (void*)this);PYLITH_CHECK_ERROR(err);
+
+    err = VecDestroy(&_residualMultirateVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(_solution->globalVector(), &_residualMultirateVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(true);
+} // _setupMultirate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check that the fast rate of the multirate method is stable for the fast cells.
+void
+pylith::problems::TimeDependent::_checkMultirateStability(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_checkMultirateStability()");
+
+    assert(_ts);
+    assert(_normalizer);
+
+    PetscErrorCode err;
+    TSMPRKType mprkType = NULL;
+    PylithReal dt = 0.0;
+    err = TSMPRKGetType(_ts, &mprkType);PYLITH_CHECK_ERROR(err);
+    err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+    const std::string typeName = (mprkType) ? mprkType : "";
+
+    // Ratio of the slow and fast rates (refinement factor of the time step) is fixed by the method.
+    int rateRatio = 0;
+    if (typeName == TSMPRK2A22) {
+        rateRatio = 2;
+    } else if (typeName == TSMPRK2A32) {
+        rateRatio = 3;
+    } else {
+        std::ostringstream msg;
+        msg << "Multirate time stepping with slow and fast rates requires ts_mprk_type of '" << TSMPRK2A22 << "' or '"
+            << TSMPRK2A32 << "', not '" << typeName << "'.";
+        throw std::runtime_error(msg.str());
+    } // if/else
+
+    const PylithReal timeScale = _normalizer->getTimeScale();
+    const PylithReal dtFast = dt / rateRatio;
+    PYLITH_COMPONENT_INFO("Multirate time stepping: Method '" << typeName << "' advances the fast rate with time step "
+                                                              << dtFast*timeScale << " s.");
+    if (dtFast > _dtStableMultirate) {
+        std::ostringstream msg;
+        msg << "Time step at fast rate (" << dtFast*timeScale << " s) of multirate method '" << typeName
+            << "' exceeds the minimum stable time step (" << _dtStableMultirate*timeScale << " s). Reduce the "
+            << "initial time step to at most " << rateRatio*_dtStableMultirate*timeScale << " s or use a method "
+            << "with a larger ratio of the slow and fast rates.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    PYLITH_METHOD_END;
+} // _checkMultirateStability
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Split cells and degrees of freedom by whether they touch points shared with other processes.
+bool
+pylith::problems::TimeDependent::_setupHaloOverlap(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setupHaloOverlap()");
+
+    assert(_solution);
+    assert(_residual);
+
+    PetscErrorCode err;
+    const MPI_Comm comm = _solution->mesh().comm();
+    int commSize = 0;
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+    if (1 == commSize) {
+        PYLITH_COMPONENT_INFO("Overlapping halo exchange with residual assembly requires more than one process.");
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscDM dmSoln = _solution->dmMesh();assert(dmSoln);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmSoln, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(0 == pStart);
+
+    // Points are shared if they are ghosts on this process or have ghosts on other processes.
+    pylith::int_array sharedPoints(PylithInt(0), pEnd - pStart);
+    PetscSF sf = NULL;
+    err = DMGetPointSF(dmSoln, &sf);PYLITH_CHECK_ERROR(err);
+    PetscInt numRoots = -1, numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = PetscSFGetGraph(sf, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    if (numRoots >= 0) {
+        for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+            const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+            sharedPoints[point-pStart] = 1;
+        } // for
+        const PetscInt* rootDegree = NULL;
+        err = PetscSFComputeDegreeBegin(sf, &rootDegree);PYLITH_CHECK_ERROR(err);
+        err = PetscSFComputeDegreeEnd(sf, &rootDegree);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = pStart; point < pStart+numRoots; ++point) {
+            if (rootDegree[point-pStart] > 0) { sharedPoints[point-pStart] = 1; }
+        } // for
+    } // if
+
+    _setHaloSharedPoints(sharedPoints);
+
+    PYLITH_METHOD_RETURN(true);
+} // _setupHaloOverlap
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Split cells and degrees of freedom into those with and without points shared with other processes.
+void
+pylith::problems::TimeDependent::_setHaloSharedPoints(const pylith::int_array& sharedPoints) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setHaloSharedPoints(sharedPoints="<<&sharedPoints<<")");
+
+    assert(_solution);
+    assert(_residual);
+
+    PetscErrorCode err;
+    const MPI_Comm comm = _solution->mesh().comm();
+    PetscDM dmSoln = _solution->dmMesh();assert(dmSoln);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmSoln, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    assert(sharedPoints.size() == size_t(pEnd - pStart));
+
+    // Cached geometry for the split is charged against what remains of the budget.
+    size_t geometryCacheAvailable = _getGeometryCacheAvailable();
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        const size_t geometryCacheSize = _integrators[i]->getGeometryCacheSize();
+        _integrators[i]->setGeometryCacheBudget(geometryCacheSize + geometryCacheAvailable);
+        _integrators[i]->setHaloSharedPoints(sharedPoints, *_solution);
+        geometryCacheAvailable += geometryCacheSize;
+        geometryCacheAvailable -= _integrators[i]->getGeometryCacheSize();
+    } // for
+
+    // Points that are not shared are owned by this process, so their residual goes directly from the local vector to
+    // the global vector. Constrained degrees of freedom are not in the global vector.
+    PetscSection localSection = _solution->localSection();assert(localSection);
+    PetscSection globalSection = _solution->globalSection();assert(globalSection);
+    _haloInteriorLocalIndices.clear();
+    _haloInteriorGlobalIndices.clear();
+    for (PetscInt point = pStart; point < pEnd; ++point) {
+        if (sharedPoints[point-pStart]) { continue; }
+        PetscInt dof = 0, cdof = 0, off = 0, goff = 0;
+        err = PetscSectionGetDof(localSection, point, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; }
+        err = PetscSectionGetConstraintDof(localSection, point, &cdof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(localSection, point, &off);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(globalSection, point, &goff);PYLITH_CHECK_ERROR(err);
+        assert(goff >= 0);
+        const PetscInt* constraintIndices = NULL;
+        if (cdof > 0) {
+            err = PetscSectionGetConstraintIndices(localSection, point, &constraintIndices);PYLITH_CHECK_ERROR(err);
+        } // if
+        for (PetscInt iDof = 0, iConstraint = 0, iGlobal = 0; iDof < dof; ++iDof) {
+            if ((iConstraint < cdof) && (constraintIndices[iConstraint] == iDof)) {
+                ++iConstraint;
+                continue;
+            } // if
+            _haloInteriorLocalIndices.push_back(off+iDof);
+            _haloInteriorGlobalIndices.push_back(goff+iGlobal++);
+        } // for
+    } // for
+
+    delete _residualInterior;_residualInterior = new pylith::topology::Field(*_residual);assert(_residualInterior);
+    _residualInterior->setLabel("residual_interior");
+
+    PetscInt numDOFLocal[2] = { PetscInt(_haloInteriorLocalIndices.size()), 0 };
+    err = VecGetLocalSize(_solution->globalVector(), &numDOFLocal[1]);PYLITH_CHECK_ERROR(err);
+    PetscInt numDOF[2] = { 0, 0 };
+    err = MPI_Allreduce(numDOFLocal, numDOF, 2, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+    PYLITH_COMPONENT_INFO("Overlapping halo exchange with residual assembly: " << numDOF[0] << " of " << numDOF[1]
+                          << " degrees of freedom are not shared across processes.");
+
+    PYLITH_METHOD_END;
+} // _setHaloSharedPoints
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute residual contributions from integrators and add them to the global residual.
+void
+pylith::problems::TimeDependent::_assembleResidual(PetscVec residualVec,
+                                                   const bool isLHS,
+                                                   const PylithReal t,
+                                                   const PylithReal dt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_assembleResidual(residualVec="<<residualVec<<", isLHS="<<isLHS<<", t="<<t<<", dt="<<dt<<")");
+
+    assert(residualVec);
+    assert(_residual);
+
+    PetscErrorCode err = VecSet(residualVec, 0.0);PYLITH_CHECK_ERROR(err);
+    if (!_overlapHaloExchange) {
+        _integrateResidual(_residual, isLHS, t, dt, false);
+        _residual->scatterLocalToVector(residualVec, ADD_VALUES);
+        PYLITH_METHOD_END;
+    } // if
+
+    // Communicate contributions from cells with shared points while integrating the interior cells.
+    assert(_residualInterior);
+    _integrateResidual(_residual, isLHS, t, dt, false);
+    _residual->scatterLocalToVectorBegin(residualVec, ADD_VALUES);
+    _integrateResidual(_residualInterior, isLHS, t, dt, true);
+    _residual->scatterLocalToVectorEnd(residualVec, ADD_VALUES);
+
+    // Interior cells only touch points owned by this process, so their contributions need no communication.
+    PetscInt rowStart = 0;
+    err = VecGetOwnershipRange(residualVec, &rowStart, NULL);PYLITH_CHECK_ERROR(err);
+    const PetscScalar* interiorArray = NULL;
+    PetscScalar* residualArray = NULL;
+    err = VecGetArrayRead(_residualInterior->localVector(), &interiorArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(residualVec, &residualArray);PYLITH_CHECK_ERROR(err);
+    const size_t numIndices = _haloInteriorLocalIndices.size();
+    for (size_t i = 0; i < numIndices; ++i) {
+        residualArray[_haloInteriorGlobalIndices[i]-rowStart] += interiorArray[_haloInteriorLocalIndices[i]];
+    } // for
+    err = VecRestoreArray(residualVec, &residualArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArrayRead(_residualInterior->localVector(), &interiorArray);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _assembleResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Sum residual contributions from integrators in local residual.
+void
+pylith::problems::TimeDependent::_integrateResidual(pylith::topology::Field* residual,
+                                                    const bool isLHS,
+                                                    const PylithReal t,
+                                                    const PylithReal dt,
+                                                    const bool interiorCells) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_integrateResidual(residual="<<residual<<", isLHS="<<isLHS<<", t="<<t<<", dt="<<dt<<", interiorCells="<<interiorCells<<")");
+
+    assert(residual);
+    assert(_solution);
+
+    typedef pylith::feassemble::Integrator Integrator;
+    const Integrator::HaloPart haloPart = !_overlapHaloExchange ? Integrator::HALO_ALL :
+                                          interiorCells ? Integrator::HALO_INTERIOR : Integrator::HALO_BOUNDARY;
+    residual->zeroLocal();
+    const size_t numIntegrators = _integrators.size();
+    assert(numIntegrators > 0); // must have at least 1 integrator
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        // Integrators without separate interior cells integrate all of their cells with the boundary cells.
+        if (interiorCells && !_integrators[i]->hasHaloInteriorCells()) { continue; }
+
+        _integrators[i]->setHaloPart(haloPart);
+        if (isLHS) {
+            assert(_solutionDot);
+            _integrators[i]->computeLHSResidual(residual, t, dt, *_solution, *_solutionDot);
+        } else {
+            _integrators[i]->computeRHSResidual(residual, t, dt, *_solution);
+        } // if/else
+        _integrators[i]->setHaloPart(Integrator::HALO_ALL);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _integrateResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute RHS residual, M^{-1} G(t,s), for degrees of freedom advanced at one rate.
+void
+pylith::problems::TimeDependent::_computeRHSResidualMultirate(PetscVec residualVec,
+                                                              const bool isFast,
+                                                              const PylithReal t,
+                                                              const PylithReal dt,
+                                                              PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_computeRHSResidualMultirate(residualVec="<<residualVec<<", isFast="<<isFast<<", t="<<t<<", dt="<<dt<<", solutionVec="<<solutionVec<<")");
+
+    assert(_residualMultirateVec);
+    assert(_jacobianLHSLumpedInv);
+
+    // Integrate only cells contributing to degrees of freedom in this bin.
+    const pylith::feassemble::Integrator::MultirateBin bin = isFast ?
+                                                             pylith::feassemble::Integrator::MULTIRATE_FAST :
+                                                             pylith::feassemble::Integrator::MULTIRATE_SLOW;
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->setMultirateBin(bin);
+    } // for
+    computeRHSResidual(_residualMultirateVec, t, dt, solutionVec);
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->setMultirateBin(pylith::feassemble::Integrator::MULTIRATE_ALL);
+    } // for
+
+    // Multiply RHS, G(t,s), by M^{-1}. Lumped LHS Jacobian covers all cells and is only recomputed when needed.
+    const PylithReal s_tshift = 1.0; // Keep shift terms on LHS, so use 1.0 for terms moved to RHS.
+    computeLHSJacobianLumpedInv(t, dt, s_tshift, solutionVec);
+    PetscErrorCode err = VecPointwiseMult(_residualMultirateVec, _jacobianLHSLumpedInv->globalVector(),
+                                          _residualMultirateVec);PYLITH_CHECK_ERROR(err);
+
+    PetscIS splitIS = NULL;
+    err = TSRHSSplitGetIS(_ts, isFast ? "fast" : "slow", &splitIS);PYLITH_CHECK_ERROR(err);assert(splitIS);
+    PetscVec splitVec = NULL;
+    err = VecGetSubVector(_residualMultirateVec, splitIS, &splitVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(splitVec, residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreSubVector(_residualMultirateVec, splitIS, &splitVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _computeRHSResidualMultirate
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create PETSc MatShell for matrix-free Jacobian and, if requested, sparse matrix for preconditioner.
+void
+pylith::problems::TimeDependent::_createJacobianMatrixFree(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createJacobianMatrixFree()");
+
+    assert(_solution);
+
+    PetscErrorCode err;
+    PetscVec solutionVec = _solution->globalVector();assert(solutionVec);
+    PetscInt sizeLocal = 0;
+    PetscInt sizeGlobal = 0;
+    err = VecGetLocalSize(solutionVec, &sizeLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(solutionVec, &sizeGlobal);PYLITH_CHECK_ERROR(err);
+
+    err = MatDestroy(&_jacobianMatrixFree);PYLITH_CHECK_ERROR(err);
+    err = MatCreateShell(_solution->mesh().comm(), sizeLocal, sizeLocal, sizeGlobal, sizeGlobal, (void*)this,
+                         &_jacobianMatrixFree);PYLITH_CHECK_ERROR(err);
+    err = MatShellSetOperation(_jacobianMatrixFree, MATOP_MULT, (void (*)(void))computeLHSJacobianAction);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)_jacobianMatrixFree, "Jacobian_matrix_free");PYLITH_CHECK_ERROR(err);
+
+    err = MatDestroy(&_precondMat);PYLITH_CHECK_ERROR(err);
+    if (_assemblePreconditioner) {
+        _createPreconditionerBlockDiagonal();
+    } // if
+
+    err = VecDestroy(&_solutionJacobianVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &_solutionJacobianVec);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_solutionDotJacobianVec);PYLITH_CHECK_ERROR(err);
+    err = VecDuplicate(solutionVec, &_solutionDotJacobianVec);PYLITH_CHECK_ERROR(err);
+
+    delete _jacobianAction;_jacobianAction = new pylith::topology::Field(*_solution);assert(_jacobianAction);
+    _jacobianAction->setLabel("Jacobian_action");
+
+    PYLITH_METHOD_END;
+} // _createJacobianMatrixFree
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Create sparse matrix for preconditioner holding only the diagonal block of each point.
+void
+pylith::problems::TimeDependent::_createPreconditionerBlockDiagonal(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_createPreconditionerBlockDiagonal()");
+
+    assert(_solution);
+
+    PetscErrorCode err;
+    PetscDM dmSoln = _solution->dmMesh();assert(dmSoln);
+    PetscSection globalSection = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    PetscInt sizeLocal = 0, sizeGlobal = 0, rowStart = 0;
+    err = DMGetGlobalSection(dmSoln, &globalSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetChart(globalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(_solution->globalVector(), &sizeLocal);PYLITH_CHECK_ERROR(err);
+    err = VecGetSize(_solution->globalVector(), &sizeGlobal);PYLITH_CHECK_ERROR(err);
+    err = VecGetOwnershipRange(_solution->globalVector(), &rowStart, NULL);PYLITH_CHECK_ERROR(err);
+
+    // Each row couples only to the unconstrained degrees of freedom of its own point, so the memory is a small
+    // fraction of the assembled Jacobian.
+    pylith::int_array nnz(0, sizeLocal);
+    pylith::int_array onnz(0, sizeLocal);
+    PetscInt maxBlockSize = 0;
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        PetscInt dof = 0, cdof = 0, off = 0;
+        err = PetscSectionGetDof(globalSection, p, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; } // Point not owned by this process.
+        err = PetscSectionGetConstraintDof(globalSection, p, &cdof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(globalSection, p, &off);PYLITH_CHECK_ERROR(err);
+        const PetscInt blockSize = dof - cdof;
+        for (PetscInt i = 0; i < blockSize; ++i) {
+            nnz[off-rowStart+i] = blockSize;
+        } // for
+        maxBlockSize = std::max(maxBlockSize, blockSize);
+    } // for
+
+    err = MatCreate(_solution->mesh().comm(), &_precondMat);PYLITH_CHECK_ERROR(err);
+    err = MatSetSizes(_precondMat, sizeLocal, sizeLocal, sizeGlobal, sizeGlobal);PYLITH_CHECK_ERROR(err);
+    err = MatSetType(_precondMat, MATAIJ);PYLITH_CHECK_ERROR(err);
+    err = MatXAIJSetPreallocation(_precondMat, 1, sizeLocal ? &nnz[0] : NULL, sizeLocal ? &onnz[0] : NULL,
+                                  NULL, NULL);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)_precondMat, "Preconditioner_block_diagonal");PYLITH_CHECK_ERROR(err);
+
+    // Insert the nonzero pattern; afterwards entries outside the diagonal blocks are dropped during assembly.
+    pylith::int_array indices(maxBlockSize);
+    pylith::scalar_array zeros(0.0, maxBlockSize*maxBlockSize);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        PetscInt dof = 0, cdof = 0, off = 0;
+        err = PetscSectionGetDof(globalSection, p, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; }
+        err = PetscSectionGetConstraintDof(globalSection, p, &cdof);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionGetOffset(globalSection, p, &off);PYLITH_CHECK_ERROR(err);
+        const PetscInt blockSize = dof - cdof;
+        if (!blockSize) { continue; } // All degrees of freedom are constrained.
+        for (PetscInt i = 0; i < blockSize; ++i) {
+            indices[i] = off + i;
+        } // for
+        err = MatSetValues(_precondMat, blockSize, &indices[0], blockSize, &indices[0], &zeros[0],
+                           INSERT_VALUES);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = MatAssemblyBegin(_precondMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_precondMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatSetOption(_precondMat, MAT_NEW_NONZERO_LOCATIONS, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _createPreconditionerBlockDiagonal
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Count nonzero entries in the assembled LHS Jacobian from the adjacency of points in the mesh.
+PylithReal
+pylith::problems::TimeDependent::_countJacobianNonzeros(void) const {
+    PYLITH_METHOD_BEGIN;
+
+    assert(_solution);
+
+    PetscErrorCode err;
+    PetscDM dmSoln = _solution->dmMesh();assert(dmSoln);
+    PetscSection localSection = NULL;
+    PetscSection globalSection = NULL;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMGetLocalSection(dmSoln, &localSection);PYLITH_CHECK_ERROR(err);
+    err = DMGetGlobalSection(dmSoln, &globalSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetChart(globalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    PylithReal nnzLocal = 0.0;
+    PetscInt adjSize = PETSC_DETERMINE;
+    PetscInt* adj = NULL;
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        PetscInt dof = 0, cdof = 0;
+        err = PetscSectionGetDof(globalSection, p, &dof);PYLITH_CHECK_ERROR(err);
+        if (dof <= 0) { continue; } // Point not owned by this process.
+        err = PetscSectionGetConstraintDof(globalSection, p, &cdof);PYLITH_CHECK_ERROR(err);
+        if (dof == cdof) { continue; }
+
+        adjSize = PETSC_DETERMINE;
+        err = DMPlexGetAdjacency(dmSoln, p, &adjSize, &adj);PYLITH_CHECK_ERROR(err);
+        PetscInt numCols = 0;
+        for (PetscInt iAdj = 0; iAdj < adjSize; ++iAdj) {
+            PetscInt qdof = 0, qcdof = 0;
+            err = PetscSectionGetDof(localSection, adj[iAdj], &qdof);PYLITH_CHECK_ERROR(err);
+            err = PetscSectionGetConstraintDof(localSection, adj[iAdj], &qcdof);PYLITH_CHECK_ERROR(err);
+            numCols += qdof - qcdof;
+        } // for
+        nnzLocal += PylithReal(dof - cdof) * numCols;
+    } // for
+    err = PetscFree(adj);PYLITH_CHECK_ERROR(err);
+
+    PylithReal nnz = 0.0;
+    err = MPI_Allreduce(&nnzLocal, &nnz, 1, MPIU_REAL, MPI_SUM, _solution->mesh().comm());PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_RETURN(nnz);
+} // _countJacobianNonzeros
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Report memory of LHS Jacobian and preconditioner matrices, time per linear iteration, and peak memory.
+void
+pylith::problems::TimeDependent::_logJacobianPerformance(void) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_logJacobianPerformance()");
+
+    assert(_ts);
+    assert(_solution);
+
+    PetscErrorCode err;
+    PetscMat jacobianMat = NULL;
+    PetscMat precondMat = NULL;
+    err = TSGetIJacobian(_ts, &jacobianMat, &precondMat, NULL, NULL);PYLITH_CHECK_ERROR(err);
+
+    // An AIJ matrix stores a value and a column index for each nonzero entry.
+    const PylithReal bytesPerNonzero = sizeof(PetscScalar) + sizeof(PetscInt);
+    const PylithReal nnzAssembled = _countJacobianNonzeros();
+    PylithReal nnzPrecond = 0.0;
+    if (precondMat && (precondMat != jacobianMat)) {
+        MatInfo info;
+        err = MatGetInfo(precondMat, MAT_GLOBAL_SUM, &info);PYLITH_CHECK_ERROR(err);
+        nnzPrecond = info.nz_used;
+    } // if
+
+    // Time per linear iteration comes from PETSc logging, so it is zero unless logging is active (for example, -log_view).
+    PetscInt numLinearIterations = 0;
+    err = TSGetKSPIterations(_ts, &numLinearIterations);PYLITH_CHECK_ERROR(err);
+    PetscLogEvent eventKSPSolve = -1;
+    PetscEventPerfInfo solveInfo;
+    solveInfo.time = 0.0;
+    err = PetscLogEventGetId("KSPSolve", &eventKSPSolve);PYLITH_CHECK_ERROR(err);
+    err = PetscLogEventGetPerfInfo(PETSC_DETERMINE, eventKSPSolve, &solveInfo);PYLITH_CHECK_ERROR(err);
+
+    // Peak memory is tracked only when requested (for example, -memory_view); otherwise report current usage.
+    PetscLogDouble memoryLocal = 0.0;
+    err = PetscMemoryGetMaximumUsage(&memoryLocal);PYLITH_CHECK_ERROR(err);
+    const bool isPeak = memoryLocal > 0.0;
+    if (!isPeak) {
+        err = PetscMemoryGetCurrentUsage(&memoryLocal);PYLITH_CHECK_ERROR(err);
+    } // if
+    const PylithReal memoryLocalReal = memoryLocal;
+    PylithReal memory = 0.0;
+    err = MPI_Allreduce(&memoryLocalReal, &memory, 1, MPIU_REAL, MPI_MAX, _solution->mesh().comm());PYLITH_CHECK_ERROR(err);
+
+    const PylithReal MB = 1024.0*1024.0;
+    std::ostringstream msg;
+    msg << "LHS Jacobian (" << ((JACOBIAN_MATRIX_FREE == _jacobianType) ? "matrix-free" : "assembled") << "):"
+        << "\n    Assembled Jacobian: " << nnzAssembled << " nonzeros, " << nnzAssembled*bytesPerNonzero/MB << " MB"
+        << ((JACOBIAN_MATRIX_FREE == _jacobianType) ? " (not allocated)" : "");
+    if (JACOBIAN_MATRIX_FREE == _jacobianType) {
+        msg << "\n    Block diagonal preconditioner: " << nnzPrecond << " nonzeros, " << nnzPrecond*bytesPerNonzero/MB << " MB";
+    } // if
+    msg << "\n    Linear iterations: " << numLinearIterations << ", time per iteration: "
+        << ((numLinearIterations > 0) ? solveInfo.time / numLinearIterations : 0.0) << " s"
+        << "\n    " << (isPeak ? "Peak" : "Current") << " memory (maximum over processes): " << memory/MB << " MB";
+    PYLITH_COMPONENT_INFO(msg.str());
+
+    PYLITH_METHOD_END;
+} // _logJacobianPerformance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Assemble parts of LHS Jacobian that are independent of (K) and proportional to (M) s_tshift.
+void
+pylith::problems::TimeDependent::_computeLHSJacobianSplit(const PylithReal t,
+                                                          const PylithReal dt) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_computeLHSJacobianSplit(t="<<t<<", dt="<<dt<<")");
+
+    assert(_solution);
+    assert(_solutionDot);
+
+    PetscErrorCode err;
+    PetscDM dmSoln = _solution->dmMesh();
+    if (!_jacobianStiffness) {
+        err = DMCreateMatrix(dmSoln, &_jacobianStiffness);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (!_jacobianMass) {
+        err = DMCreateMatrix(dmSoln, &_jacobianMass);PYLITH_CHECK_ERROR(err);
+    } // if
+    err = MatZeroEntries(_jacobianStiffness);PYLITH_CHECK_ERROR(err);
+    err = MatZeroEntries(_jacobianMass);PYLITH_CHECK_ERROR(err);
+
+    // K = J(s_tshift=0), M = J(s_tshift=1) - K. Jacobian kernels are linear in s_tshift.
+    const size_t numIntegrators = _integrators.size();
+    const PylithReal s_tshiftStiffness = 0.0;
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->computeLHSJacobian(_jacobianStiffness, _jacobianStiffness, t, dt, s_tshiftStiffness,
+                                            *_solution, *_solutionDot);
+    } // for
+    err = MatAssemblyBegin(_jacobianStiffness, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_jacobianStiffness, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    const PylithReal s_tshiftMass = 1.0;
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        _integrators[i]->computeLHSJacobian(_jacobianMass, _jacobianMass, t, dt, s_tshiftMass, *_solution, *_solutionDot);
+    } // for
+    err = MatAssemblyBegin(_jacobianMass, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(_jacobianMass, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAXPY(_jacobianMass, -1.0, _jacobianStiffness, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _computeLHSJacobianSplit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Combine parts of LHS Jacobian, J = K + s_tshift M.
+void
+pylith::problems::TimeDependent::_combineLHSJacobianSplit(PetscMat jacobianMat,
+                                                          PetscMat precondMat,
+                                                          const PylithReal s_tshift) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_combineLHSJacobianSplit(jacobianMat="<<jacobianMat<<", precondMat="<<precondMat<<", s_tshift="<<s_tshift<<")");
+
+    assert(_jacobianStiffness);
+    assert(_jacobianMass);
+
+    PetscErrorCode err;
+    const size_t numMats = (jacobianMat != precondMat) ? 2 : 1;
+    PetscMat mats[2] = { precondMat, jacobianMat };
+    for (size_t i = 0; i < numMats; ++i) {
+        assert(mats[i]);
+        // Nonzero pattern matches K and M once the matrix has been assembled.
+        PetscBool isAssembled = PETSC_FALSE;
+        err = MatAssembled(mats[i], &isAssembled);PYLITH_CHECK_ERROR(err);
+        const MatStructure copyStructure = (isAssembled) ? SAME_NONZERO_PATTERN : DIFFERENT_NONZERO_PATTERN;
+        err = MatCopy(_jacobianStiffness, mats[i], copyStructure);PYLITH_CHECK_ERROR(err);
+        err = MatAXPY(mats[i], s_tshift, _jacobianMass, SAME_NONZERO_PATTERN);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    _sTShiftJacobian = s_tshift;
+
+    PYLITH_METHOD_END;
+} // _combineLHSJacobianSplit
+
+
 // ---------------------------------------------------------------------------------------------------------------------
 // Set state (auxiliary field values) of system for time t.
 void
@@ -868,4 +2298,324 @@ pylith::problems::TimeDependent::_notifyObserversInitialSoln(void) {
 } // _notifyObserversInitialSoln
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Add solution to history used by predictor.
+void
+pylith::problems::TimeDependent::_savePredictorSolution(const PylithReal t,
+                                                        PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_savePredictorSolution(t="<<t<<", solutionVec="<<solutionVec<<")");
+
+    assert(solutionVec);
+    PetscErrorCode err;
+    if (_predictorTimes.size() > 0 && t <= _predictorTimes.back()) {
+        PYLITH_METHOD_END; // Already have solution at this time.
+    } // if
+
+    // Keep one more solution than the order of the predictor, reusing the oldest vector.
+    const size_t maxSize = size_t(_predictor) + 1;
+    PetscVec vec = NULL;
+    if (_predictorSolutions.size() >= maxSize) {
+        vec = _predictorSolutions.front();
+        _predictorSolutions.pop_front();
+        _predictorTimes.pop_front();
+    } else {
+        err = VecDuplicate(solutionVec, &vec);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = VecCopy(solutionVec, vec);PYLITH_CHECK_ERROR(err);
+    _predictorSolutions.push_back(vec);
+    _predictorTimes.push_back(t);
+
+    PYLITH_METHOD_END;
+} // _savePredictorSolution
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute initial guess for nonlinear solve by extrapolating previous solutions.
+void
+pylith::problems::TimeDependent::_predictSolution(PetscVec solutionVec) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_predictSolution(solutionVec="<<solutionVec<<")");
+
+    // With fewer than 2 previous solutions, keep the solution at the previous time step.
+    const size_t numPoints = _predictorSolutions.size();
+    if (numPoints < 2) {
+        PYLITH_METHOD_END;
+    } // if
+
+    PetscErrorCode err;
+    PylithReal t = 0.0, dt = 0.0;
+    err = TSGetTime(_ts, &t);PYLITH_CHECK_ERROR(err);
+    err = TSGetTimeStep(_ts, &dt);PYLITH_CHECK_ERROR(err);
+    const PylithReal tPredict = t + dt;
+
+    // Lagrange polynomial through previous solutions evaluated at end of time step.
+    pylith::scalar_array weights(numPoints);
+    for (size_t i = 0; i < numPoints; ++i) {
+        weights[i] = 1.0;
+        for (size_t j = 0; j < numPoints; ++j) {
+            if (i != j) {
+                weights[i] *= (tPredict - _predictorTimes[j]) / (_predictorTimes[i] - _predictorTimes[j]);
+            } // if
+        } // for
+    } // for
+
+    std::vector<PetscVec> vecs(_predictorSolutions.begin(), _predictorSolutions.end());
+    err = VecSet(solutionVec, 0.0);PYLITH_CHECK_ERROR(err);
+    err = VecMAXPY(solutionVec, numPoints, &weights[0], &vecs[0]);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _predictSolution
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get state of observers for checkpointing.
+void
+pylith::problems::TimeDependent::_getObserversCheckpointState(std::map<std::string, PylithReal>* states) const {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_getObserversCheckpointState(states="<<states<<")");
+
+    assert(states);
+    assert(_observers);
+    _observers->getCheckpointState(states, "solution.");
+
+    std::vector<pylith::problems::Physics*> physics;
+    physics.insert(physics.end(), _materials.begin(), _materials.end());
+    physics.insert(physics.end(), _bc.begin(), _bc.end());
+    physics.insert(physics.end(), _interfaces.begin(), _interfaces.end());
+    for (size_t i = 0; i < physics.size(); ++i) {
+        assert(physics[i]);
+        pylith::problems::ObserversPhysics* observers = physics[i]->getObservers();
+        if (observers) {
+            observers->getCheckpointState(states, std::string(physics[i]->getIdentifier()) + ".");
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // _getObserversCheckpointState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set state of observers when restarting from checkpoint.
+void
+pylith::problems::TimeDependent::_setObserversCheckpointState(const std::map<std::string, PylithReal>& states) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setObserversCheckpointState()");
+
+    assert(_observers);
+    _observers->setCheckpointState(states, "solution.");
+
+    std::vector<pylith::problems::Physics*> physics;
+    physics.insert(physics.end(), _materials.begin(), _materials.end());
+    physics.insert(physics.end(), _bc.begin(), _bc.end());
+    physics.insert(physics.end(), _interfaces.begin(), _interfaces.end());
+    for (size_t i = 0; i < physics.size(); ++i) {
+        assert(physics[i]);
+        pylith::problems::ObserversPhysics* observers = physics[i]->getObservers();
+        if (observers) {
+            observers->setCheckpointState(states, std::string(physics[i]->getIdentifier()) + ".");
+        } // if
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setObserversCheckpointState
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set flag for skipping query of auxiliary field databases for all physics.
+void
+pylith::problems::TimeDependent::_setSkipAuxiliaryFieldDB(const bool value) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_setSkipAuxiliaryFieldDB(value="<<value<<")");
+
+    std::vector<pylith::problems::Physics*> physics;
+    physics.insert(physics.end(), _materials.begin(), _materials.end());
+    physics.insert(physics.end(), _bc.begin(), _bc.end());
+    physics.insert(physics.end(), _interfaces.begin(), _interfaces.end());
+    for (size_t i = 0; i < physics.size(); ++i) {
+        assert(physics[i]);
+        physics[i]->setSkipAuxiliaryFieldDB(value);
+    } // for
+
+    PYLITH_METHOD_END;
+} // _setSkipAuxiliaryFieldDB
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set auxiliary fields of integrators and constraints from checkpoint.
+void
+pylith::problems::TimeDependent::_readAuxiliaryCheckpoint(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_readAuxiliaryCheckpoint()");
+
+    assert(_solution);
+
+    PetscErrorCode err;
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(_solution->mesh().comm(), _checkpointFilename.c_str(), FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+
+    const size_t numIntegrators = _integrators.size();
+    for (size_t i = 0; i < numIntegrators; ++i) {
+        assert(_integrators[i]);
+        _integrators[i]->readCheckpoint(viewer);
+    } // for
+
+    const size_t numConstraints = _constraints.size();
+    for (size_t i = 0; i < numConstraints; ++i) {
+        assert(_constraints[i]);
+        _constraints[i]->readCheckpoint(viewer);
+    } // for
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _readAuxiliaryCheckpoint
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Set solution, time stepping state, and output trigger state from checkpoint.
+void
+pylith::problems::TimeDependent::_restartFromCheckpoint(void) {
+    PYLITH_METHOD_BEGIN;
+    PYLITH_COMPONENT_DEBUG("_restartFromCheckpoint()");
+
+    assert(_ts);
+    assert(_solution);
+
+    // Read time stepping and output trigger state. Observers missing from the checkpoint keep their initial state.
+    const std::string solutionDataset = std::string("/") + _solution->getLabel();
+    double time = 0.0;
+    double timeStep = 0.0;
+    int step = 0;
+    std::map<std::string, PylithReal> observerStates;
+    _getObserversCheckpointState(&observerStates);
+    pylith::meshio::HDF5 h5;
+    h5.open(_checkpointFilename.c_str(), H5F_ACC_RDONLY);
+    h5.readAttribute(solutionDataset.c_str(), "time", (void*)&time, H5T_NATIVE_DOUBLE);
+    h5.readAttribute(solutionDataset.c_str(), "time_step", (void*)&timeStep, H5T_NATIVE_DOUBLE);
+    h5.readAttribute(solutionDataset.c_str(), "step", (void*)&step, H5T_NATIVE_INT);
+    for (std::map<std::string, PylithReal>::iterator iter = observerStates.begin(); iter != observerStates.end();) {
+        const std::string name = "output_trigger." + iter->first;
+        try {
+            double value = 0.0;
+            h5.readAttribute(solutionDataset.c_str(), name.c_str(), (void*)&value, H5T_NATIVE_DOUBLE);
+            iter->second = value;
+            ++iter;
+        } catch (const std::runtime_error&) {
+            observerStates.erase(iter++);
+        } // try/catch
+    } // for
+    h5.close();
+
+    // Read solution, bypassing the initial conditions.
+    PetscErrorCode err;
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(_solution->mesh().comm(), _checkpointFilename.c_str(), FILE_MODE_READ, &viewer);PYLITH_CHECK_ERROR(err);
+
+    err = PetscViewerHDF5PushGroup(viewer, "/");PYLITH_CHECK_ERROR(err);
+    pylith::topology::FieldOps::readCheckpoint(viewer, _solution);
+    err = PetscViewerHDF5PopGroup(viewer);PYLITH_CHECK_ERROR(err);
+    err = PetscViewerDestroy(&viewer);PYLITH_CHECK_ERROR(err);
+
+    PetscVec solutionVec = NULL;
+    err = TSGetSolution(_ts, &solutionVec);PYLITH_CHECK_ERROR(err);
+    _solution->scatterLocalToVector(solutionVec);
+
+    err = TSSetTime(_ts, time);PYLITH_CHECK_ERROR(err);
+    err = TSSetTimeStep(_ts, timeStep);PYLITH_CHECK_ERROR(err);
+    err = TSSetStepNumber(_ts, step);PYLITH_CHECK_ERROR(err);
+
+    _setObserversCheckpointState(observerStates);
+
+    PYLITH_COMPONENT_INFO("Restarting from checkpoint '" << _checkpointFilename << "' at time step " << step << ".");
+
+    PYLITH_METHOD_END;
+} // _restartFromCheckpoint
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Check whether local solution vectors already hold the given global vectors at time t with constraints set.
+bool
+pylith::problems::TimeDependent::_isSolutionLocalCurrent(const PylithReal t,
+                                                         PetscVec solutionVec,
+                                                         PetscVec solutionDotVec) const {
+    PYLITH_METHOD_BEGIN;
+
+    const SolutionLocalState& saved = _solutionLocalState;
+    if (!saved.isValid || (t != saved.t)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PetscErrorCode err;
+    PetscObjectId id = 0;
+    PetscObjectState state = 0;
+    assert(solutionVec);
+    err = PetscObjectGetId((PetscObject)solutionVec, &id);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)solutionVec, &state);PYLITH_CHECK_ERROR(err);
+    if ((id != saved.solutionId) || (state != saved.solutionState)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    id = 0;
+    state = 0;
+    if (solutionDotVec) {
+        err = PetscObjectGetId((PetscObject)solutionDotVec, &id);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectStateGet((PetscObject)solutionDotVec, &state);PYLITH_CHECK_ERROR(err);
+    } // if
+    if ((id != saved.solutionDotId) || (state != saved.solutionDotState)) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    // Other code (e.g., poststep) may have changed the local vectors since the last call.
+    assert(_solution);
+    err = PetscObjectStateGet((PetscObject)_solution->localVector(), &state);PYLITH_CHECK_ERROR(err);
+    if (state != saved.solutionLocalState) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+    state = 0;
+    if (_solutionDot) {
+        err = PetscObjectStateGet((PetscObject)_solutionDot->localVector(), &state);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (state != saved.solutionDotLocalState) {
+        PYLITH_METHOD_RETURN(false);
+    } // if
+
+    PYLITH_METHOD_RETURN(true);
+} // _isSolutionLocalCurrent
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Remember global vectors, time, and resulting local vectors after setting local solution vectors.
+void
+pylith::problems::TimeDependent::_saveSolutionLocalState(const PylithReal t,
+                                                         PetscVec solutionVec,
+                                                         PetscVec solutionDotVec) {
+    PYLITH_METHOD_BEGIN;
+
+    SolutionLocalState& saved = _solutionLocalState;
+    saved.t = t;
+
+    PetscErrorCode err;
+    assert(solutionVec);
+    err = PetscObjectGetId((PetscObject)solutionVec, &saved.solutionId);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectStateGet((PetscObject)solutionVec, &saved.solutionState);PYLITH_CHECK_ERROR(err);
+
+    saved.solutionDotId = 0;
+    saved.solutionDotState = 0;
+    if (solutionDotVec) {
+        err = PetscObjectGetId((PetscObject)solutionDotVec, &saved.solutionDotId);PYLITH_CHECK_ERROR(err);
+        err = PetscObjectStateGet((PetscObject)solutionDotVec, &saved.solutionDotState);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    assert(_solution);
+    err = PetscObjectStateGet((PetscObject)_solution->localVector(), &saved.solutionLocalState);PYLITH_CHECK_ERROR(err);
+    saved.solutionDotLocalState = 0;
+    if (_solutionDot) {
+        err = PetscObjectStateGet((PetscObject)_solutionDot->localVector(), &saved.solutionDotLocalState);PYLITH_CHECK_ERROR(err);
+    } // if
+    saved.isValid = true;
+
+    PYLITH_METHOD_END;
+} // _saveSolutionLocalState
+
+
 // End of file
@@ -27,11 +27,30 @@
 
 #include "Problem.hh" // ISA Problem
 #include "pylith/testing/testingfwd.hh" // USES MMSTest
+#include "pylith/utils/utilsfwd.hh" // HOLDSA EventLogger
+
+#include <deque> // HASA std::deque
+#include <map> // USES std::map
+#include <string> // HASA std::string
 
 class pylith::problems::TimeDependent : public pylith::problems::Problem {
     friend class TestTimeDependent; // unit testing
     friend class pylith::testing::MMSTest; // Testing with Method of Manufactured Solutions
 
+    // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum JacobianTypeEnum {
+        JACOBIAN_ASSEMBLED, // Assemble sparse matrix for Jacobian.
+        JACOBIAN_MATRIX_FREE, // Matrix-free action of Jacobian (PETSc MatShell).
+    }; // JacobianTypeEnum
+
+    enum PredictorEnum {
+        PREDICTOR_NONE=0, // Start nonlinear solve from solution at previous time step.
+        PREDICTOR_LINEAR=1, // Extrapolate solutions at previous 2 time steps.
+        PREDICTOR_QUADRATIC=2, // Extrapolate solutions at previous 3 time steps.
+    }; // PredictorEnum
+
     // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -92,6 +111,45 @@ public:
      */
     double getInitialTimeStep(void) const;
 
+    /** Set type of Jacobian for implicit time stepping.
+     *
+     * @param[in] value Type of Jacobian.
+     */
+    void setJacobianType(const JacobianTypeEnum value);
+
+    /** Get type of Jacobian for implicit time stepping.
+     *
+     * @returns Type of Jacobian.
+     */
+    JacobianTypeEnum getJacobianType(void) const;
+
+    /** Set predictor for initial guess of nonlinear solve in implicit time stepping.
+     *
+     * @param[in] value Type of predictor.
+     */
+    void setPredictor(const PredictorEnum value);
+
+    /** Get predictor for initial guess of nonlinear solve in implicit time stepping.
+     *
+     * @returns Type of predictor.
+     */
+    PredictorEnum getPredictor(void) const;
+
+    /** Set flag for assembling sparse matrix for preconditioner with matrix-free Jacobian.
+     *
+     * The preconditioner matrix holds only the diagonal block of each point, so its memory is a small fraction of the
+     * assembled Jacobian.
+     *
+     * @param[in] value True if preconditioner matrix should be assembled, false otherwise.
+     */
+    void setAssemblePreconditioner(const bool value);
+
+    /** Get flag for assembling sparse matrix for preconditioner with matrix-free Jacobian.
+     *
+     * @returns True if preconditioner matrix is assembled, false otherwise.
+     */
+    bool getAssemblePreconditioner(void) const;
+
     /** Set initial conditions.
      *
      * @param[in] ic Array of initial conditions.
@@ -114,6 +172,101 @@ public:
      */
     void setProgressMonitor(pylith::problems::ProgressMonitorTime* monitor);
 
+    /** Set name of checkpoint file.
+     *
+     * @param[in] filename Name of checkpoint file.
+     */
+    void setCheckpointFilename(const char* filename);
+
+    /** Get name of checkpoint file.
+     *
+     * @returns Name of checkpoint file.
+     */
+    const char* getCheckpointFilename(void) const;
+
+    /** Set number of time steps between writing checkpoints.
+     *
+     * @param[in] value Number of time steps between checkpoints (0 means never write checkpoints).
+     */
+    void setCheckpointInterval(const size_t value);
+
+    /** Get number of time steps between writing checkpoints.
+     *
+     * @returns Number of time steps between checkpoints.
+     */
+    size_t getCheckpointInterval(void) const;
+
+    /** Set flag for restarting from checkpoint file.
+     *
+     * @param[in] value True if problem resumes from checkpoint file, false otherwise.
+     */
+    void setRestart(const bool value);
+
+    /** Get flag for restarting from checkpoint file.
+     *
+     * @returns True if problem resumes from checkpoint file, false otherwise.
+     */
+    bool getRestart(void) const;
+
+    /** Set flag for multirate explicit time stepping.
+     *
+     * Cells that need a time step smaller than the initial time step for stability are advanced at the fast rate using
+     * the PETSc multirate partitioned Runge-Kutta (TSMPRK) time stepper; all other cells are advanced at the slow rate.
+     * Used only with the dynamic formulation.
+     *
+     * @param[in] value True if using multirate explicit time stepping, false otherwise.
+     */
+    void setMultirate(const bool value);
+
+    /** Get flag for multirate explicit time stepping.
+     *
+     * @returns True if using multirate explicit time stepping, false otherwise.
+     */
+    bool getMultirate(void) const;
+
+    /** Set flag for overlapping halo exchange with residual assembly.
+     *
+     * Residual contributions from cells with points shared with other processes are assembled first, and their
+     * communication proceeds while the remaining cells are integrated.
+     *
+     * @param[in] value True if overlapping halo exchange with residual assembly, false otherwise.
+     */
+    void setOverlapHaloExchange(const bool value);
+
+    /** Get flag for overlapping halo exchange with residual assembly.
+     *
+     * @returns True if overlapping halo exchange with residual assembly, false otherwise.
+     */
+    bool getOverlapHaloExchange(void) const;
+
+    /** Set flag for managing reuse of the preconditioner across time steps.
+     *
+     * The preconditioner is rebuilt only when the LHS Jacobian is reformed or when the number of linear iterations in
+     * a time step exceeds the rebuild factor times the number in the time step when it was last rebuilt. A LHS Jacobian
+     * that is only recombined from K and M for a new time step keeps the current preconditioner.
+     *
+     * @param[in] value True if managing reuse of the preconditioner, false to leave it to the PETSc options.
+     */
+    void setReusePreconditioner(const bool value);
+
+    /** Get flag for managing reuse of the preconditioner across time steps.
+     *
+     * @returns True if managing reuse of the preconditioner, false otherwise.
+     */
+    bool getReusePreconditioner(void) const;
+
+    /** Set factor for growth in linear iterations that triggers rebuilding the preconditioner.
+     *
+     * @param[in] value Ratio of linear iterations in a time step to those when preconditioner was last rebuilt.
+     */
+    void setPreconditionerRebuildFactor(const double value);
+
+    /** Get factor for growth in linear iterations that triggers rebuilding the preconditioner.
+     *
+     * @returns Ratio of linear iterations in a time step to those when preconditioner was last rebuilt.
+     */
+    double getPreconditionerRebuildFactor(void) const;
+
     /** Get Petsc DM for problem.
      *
      * @returns PETSc DM for problem.
@@ -142,6 +295,12 @@ public:
      */
     void solve(void);
 
+    /** Write checkpoint with current solution, auxiliary fields, time stepping state, and output trigger state.
+     *
+     * Checkpoint is written in parallel to a temporary file that replaces the previous checkpoint when complete.
+     */
+    void checkpoint(void);
+
     /** Perform Perform operations after advancing solution one time step.
      *
      * Update state variables, output.
@@ -149,6 +308,8 @@ public:
     void poststep(void);
 
     /** Set solution values according to constraints (Dirichlet BC).
+     *
+     * Nothing is done if the time and the global and local vectors are unchanged since the previous call.
      *
      * @param[in] t Current time.
      * @param[in] solutionVec PETSc Vec with current global view of solution.
@@ -202,6 +363,16 @@ public:
                             PetscVec solutionVec,
                             PetscVec solutionDotVec);
 
+    /** Compute action of LHS Jacobian for F(t,s,\dot{s}) on a vector for matrix-free implicit time stepping.
+     *
+     * The Jacobian is evaluated at the trial solution from the most recent call to computeLHSJacobian().
+     *
+     * @param[out] actionVec PETSc Vec for action of Jacobian.
+     * @param[in] inputVec PETSc Vec that Jacobian acts on.
+     */
+    void computeLHSJacobianAction(PetscVec actionVec,
+                                  PetscVec inputVec);
+
     /* Compute inverse of lumped LHS Jacobian for F(t,s,\dot{s}) for explicit time stepping.
      *
      * @param[in] t Current time.
@@ -229,6 +400,36 @@ public:
                                       PetscVec residualVec,
                                       void* context);
 
+    /** Callback static method for computing residual for RHS, G(t,s), for degrees of freedom advanced at the slow rate.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec for solution.
+     * @param[out] residualvec PETSc Vec for residual of slow degrees of freedom.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualSlow(PetscTS ts,
+                                          PetscReal t,
+                                          PetscVec solutionVec,
+                                          PetscVec residualVec,
+                                          void* context);
+
+    /** Callback static method for computing residual for RHS, G(t,s), for degrees of freedom advanced at the fast rate.
+     *
+     * @param[in] ts PETSc time stepper.
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec for solution.
+     * @param[out] residualvec PETSc Vec for residual of fast degrees of freedom.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeRHSResidualFast(PetscTS ts,
+                                          PetscReal t,
+                                          PetscVec solutionVec,
+                                          PetscVec residualVec,
+                                          void* context);
+
     /** Callback static method for computing residual for LHS, F(t,s,\dot{s}).
      *
      * @param[in] ts PETSc time stepper.
@@ -265,11 +466,33 @@ public:
                                       PetscMat precondMat,
                                       void* context);
 
+    /** Callback static method for action of LHS Jacobian (MatMult of PETSc MatShell).
+     *
+     * @param[in] jacobianMat PETSc MatShell for Jacobian.
+     * @param[in] inputVec PETSc Vec that Jacobian acts on.
+     * @param[out] actionVec PETSc Vec for action of Jacobian.
+     */
+    static
+    PetscErrorCode computeLHSJacobianAction(PetscMat jacobianMat,
+                                            PetscVec inputVec,
+                                            PetscVec actionVec);
+
     /** Callback static method for operations after advancing solution one time step.
      */
     static
     PetscErrorCode poststep(PetscTS ts);
 
+    /** Callback static method for computing initial guess for nonlinear solve by extrapolating previous solutions.
+     *
+     * @param[in] snes PETSc SNES for nonlinear solve.
+     * @param[out] solutionVec PETSc Vec for initial guess.
+     * @param[in] context User context (TimeDependent).
+     */
+    static
+    PetscErrorCode computeInitialGuess(PetscSNES snes,
+                                       PetscVec solutionVec,
+                                       void* context);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -280,6 +503,119 @@ private:
      */
     bool _needNewJacobian(const PylithReal dt);
 
+    /** Set whether the linear solver reuses the current preconditioner with the LHS Jacobian.
+     *
+     * @param[in] precondMat PETSc Mat for preconditioner.
+     */
+    void _setPreconditionerReuse(PetscMat precondMat);
+
+    /** Check linear iterations in time step against those when the preconditioner was last rebuilt and report
+     * preconditioner setup and solve time.
+     *
+     * @param[in] tindex Current time step.
+     */
+    void _monitorPreconditioner(const PylithInt tindex);
+
+    /** Bin cells by stable time step and set up RHS splits for multirate explicit time stepping.
+     *
+     * @returns True if some degrees of freedom are advanced at the fast rate, false otherwise.
+     */
+    bool _setupMultirate(void);
+
+    /** Check that the fast rate of the multirate method is stable for the fast cells.
+     *
+     * The fast rate advances with the time step divided by the ratio of the slow and fast rates of the PETSc multirate
+     * method. An error is raised if this exceeds the minimum stable time step of the fast cells.
+     */
+    void _checkMultirateStability(void) const;
+
+    /** Compute RHS residual, M^{-1} G(t,s), for degrees of freedom advanced at one rate.
+     *
+     * Only cells contributing to degrees of freedom advanced at the given rate are integrated.
+     *
+     * @param[out] residualVec PETSc Vec for residual of degrees of freedom advanced at the given rate.
+     * @param[in] isFast True for degrees of freedom advanced at the fast rate, false for the slow rate.
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] solutionVec PETSc Vec with current trial solution.
+     */
+    void _computeRHSResidualMultirate(PetscVec residualVec,
+                                      const bool isFast,
+                                      const PylithReal t,
+                                      const PylithReal dt,
+                                      PetscVec solutionVec);
+
+    /** Split cells and degrees of freedom by whether they touch points shared with other processes.
+     *
+     * @returns True if residual assembly overlaps the halo exchange, false otherwise.
+     */
+    bool _setupHaloOverlap(void);
+
+    /** Split cells and degrees of freedom into those with and without points shared with other processes.
+     *
+     * @param[in] sharedPoints Flags for points in solution mesh (1 if shared with another process, 0 otherwise).
+     */
+    void _setHaloSharedPoints(const pylith::int_array& sharedPoints);
+
+    /** Compute residual contributions from integrators and add them to the global residual.
+     *
+     * @param[out] residualVec PETSc Vec (global) for residual.
+     * @param[in] isLHS True for LHS residual, F(t,s,\dot{s}), false for RHS residual, G(t,s).
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     */
+    void _assembleResidual(PetscVec residualVec,
+                           const bool isLHS,
+                           const PylithReal t,
+                           const PylithReal dt);
+
+    /** Sum residual contributions from integrators in local residual.
+     *
+     * @param[out] residual Local residual field.
+     * @param[in] isLHS True for LHS residual, F(t,s,\dot{s}), false for RHS residual, G(t,s).
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     * @param[in] interiorCells True for cells without points shared with other processes, false for all other cells.
+     */
+    void _integrateResidual(pylith::topology::Field* residual,
+                            const bool isLHS,
+                            const PylithReal t,
+                            const PylithReal dt,
+                            const bool interiorCells);
+
+    /// Create PETSc MatShell for matrix-free Jacobian and, if requested, sparse matrix for preconditioner.
+    void _createJacobianMatrixFree(void);
+
+    /// Create sparse matrix for preconditioner holding only the diagonal block of each point.
+    void _createPreconditionerBlockDiagonal(void);
+
+    /** Count nonzero entries in the assembled LHS Jacobian from the adjacency of points in the mesh.
+     *
+     * @returns Number of nonzero entries over all processes.
+     */
+    PylithReal _countJacobianNonzeros(void) const;
+
+    /// Report memory of LHS Jacobian and preconditioner matrices, time per linear iteration, and peak memory.
+    void _logJacobianPerformance(void) const;
+
+    /** Assemble parts of LHS Jacobian that are independent of (K) and proportional to (M) s_tshift.
+     *
+     * @param[in] t Current time.
+     * @param[in] dt Current time step.
+     */
+    void _computeLHSJacobianSplit(const PylithReal t,
+                                  const PylithReal dt);
+
+    /** Combine parts of LHS Jacobian, J = K + s_tshift M.
+     *
+     * @param[out] jacobianMat PETSc Mat for Jacobian.
+     * @param[out] precondMat PETSc Mat for preconditioner for Jacobian.
+     * @param[in] s_tshift Scale for time derivative.
+     */
+    void _combineLHSJacobianSplit(PetscMat jacobianMat,
+                                  PetscMat precondMat,
+                                  const PylithReal s_tshift);
+
     /** Set state (auxiliary field values) of system for time t.
      *
      * * @param[in] t Current time.
@@ -289,6 +625,65 @@ private:
     /// Notify observers with solution corresponding to initial conditions.
     void _notifyObserversInitialSoln(void);
 
+    /** Add solution to history used by predictor.
+     *
+     * @param[in] t Time of solution.
+     * @param[in] solutionVec PETSc Vec with global view of solution.
+     */
+    void _savePredictorSolution(const PylithReal t,
+                                PetscVec solutionVec);
+
+    /** Compute initial guess for nonlinear solve by extrapolating previous solutions.
+     *
+     * @param[out] solutionVec PETSc Vec for initial guess.
+     */
+    void _predictSolution(PetscVec solutionVec);
+
+    /** Get state of observers for checkpointing.
+     *
+     * @param[out] states Observer states keyed by name.
+     */
+    void _getObserversCheckpointState(std::map<std::string, PylithReal>* states) const;
+
+    /** Set state of observers when restarting from checkpoint.
+     *
+     * @param[in] states Observer states keyed by name.
+     */
+    void _setObserversCheckpointState(const std::map<std::string, PylithReal>& states);
+
+    /** Set flag for skipping query of auxiliary field databases for all physics.
+     *
+     * @param[in] value True if queries should be skipped, false otherwise.
+     */
+    void _setSkipAuxiliaryFieldDB(const bool value);
+
+    /// Set auxiliary fields of integrators and constraints from checkpoint.
+    void _readAuxiliaryCheckpoint(void);
+
+    /// Set solution, time stepping state, and output trigger state from checkpoint.
+    void _restartFromCheckpoint(void);
+
+    /** Check whether local solution vectors already hold the given global vectors at time t with constraints set.
+     *
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec with current global view of solution.
+     * @param[in] solutionDotVec PETSc Vec with current global view of time derivative of solution.
+     * @returns True if local solution vectors are current, false otherwise.
+     */
+    bool _isSolutionLocalCurrent(const PylithReal t,
+                                 PetscVec solutionVec,
+                                 PetscVec solutionDotVec) const;
+
+    /** Remember global vectors, time, and resulting local vectors after setting local solution vectors.
+     *
+     * @param[in] t Current time.
+     * @param[in] solutionVec PETSc Vec with current global view of solution.
+     * @param[in] solutionDotVec PETSc Vec with current global view of time derivative of solution.
+     */
+    void _saveSolutionLocalState(const PylithReal t,
+                                 PetscVec solutionVec,
+                                 PetscVec solutionDotVec);
+
     // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -303,13 +698,73 @@ private:
     pylith::topology::Field* _solutionDot; ///< Time derivative of solution field.
     pylith::topology::Field* _residual; ///< Handle to residual field.
     pylith::topology::Field* _jacobianLHSLumpedInv; ///< Handle to inverse lumped Jacobian.
+    pylith::topology::Field* _jacobianAction; ///< Handle to action of matrix-free Jacobian.
+
+    JacobianTypeEnum _jacobianType; ///< Type of Jacobian for implicit time stepping.
+    PredictorEnum _predictor; ///< Predictor for initial guess of nonlinear solve.
+    std::deque<PylithReal> _predictorTimes; ///< Times of previous solutions used by predictor (oldest first).
+    std::deque<PetscVec> _predictorSolutions; ///< Previous solutions used by predictor (oldest first).
+    PetscMat _jacobianMatrixFree; ///< PETSc MatShell for matrix-free Jacobian.
+    PetscMat _precondMat; ///< Block diagonal sparse matrix for preconditioner with matrix-free Jacobian.
+    PetscVec _solutionJacobianVec; ///< Trial solution at which matrix-free Jacobian is evaluated.
+    PetscVec _solutionDotJacobianVec; ///< Time derivative of trial solution at which matrix-free Jacobian is evaluated.
+    PylithReal _tJacobianAction; ///< Time at which matrix-free Jacobian is evaluated.
+    PylithReal _dtJacobianAction; ///< Time step at which matrix-free Jacobian is evaluated.
+    PylithReal _sTShiftJacobianAction; ///< Scale for time derivative at which matrix-free Jacobian is evaluated.
+
+    PetscMat _jacobianStiffness; ///< Part of LHS Jacobian independent of s_tshift (K).
+    PetscMat _jacobianMass; ///< Part of LHS Jacobian proportional to s_tshift (M).
+    PylithReal _sTShiftJacobian; ///< Scale for time derivative used to combine LHS Jacobian.
+    bool _useJacobianSplit; ///< True if LHS Jacobian is combined from K and M when time step changes.
 
     PylithReal _dtJacobian; ///< Time step used to compute LHS Jacobian.
     PylithReal _dtLHSJacobianLumped; ///< Time step used to compute LHS lumped Jacobian.
     PylithReal _tResidual; ///< Time for current residual.
     bool _needNewLHSJacobian; ///< True if need to recompute LHS Jacobian.
     bool _haveNewLHSJacobian; ///< True if LHS Jacobian was reformed.
+    bool _haveShiftOnlyLHSJacobian; ///< True if LHS Jacobian was only recombined from K and M for new s_tshift.
     bool _shouldNotifyIC;
+    bool _assemblePreconditioner; ///< True if sparse matrix for preconditioner is assembled with matrix-free Jacobian.
+
+    std::string _checkpointFilename; ///< Name of checkpoint file.
+    size_t _checkpointInterval; ///< Number of time steps between checkpoints (0 means never).
+    bool _restart; ///< True if problem resumes from checkpoint file.
+
+    bool _multirate; ///< True if using multirate explicit time stepping.
+    PetscVec _residualMultirateVec; ///< Global RHS residual for all degrees of freedom with multirate time stepping.
+    PylithReal _dtStableMultirate; ///< Minimum stable time step of cells advanced at the fast rate (nondimensional).
+
+    bool _overlapHaloExchange; ///< True if overlapping halo exchange with residual assembly.
+    pylith::topology::Field* _residualInterior; ///< Local residual from cells without points shared with other processes.
+    std::vector<PetscInt> _haloInteriorLocalIndices; ///< Local indices of dofs of points not shared with other processes.
+    std::vector<PetscInt> _haloInteriorGlobalIndices; ///< Global indices of dofs of points not shared with other processes.
+
+    bool _reusePreconditioner; ///< True if managing reuse of the preconditioner across time steps.
+    PylithReal _pcRebuildFactor; ///< Growth in linear iterations that triggers rebuilding the preconditioner.
+    bool _pcNeedRebuild; ///< True if preconditioner must be rebuilt at next LHS Jacobian evaluation.
+    bool _pcRebuilt; ///< True if preconditioner was rebuilt during current time step.
+    PylithInt _pcRebuildIterations; ///< Linear iterations in time step when preconditioner was last rebuilt.
+    PylithInt _pcLinearIterations; ///< Total linear iterations at end of previous time step.
+    PylithReal _pcSetUpTime; ///< Total preconditioner setup time at end of previous time step.
+    PylithReal _pcSolveTime; ///< Total linear solve time at end of previous time step.
+    int _eventPCSetUp; ///< PETSc event for preconditioner setup.
+    int _eventKSPSolve; ///< PETSc event for linear solve.
+
+    /// State of vectors at last call to setSolutionLocal().
+    struct SolutionLocalState {
+        bool isValid; ///< True if state has been set.
+        PylithReal t; ///< Time of constraint values.
+        PetscObjectId solutionId; ///< Id of global solution vector.
+        PetscObjectState solutionState; ///< State of global solution vector.
+        PetscObjectId solutionDotId; ///< Id of global time derivative of solution vector (0 if none).
+        PetscObjectState solutionDotState; ///< State of global time derivative of solution vector.
+        PetscObjectState solutionLocalState; ///< State of local solution vector.
+        PetscObjectState solutionDotLocalState; ///< State of local time derivative of solution vector.
+    } _solutionLocalState;
+
+    pylith::utils::EventLogger* _logger; ///< Event logger.
+    int _eventSetSolutionLocal; ///< Event for setting local solution vectors.
+    int _eventSetSolutionLocalSkipped; ///< Event for skipping unchanged local solution vectors.
 
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
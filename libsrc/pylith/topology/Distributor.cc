@@ -24,9 +24,18 @@
 #include "pylith/topology/Field.hh" // USES Field<Mesh>
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::isCohesiveCell()
 #include "pylith/meshio/DataWriter.hh" // USES DataWriter
+#include "pylith/meshio/OutputSubfield.hh" // USES OutputSubfield
+#include "pylith/utils/array.hh" // USES int_array, real_array
 #include "pylith/utils/journals.hh" // pythia::journal
 
+#include <algorithm> // USES std::max()
+#include <map> // USES std::map
+#include <set> // USES std::set
+#include <iomanip> // USES std::setw()
+#include <vector> // USES std::vector
+#include <string> // USES std::string
 #include <cstring> // USES strlen()
 #include <strings.h> // USES strcasecmp()
 #include <stdexcept> // USES std::runtime_error
@@ -48,11 +57,22 @@ pylith::topology::Distributor::~Distributor(void) {}
 void
 pylith::topology::Distributor::distribute(topology::Mesh* const newMesh,
                                           const topology::Mesh& origMesh,
-                                          const char* partitionerName) {
+                                          const char* partitionerName,
+                                          const int* weightIds,
+                                          const int numWeightIds,
+                                          const PylithReal* weights,
+                                          const int numWeights,
+                                          const PylithReal faultAdjacentWeight) {
     PYLITH_METHOD_BEGIN;
     pythia::journal::info_t info("mesh_distributor");
 
     assert(newMesh);
+    if (numWeightIds != numWeights) {
+        std::ostringstream msg;
+        msg << "Mismatch in number of identifiers (" << numWeightIds << ") and number of weights (" << numWeights
+            << ") for partitioning.";
+        throw std::runtime_error(msg.str());
+    } // if
     newMesh->setCoordSys(origMesh.getCoordSys());
 
     const int commRank = origMesh.commRank();
@@ -67,6 +87,35 @@ pylith::topology::Distributor::distribute(topology::Mesh* const newMesh,
     err = DMPlexGetPartitioner(dmOrig, &partitioner);PYLITH_CHECK_ERROR(err);
     err = PetscPartitionerSetType(partitioner, partitionerName);PYLITH_CHECK_ERROR(err);
 
+    // The partitioner uses the number of dof in the closure of each cell in the local section of the DM as the vertex
+    // weights of the cell graph, so we set a local section with the cell weights as the dof on the cells.
+    const bool useWeights = numWeights > 0 || faultAdjacentWeight != 1.0;
+    if (useWeights) {
+        pylith::int_array cellWeights;
+        _computeCellWeights(&cellWeights, origMesh, weightIds, weights, numWeights, faultAdjacentWeight);
+
+        PetscInt pStart = 0, pEnd = 0;
+        err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+        topology::Stratum cellsStratum(dmOrig, topology::Stratum::HEIGHT, 0);
+        const PetscInt cStart = cellsStratum.begin();
+        const PetscInt cEnd = cellsStratum.end();
+
+        PetscSection weightSection = NULL;
+        err = PetscSectionCreate(PETSC_COMM_SELF, &weightSection);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionSetChart(weightSection, pStart, pEnd);PYLITH_CHECK_ERROR(err);
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            err = PetscSectionSetDof(weightSection, c, cellWeights[c-cStart]);PYLITH_CHECK_ERROR(err);
+        } // for
+        err = PetscSectionSetUp(weightSection);PYLITH_CHECK_ERROR(err);
+        err = DMSetLocalSection(dmOrig, weightSection);PYLITH_CHECK_ERROR(err);
+        err = PetscSectionDestroy(&weightSection);PYLITH_CHECK_ERROR(err);
+
+        if (0 == commRank) {
+            info << pythia::journal::at(__HERE__)
+                 << "Using cell weights from material costs and fault adjacency in partitioning." << pythia::journal::endl;
+        } // if
+    } // if
+
     if (0 == commRank) {
         info << pythia::journal::at(__HERE__)
              << "Distributing partitioned mesh." << pythia::journal::endl;
@@ -74,8 +123,54 @@ pylith::topology::Distributor::distribute(topology::Mesh* const newMesh,
 
     PetscDM dmNew = NULL;
     err = DMPlexDistribute(origMesh.dmMesh(), 0, NULL, &dmNew);PYLITH_CHECK_ERROR(err);
+    if (useWeights) {
+        err = DMSetLocalSection(dmOrig, NULL);PYLITH_CHECK_ERROR(err);
+        err = DMSetLocalSection(dmNew, NULL);PYLITH_CHECK_ERROR(err);
+    } // if
     newMesh->dmMesh(dmNew);
 
+    // Report load imbalance as the ratio of the maximum to the mean of the sum of the cell weights on each process.
+    pylith::int_array cellWeights;
+    _computeCellWeights(&cellWeights, *newMesh, weightIds, weights, numWeights, faultAdjacentWeight);
+    const PylithReal weightLocal = cellWeights.size() > 0 ? PylithReal(cellWeights.sum()) : 0.0;
+    PylithReal weightMax = 0.0, weightMean = 0.0, imbalance = 1.0;
+    _computeImbalance(&weightMax, &weightMean, &imbalance, weightLocal, newMesh->comm());
+    if (0 == commRank) {
+        info << pythia::journal::at(__HERE__)
+             << "Load imbalance of partition (maximum/mean of cell weight per process): " << imbalance << "."
+             << pythia::journal::endl;
+    } // if
+
+    // Summarize partition so partitioner settings can be evaluated before running the simulation.
+    pylith::int_array statsLocal;
+    _computePartitionStats(&statsLocal, *newMesh);
+    pylith::int_array statsTotal(NUM_STATS);
+    err = MPI_Allreduce(&statsLocal[0], &statsTotal[0], NUM_STATS, MPI_INT, MPI_SUM, newMesh->comm());PYLITH_CHECK_ERROR(err);
+    const int numSummaryStats = 3;
+    const PartitionStatEnum summaryStats[numSummaryStats] = { STAT_CELLS, STAT_OWNED_VERTICES, STAT_NEIGHBORS };
+    PylithReal summaryMax[numSummaryStats];
+    PylithReal summaryMean[numSummaryStats];
+    PylithReal summaryImbalance[numSummaryStats];
+    for (int i = 0; i < numSummaryStats; ++i) {
+        _computeImbalance(&summaryMax[i], &summaryMean[i], &summaryImbalance[i], statsLocal[summaryStats[i]],
+                          newMesh->comm());
+    } // for
+    if (0 == commRank) {
+        int commSize = 1;
+        err = MPI_Comm_size(newMesh->comm(), &commSize);PYLITH_CHECK_ERROR(err);
+        std::ostringstream msg;
+        msg << "Partition summary for " << commSize << " processes (maximum, average, maximum/average):";
+        for (int i = 0; i < numSummaryStats; ++i) {
+            msg << "\n    " << std::setw(20) << std::left << _getPartitionStatName(summaryStats[i]) << std::right
+                << std::setw(12) << int(summaryMax[i])
+                << std::setw(14) << std::fixed << std::setprecision(1) << summaryMean[i]
+                << std::setw(8) << std::setprecision(2) << summaryImbalance[i];
+        } // for
+        msg << "\n    Faces cut by partition: " << statsTotal[STAT_CUT_FACES] / 2
+            << ", vertices shared among processes: " << statsTotal[STAT_SHARED_VERTICES] - statsTotal[STAT_GHOST_VERTICES];
+        info << pythia::journal::at(__HERE__) << msg.str() << pythia::journal::endl;
+    } // if
+
     PYLITH_METHOD_END;
 } // distribute
 
@@ -87,6 +182,8 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
                                      const topology::Mesh& mesh) {
     PYLITH_METHOD_BEGIN;
 
+    assert(writer);
+
     const int commRank = mesh.commRank();
     if (0 == commRank) {
         pythia::journal::info_t info("mesh_distributor");
@@ -94,31 +191,65 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
              << "Writing partition." << pythia::journal::endl;
     } // if
 
-    // Setup and allocate PETSc vector
-    PylithScalar rankReal = PylithReal(commRank);
+    pylith::int_array stats;
+    _computePartitionStats(&stats, mesh);
+
+    // Cell fields with rank of each cell and the statistics of the partition containing the cell.
+    const int numFields = 1 + NUM_STATS;
+    std::vector<std::string> fieldNames(numFields);
+    fieldNames[0] = "partition";
+    for (int iStat = 0; iStat < NUM_STATS; ++iStat) {
+        fieldNames[1+iStat] = std::string("partition_") + _getPartitionStatName(PartitionStatEnum(iStat));
+    } // for
+
+    pylith::topology::Field partitionField(mesh);
+    partitionField.setLabel("partition");
+    for (int iField = 0; iField < numFields; ++iField) {
+        const char* componentNames[1] = { fieldNames[iField].c_str() };
+        const int basisOrder = 0;
+        const int quadOrder = 1;
+        const bool isBasisContinuous = true;
+        partitionField.subfieldAdd(fieldNames[iField].c_str(), fieldNames[iField].c_str(), pylith::topology::Field::SCALAR,
+                                   componentNames, 1, 1.0, basisOrder, quadOrder, mesh.dimension(),
+                                   pylith::topology::Field::DEFAULT_BASIS, isBasisContinuous,
+                                   pylith::topology::Field::POLYNOMIAL_SPACE);
+    } // for
+    partitionField.subfieldsSetup();
+    partitionField.createDiscretization();
+    partitionField.allocate();
+    partitionField.zeroLocal();
 
     PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
     topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
     const PetscInt cStart = cellsStratum.begin();
     const PetscInt cEnd = cellsStratum.end();
 
-    PetscVec partitionVec = NULL;
-    PylithScalar* partitionArray = NULL;
-    PetscErrorCode err;
-    err = VecCreate(mesh.comm(), &partitionVec);PYLITH_CHECK_ERROR(err);
-    err = VecSetSizes(partitionVec, cEnd-cStart, PETSC_DECIDE);PYLITH_CHECK_ERROR(err);
-    err = VecGetArray(partitionVec, &partitionArray);PYLITH_CHECK_ERROR(err);
+    pylith::int_array subfieldIndices(numFields);
+    for (int iField = 0; iField < numFields; ++iField) {
+        subfieldIndices[iField] = partitionField.subfieldInfo(fieldNames[iField].c_str()).index;
+    } // for
+    pylith::topology::VecVisitorMesh partitionVisitor(partitionField);
+    PetscScalar* partitionArray = partitionVisitor.localArray();
     for (PetscInt c = cStart; c < cEnd; ++c) {
-        partitionArray[c] = rankReal;
+        partitionArray[partitionVisitor.sectionSubfieldOffset(subfieldIndices[0], c)] = commRank;
+        for (int iStat = 0; iStat < NUM_STATS; ++iStat) {
+            partitionArray[partitionVisitor.sectionSubfieldOffset(subfieldIndices[1+iStat], c)] = stats[iStat];
+        } // for
     } // for
-    err = VecRestoreArray(partitionVec, &partitionArray);PYLITH_CHECK_ERROR(err);
+    partitionVisitor.clear();
 
     const PylithScalar t = 0.0;
-    const int numTimeSteps = 0;
-    writer->open(mesh, numTimeSteps);
+    const bool isInfo = true;
+    writer->open(mesh, isInfo);
     writer->openTimeStep(t, mesh);
-    assert(0); // :TODO: Fix this
-    // writer->writeCellField(t, partitionVec);
+    for (int iField = 0; iField < numFields; ++iField) {
+        pylith::meshio::OutputSubfield* subfield = pylith::meshio::OutputSubfield::create(partitionField, mesh,
+                                                                                         fieldNames[iField].c_str());
+        assert(subfield);
+        subfield->extractSubfield(partitionField, subfieldIndices[iField]);
+        writer->writeCellField(t, *subfield);
+        delete subfield;subfield = NULL;
+    } // for
     writer->closeTimeStep();
     writer->close();
 
@@ -126,4 +257,215 @@ pylith::topology::Distributor::write(meshio::DataWriter* const writer,
 } // write
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute weights of cells in mesh.
+void
+pylith::topology::Distributor::_computeCellWeights(int_array* cellWeights,
+                                                   const topology::Mesh& mesh,
+                                                   const int* weightIds,
+                                                   const PylithReal* weights,
+                                                   const int numWeights,
+                                                   const PylithReal faultAdjacentWeight) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(cellWeights);
+    assert(!numWeights || (weightIds && weights));
+
+    // Partitioners require integer weights; resolve relative costs to 0.1 of the cost of a unit-weight cell.
+    const PylithReal weightScale = 10.0;
+
+    PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+
+    std::map<int, PylithReal> idWeights;
+    for (int i = 0; i < numWeights; ++i) {
+        idWeights[weightIds[i]] = weights[i];
+    } // for
+
+    pylith::real_array costs(1.0, cEnd-cStart);
+    PetscErrorCode err = 0;
+    PetscDMLabel materialLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::getCellsLabelName(), &materialLabel);PYLITH_CHECK_ERROR(err);
+    if (materialLabel && !idWeights.empty()) {
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            PetscInt id = 0;
+            err = DMLabelGetValue(materialLabel, c, &id);PYLITH_CHECK_ERROR(err);
+            const std::map<int, PylithReal>::const_iterator iter = idWeights.find(id);
+            if (iter != idWeights.end()) {
+                costs[c-cStart] = iter->second;
+            } // if
+        } // for
+    } // if
+
+    if (faultAdjacentWeight != 1.0) {
+        std::vector<bool> isAdjacent(cEnd-cStart, false);
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            if (!pylith::topology::MeshOps::isCohesiveCell(dmMesh, c)) { continue; }
+            const PetscInt* cone = NULL;
+            PetscInt coneSize = 0;
+            err = DMPlexGetConeSize(dmMesh, c, &coneSize);PYLITH_CHECK_ERROR(err);
+            err = DMPlexGetCone(dmMesh, c, &cone);PYLITH_CHECK_ERROR(err);
+            for (PetscInt iCone = 0; iCone < coneSize; ++iCone) {
+                const PetscInt* support = NULL;
+                PetscInt supportSize = 0;
+                err = DMPlexGetSupportSize(dmMesh, cone[iCone], &supportSize);PYLITH_CHECK_ERROR(err);
+                err = DMPlexGetSupport(dmMesh, cone[iCone], &support);PYLITH_CHECK_ERROR(err);
+                for (PetscInt iSupport = 0; iSupport < supportSize; ++iSupport) {
+                    const PetscInt cell = support[iSupport];
+                    if ((cell >= cStart) && (cell < cEnd) && !pylith::topology::MeshOps::isCohesiveCell(dmMesh, cell)) {
+                        isAdjacent[cell-cStart] = true;
+                    } // if
+                } // for
+            } // for
+        } // for
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            if (isAdjacent[c-cStart]) {
+                costs[c-cStart] *= faultAdjacentWeight;
+            } // if
+        } // for
+    } // if
+
+    cellWeights->resize(cEnd-cStart);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        (*cellWeights)[c-cStart] = std::max(1, int(weightScale*costs[c-cStart] + 0.5));
+    } // for
+
+    PYLITH_METHOD_END;
+} // _computeCellWeights
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute partition statistics for this process.
+void
+pylith::topology::Distributor::_computePartitionStats(int_array* stats,
+                                                      const topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(stats);
+
+    PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    topology::Stratum facesStratum(dmMesh, topology::Stratum::HEIGHT, 1);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+
+    PetscErrorCode err;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+    // Ghost points are leaves of the point star forest; shared points are leaves or roots with leaves on other
+    // processes.
+    std::vector<bool> isGhost(pEnd-pStart, false);
+    std::vector<bool> isShared(pEnd-pStart, false);
+    std::set<PetscMPIInt> neighbors;
+    PetscSF pointSF = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dmMesh, &pointSF);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(pointSF, &numRoots, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    if (numRoots >= 0) {
+        for (PetscInt i = 0; i < numLeaves; ++i) {
+            const PetscInt point = leaves ? leaves[i] : i;
+            isGhost[point-pStart] = true;
+            isShared[point-pStart] = true;
+        } // for
+        const PetscInt* rootDegree = NULL;
+        err = PetscSFComputeDegreeBegin(pointSF, &rootDegree);PYLITH_CHECK_ERROR(err);
+        err = PetscSFComputeDegreeEnd(pointSF, &rootDegree);PYLITH_CHECK_ERROR(err);
+        for (PetscInt point = 0; point < numRoots; ++point) {
+            if (rootDegree[point] > 0) {
+                isShared[point-pStart] = true;
+            } // if
+        } // for
+
+        PetscInt numRootRanks = 0, numLeafRanks = 0;
+        const PetscMPIInt* rootRanks = NULL;
+        const PetscMPIInt* leafRanks = NULL;
+        err = PetscSFSetUp(pointSF);PYLITH_CHECK_ERROR(err);
+        err = PetscSFGetRootRanks(pointSF, &numRootRanks, &rootRanks, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+        err = PetscSFGetLeafRanks(pointSF, &numLeafRanks, &leafRanks, NULL, NULL);PYLITH_CHECK_ERROR(err);
+        neighbors.insert(rootRanks, rootRanks+numRootRanks);
+        neighbors.insert(leafRanks, leafRanks+numLeafRanks);
+        neighbors.erase(mesh.commRank());
+    } // if
+
+    stats->resize(NUM_STATS);
+    *stats = 0;
+    (*stats)[STAT_CELLS] = cellsStratum.size();
+    for (PetscInt v = verticesStratum.begin(); v < verticesStratum.end(); ++v) {
+        if (isGhost[v-pStart]) {
+            ++(*stats)[STAT_GHOST_VERTICES];
+        } else {
+            ++(*stats)[STAT_OWNED_VERTICES];
+        } // if/else
+        if (isShared[v-pStart]) {
+            ++(*stats)[STAT_SHARED_VERTICES];
+        } // if
+    } // for
+    for (PetscInt f = facesStratum.begin(); f < facesStratum.end(); ++f) {
+        if (isShared[f-pStart]) {
+            ++(*stats)[STAT_CUT_FACES];
+        } // if
+    } // for
+    (*stats)[STAT_NEIGHBORS] = neighbors.size();
+
+    PYLITH_METHOD_END;
+} // _computePartitionStats
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute maximum, mean, and imbalance (maximum/mean) of a value across processes.
+void
+pylith::topology::Distributor::_computeImbalance(PylithReal* valueMax,
+                                                 PylithReal* valueMean,
+                                                 PylithReal* imbalance,
+                                                 const PylithReal valueLocal,
+                                                 const MPI_Comm comm) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(valueMax);
+    assert(valueMean);
+    assert(imbalance);
+
+    PetscErrorCode err = 0;
+    int commSize = 1;
+    PylithReal valueTotal = 0.0;
+    err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&valueLocal, valueMax, 1, MPIU_REAL, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+    err = MPI_Allreduce(&valueLocal, &valueTotal, 1, MPIU_REAL, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+    *valueMean = valueTotal / commSize;
+    *imbalance = (*valueMean > 0.0) ? *valueMax / *valueMean : 1.0;
+
+    PYLITH_METHOD_END;
+} // _computeImbalance
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get name of partition statistic.
+const char*
+pylith::topology::Distributor::_getPartitionStatName(const PartitionStatEnum stat) {
+    switch (stat) {
+    case STAT_CELLS:
+        return "num_cells";
+    case STAT_OWNED_VERTICES:
+        return "num_owned_vertices";
+    case STAT_GHOST_VERTICES:
+        return "num_ghost_vertices";
+    case STAT_SHARED_VERTICES:
+        return "num_shared_vertices";
+    case STAT_CUT_FACES:
+        return "num_cut_faces";
+    case STAT_NEIGHBORS:
+        return "num_neighbors";
+    default:
+        assert(0);
+        throw std::logic_error("Unknown partition statistic.");
+    } // switch
+
+    return NULL; // Not reachable.
+} // _getPartitionStatName
+
+
 // End of file
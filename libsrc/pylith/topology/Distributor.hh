@@ -29,6 +29,8 @@
 #include "topologyfwd.hh" // forward declarations
 
 #include "pylith/meshio/meshiofwd.hh" // USES DataWriter<Mesh>
+#include "pylith/utils/arrayfwd.hh" // USES int_array
+#include "pylith/utils/types.hh" // USES PylithReal
 
 // Distributor ----------------------------------------------------------
 /// Distribute mesh among processors.
@@ -46,26 +48,109 @@ public :
   ~Distributor(void);
 
   /** Distribute mesh among processors.
+   *
+   * The partitioner balances the sum of the cell weights on each process. The weight of a cell is the weight
+   * associated with its material (or interface) identifier, multiplied by faultAdjacentWeight if the cell shares a
+   * face with a cohesive cell. Cells with identifiers not in weightIds have a weight of 1. All cells have the same
+   * weight if no weights are given and faultAdjacentWeight is 1.
    *
    * @param newMesh Distributed mesh (result).
    * @param origMesh Mesh to distribute.
    * @param partitionerName Name of PETSc partitioner to use in distributing mesh.
+   * @param weightIds Material and interface identifiers with weights.
+   * @param numWeightIds Number of identifiers with weights.
+   * @param weights Relative cost per cell for each identifier.
+   * @param numWeights Number of weights.
+   * @param faultAdjacentWeight Multiplier for weight of cells adjacent to cohesive cells.
    */
   static
   void distribute(topology::Mesh* const newMesh,
 		  const topology::Mesh& origMesh,
-		  const char* partitionerName);
+		  const char* partitionerName,
+		  const int* weightIds,
+		  const int numWeightIds,
+		  const PylithReal* weights,
+		  const int numWeights,
+		  const PylithReal faultAdjacentWeight);
 
   /** Write partitioning info for distributed mesh.
+   *
+   * Writes cell fields with the rank of each cell and the partition statistics of the process owning the cell: number
+   * of cells, owned vertices, ghost vertices, shared vertices, faces cut by the partition, and neighboring processes.
    *
    * @param writer Data writer for partition information.
    * @param mesh Distributed mesh.
-   * @param cs Coordinate system for mesh.
    */
   static
   void write(meshio::DataWriter* const writer,
 	     const topology::Mesh& mesh);
 
+// PRIVATE ENUMS ////////////////////////////////////////////////////////
+private :
+
+  /// Partition statistics for each process.
+  enum PartitionStatEnum {
+    STAT_CELLS=0, ///< Number of cells.
+    STAT_OWNED_VERTICES=1, ///< Number of vertices owned by process.
+    STAT_GHOST_VERTICES=2, ///< Number of vertices owned by other processes.
+    STAT_SHARED_VERTICES=3, ///< Number of vertices shared with other processes.
+    STAT_CUT_FACES=4, ///< Number of faces shared with other processes.
+    STAT_NEIGHBORS=5, ///< Number of neighboring processes.
+    NUM_STATS=6, ///< Number of statistics.
+  }; // PartitionStatEnum
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Compute partition statistics for this process.
+   *
+   * @param stats Partition statistics (result) [NUM_STATS].
+   * @param mesh Distributed mesh.
+   */
+  static
+  void _computePartitionStats(int_array* stats,
+			      const topology::Mesh& mesh);
+
+  /** Compute maximum, mean, and imbalance (maximum/mean) of a value across processes.
+   *
+   * @param valueMax Maximum value over processes (result).
+   * @param valueMean Mean value over processes (result).
+   * @param imbalance Ratio of maximum to mean; 1 if the mean is zero (result).
+   * @param valueLocal Value for this process.
+   * @param comm MPI communicator.
+   */
+  static
+  void _computeImbalance(PylithReal* valueMax,
+			 PylithReal* valueMean,
+			 PylithReal* imbalance,
+			 const PylithReal valueLocal,
+			 const MPI_Comm comm);
+
+  /** Get name of partition statistic.
+   *
+   * @param stat Partition statistic.
+   * @returns Name of statistic.
+   */
+  static
+  const char* _getPartitionStatName(const PartitionStatEnum stat);
+
+  /** Compute weights of cells in mesh.
+   *
+   * @param cellWeights Weight for each cell (result) [numCells].
+   * @param mesh Finite-element mesh.
+   * @param weightIds Material and interface identifiers with weights.
+   * @param weights Relative cost per cell for each identifier.
+   * @param numWeights Number of weights.
+   * @param faultAdjacentWeight Multiplier for weight of cells adjacent to cohesive cells.
+   */
+  static
+  void _computeCellWeights(int_array* cellWeights,
+			   const topology::Mesh& mesh,
+			   const int* weightIds,
+			   const PylithReal* weights,
+			   const int numWeights,
+			   const PylithReal faultAdjacentWeight);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -385,6 +385,74 @@ pylith::topology::Field::scatterVectorToLocal(const PetscVec vector,
 } // scatterVectorToLocal
 
 
+// ------------------------------------------------------------------------------------------------
+// Start scatter of section information across processors to update the global view of the field.
+void
+pylith::topology::Field::scatterLocalToVectorBegin(const PetscVec vector,
+                                                   InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(vector);
+
+    if (_dm) {
+        assert(_localVec);
+        PetscErrorCode err = DMLocalToGlobalBegin(_dm, _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // scatterLocalToVectorBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// Finish scatter of section information across processors to update the global view of the field.
+void
+pylith::topology::Field::scatterLocalToVectorEnd(const PetscVec vector,
+                                                 InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(vector);
+
+    if (_dm) {
+        assert(_localVec);
+        PetscErrorCode err = DMLocalToGlobalEnd(_dm, _localVec, mode, vector);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // scatterLocalToVectorEnd
+
+
+// ------------------------------------------------------------------------------------------------
+// Start scatter of PETSc vector information across processors to update the local view of the field.
+void
+pylith::topology::Field::scatterVectorToLocalBegin(const PetscVec vector,
+                                                   InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(vector);
+
+    if (_dm) {
+        assert(_localVec);
+        PetscErrorCode err = DMGlobalToLocalBegin(_dm, vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // scatterVectorToLocalBegin
+
+
+// ------------------------------------------------------------------------------------------------
+// Finish scatter of PETSc vector information across processors to update the local view of the field.
+void
+pylith::topology::Field::scatterVectorToLocalEnd(const PetscVec vector,
+                                                 InsertMode mode) const {
+    PYLITH_METHOD_BEGIN;
+    assert(vector);
+
+    if (_dm) {
+        assert(_localVec);
+        PetscErrorCode err = DMGlobalToLocalEnd(_dm, vector, mode, _localVec);PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // scatterVectorToLocalEnd
+
+
 // ------------------------------------------------------------------------------------------------
 // Scatter section information across processors to update the
 // output view of the field.
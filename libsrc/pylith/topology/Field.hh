@@ -280,6 +280,42 @@ public:
     void scatterVectorToLocal(const PetscVec vector,
                               InsertMode mode=INSERT_VALUES) const;
 
+    /** Start scatter of section information across processors to update the global view of the field.
+     *
+     * The local vector must not be modified until scatterLocalToVectorEnd() is called.
+     *
+     * @param[out] vector PETSc vector to update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterLocalToVectorBegin(const PetscVec vector,
+                                   InsertMode mode=INSERT_VALUES) const;
+
+    /** Finish scatter started with scatterLocalToVectorBegin().
+     *
+     * @param[out] vector PETSc vector to update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterLocalToVectorEnd(const PetscVec vector,
+                                 InsertMode mode=INSERT_VALUES) const;
+
+    /** Start scatter of global information across processors to update the local view of the field.
+     *
+     * The local vector must not be used until scatterVectorToLocalEnd() is called.
+     *
+     * @param[in] vector PETSc vector used in update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterVectorToLocalBegin(const PetscVec vector,
+                                   InsertMode mode=INSERT_VALUES) const;
+
+    /** Finish scatter started with scatterVectorToLocalBegin().
+     *
+     * @param[in] vector PETSc vector used in update.
+     * @param[in] mode Mode for scatter (INSERT_VALUES, ADD_VALUES).
+     */
+    void scatterVectorToLocalEnd(const PetscVec vector,
+                                 InsertMode mode=INSERT_VALUES) const;
+
     /** Scatter section information across processors to update the
      * output view of the field.
      *
@@ -30,6 +30,19 @@
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 
 #include "petscdm.h" // USES PetscDM
+#include "petscviewerhdf5.h" // USES PetscViewerHDF5
+
+extern "C" {
+    extern PetscErrorCode VecView_Seq(Vec,
+                                      PetscViewer);
+
+    extern PetscErrorCode VecView_MPI(Vec,
+                                      PetscViewer);
+
+    extern PetscErrorCode VecLoad_Default(Vec,
+                                          PetscViewer);
+
+}
 
 std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE> pylith::topology::FieldOps::feStore = std::map<pylith::topology::FieldBase::Discretization, pylith::topology::FE>();
 
@@ -265,4 +278,55 @@ pylith::topology::FieldOps::layoutsMatch(const pylith::topology::Field& fieldA,
 } // layoutsMatch
 
 
+// ------------------------------------------------------------------------------------------------
+// Write field values to checkpoint file.
+void
+pylith::topology::FieldOps::writeCheckpoint(PetscViewer viewer,
+                                            const pylith::topology::Field& field) {
+    PYLITH_METHOD_BEGIN;
+    assert(viewer);
+
+    PetscErrorCode err;
+    PetscDM dm = field.dmMesh();assert(dm);
+    PetscVec globalVec = NULL;
+    err = DMGetGlobalVector(dm, &globalVec);PYLITH_CHECK_ERROR(err);
+    field.scatterLocalToVector(globalVec);
+    err = PetscObjectSetName((PetscObject)globalVec, field.getLabel());PYLITH_CHECK_ERROR(err);
+
+    // Bypass DMPlex viewer, which writes to the /fields group.
+    PetscMPIInt commSize = 0;
+    err = MPI_Comm_size(PetscObjectComm((PetscObject)globalVec), &commSize);PYLITH_CHECK_ERROR(err);
+    if (1 == commSize) {
+        err = VecView_Seq(globalVec, viewer);PYLITH_CHECK_ERROR(err);
+    } else {
+        err = VecView_MPI(globalVec, viewer);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = DMRestoreGlobalVector(dm, &globalVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // writeCheckpoint
+
+
+// ------------------------------------------------------------------------------------------------
+// Read field values from checkpoint file.
+void
+pylith::topology::FieldOps::readCheckpoint(PetscViewer viewer,
+                                           pylith::topology::Field* field) {
+    PYLITH_METHOD_BEGIN;
+    assert(viewer);
+    assert(field);
+
+    PetscErrorCode err;
+    PetscDM dm = field->dmMesh();assert(dm);
+    PetscVec globalVec = NULL;
+    err = DMGetGlobalVector(dm, &globalVec);PYLITH_CHECK_ERROR(err);
+    err = PetscObjectSetName((PetscObject)globalVec, field->getLabel());PYLITH_CHECK_ERROR(err);
+    err = VecLoad_Default(globalVec, viewer);PYLITH_CHECK_ERROR(err);
+    field->scatterVectorToLocal(globalVec);
+    err = DMRestoreGlobalVector(dm, &globalVec);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // readCheckpoint
+
+
 // End of file
@@ -29,7 +29,7 @@
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 
 #include "FieldBase.hh" // USES FieldBase::Discretization
-#include "pylith/utils/petscfwd.h" // USES PetscFE
+#include "pylith/utils/petscfwd.h" // USES PetscFE, PetscViewer
 
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
 #include <map>
@@ -117,6 +117,29 @@ public:
     bool layoutsMatch(const pylith::topology::Field& fieldA,
                       const pylith::topology::Field& fieldB);
 
+    /** Write field values to checkpoint file.
+     *
+     * Values are written in parallel from the global vector using the current group of the viewer. The dataset is
+     * named using the label of the field.
+     *
+     * @param[in] viewer PETSc HDF5 viewer for checkpoint file.
+     * @param[in] field Field to write.
+     */
+    static
+    void writeCheckpoint(PetscViewer viewer,
+                         const pylith::topology::Field& field);
+
+    /** Read field values from checkpoint file.
+     *
+     * The checkpoint must have been written with the same number of processes and the same mesh partition.
+     *
+     * @param[in] viewer PETSc HDF5 viewer for checkpoint file.
+     * @param[inout] field Field to update.
+     */
+    static
+    void readCheckpoint(PetscViewer viewer,
+                        pylith::topology::Field* field);
+
     /** Free saved PetscFE objects.
      */
     static
@@ -393,4 +393,54 @@ pylith::topology::MeshOps::checkMaterialIds(const pylith::topology::Mesh& mesh,
 } // checkMaterialIds
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Check to make sure the cells for each value of the material label are consecutive.
+void
+pylith::topology::MeshOps::checkMaterialCellsConsecutive(const pylith::topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+    PetscDMLabel dmLabel = NULL;
+    const char* const labelName = pylith::topology::Mesh::getCellsLabelName();
+
+    PetscIS valuesIS = NULL;
+    PetscInt numValues = 0;
+    const PetscInt* values = NULL;
+    err = DMGetLabel(dmMesh, labelName, &dmLabel);PYLITH_CHECK_ERROR(err);
+    err = DMLabelGetValueIS(dmLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+        PetscIS pointsIS = NULL;
+        PetscInt numPoints = 0;
+        const PetscInt* points = NULL;
+        err = DMLabelGetStratumIS(dmLabel, values[iValue], &pointsIS);PYLITH_CHECK_ERROR(err);
+        err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);
+        err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 1; iPoint < numPoints; ++iPoint) {
+            if (points[iPoint] - points[iPoint-1] != 1) {
+                std::ostringstream msg;
+                msg << "Cells for label " << labelName << " " << values[iValue] << " are not consecutive ("
+                    << points[iPoint] << " and " << points[iPoint-1] << ").";
+
+                // Cleanup
+                err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+                err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+                err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+                err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+                throw std::runtime_error(msg.str());
+            } // if
+        } // for
+        err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+        err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // checkMaterialCellsConsecutive
+
+
 // End of file
@@ -117,6 +117,15 @@ public:
     void checkMaterialIds(const Mesh& mesh,
                           pylith::int_array& materialIds);
 
+    /** Check to make sure the cells for each value of the material label are consecutive.
+     *
+     * Reordering must keep the cells of each material (and the cohesive cells of each fault) consecutive.
+     *
+     * @param[in] mesh Finite-element mesh.
+     */
+    static
+    void checkMaterialCellsConsecutive(const Mesh& mesh);
+
     // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
 private:
 
@@ -0,0 +1,345 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SpaceFillingCurve.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/error.hh" // USES PYLITH_CHECK_ERROR
+
+#include <vector> // USES std::vector
+#include <map> // USES std::map
+#include <algorithm> // USES std::sort(), std::min(), std::max()
+#include <limits> // USES std::numeric_limits
+#include <cassert> // USES assert()
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+        class _SpaceFillingCurve {
+            // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Sort key for cell.
+            struct CellKey {
+                PetscInt group; ///< Order of first appearance of material label value.
+                uint64_t index; ///< Index along space-filling curve.
+                PetscInt cell; ///< Cell.
+
+                bool operator<(const CellKey& other) const {
+                    if (group != other.group) { return group < other.group; }
+                    if (index != other.index) { return index < other.index; }
+                    return cell < other.cell;
+                } // operator<
+
+            }; // CellKey
+
+        }; // _SpaceFillingCurve
+    } // topology
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Reorder vertices and cells in mesh.
+void
+pylith::topology::SpaceFillingCurve::reorder(topology::Mesh* mesh,
+                                             const CurveEnum curve) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(mesh);
+    PetscErrorCode err = 0;
+
+    PetscDM dmOrig = mesh->dmMesh();assert(dmOrig);
+    PetscIS permutation = NULL;
+    PetscDM dmNew = NULL;
+    _computePermutation(&permutation, dmOrig, curve);
+    err = DMPlexPermute(dmOrig, permutation, &dmNew);PYLITH_CHECK_ERROR(err);
+    _permutePointSF(dmNew, dmOrig, permutation);
+    err = ISDestroy(&permutation);PYLITH_CHECK_ERROR(err);
+    mesh->dmMesh(dmNew);
+
+    // Verify that all material points (cells) are consecutive.
+    pylith::topology::MeshOps::checkMaterialCellsConsecutive(*mesh);
+
+    PYLITH_METHOD_END;
+} // reorder
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute point permutation with cells ordered along a space-filling curve.
+void
+pylith::topology::SpaceFillingCurve::_computePermutation(PetscIS* permutation,
+                                                         const PetscDM dmMesh,
+                                                         const CurveEnum curve) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(permutation);
+    assert(dmMesh);
+
+    PetscErrorCode err = 0;
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    const PetscInt numCells = cellsStratum.size();
+
+    PetscInt spaceDim = 0;
+    err = DMGetCoordinateDim(dmMesh, &spaceDim);PYLITH_CHECK_ERROR(err);
+
+    // Centroids of cells (average of coordinates of vertices in closure).
+    std::vector<PylithReal> centroids(numCells*spaceDim, 0.0);
+    std::vector<PylithReal> coordsMin(spaceDim, std::numeric_limits<PylithReal>::max());
+    std::vector<PylithReal> coordsMax(spaceDim, -std::numeric_limits<PylithReal>::max());
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscScalar* coordsCell = NULL;
+        PetscInt coordsSize = 0;
+        coordsVisitor.getClosure(&coordsCell, &coordsSize, c);
+        const PetscInt numVertices = coordsSize / spaceDim;assert(numVertices > 0);
+        for (PetscInt iVertex = 0; iVertex < numVertices; ++iVertex) {
+            for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+                centroids[(c-cStart)*spaceDim+iDim] += coordsCell[iVertex*spaceDim+iDim] / numVertices;
+            } // for
+        } // for
+        coordsVisitor.restoreClosure(&coordsCell, &coordsSize, c);
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            coordsMin[iDim] = std::min(coordsMin[iDim], centroids[(c-cStart)*spaceDim+iDim]);
+            coordsMax[iDim] = std::max(coordsMax[iDim], centroids[(c-cStart)*spaceDim+iDim]);
+        } // for
+    } // for
+
+    // Map centroids to integer coordinates using the same scale in all directions, so the curve is not distorted.
+    const int numBits = std::min(32, 64 / int(spaceDim));
+    const PylithReal maxCoord = PylithReal((uint64_t(1) << numBits) - 1);
+    PylithReal maxExtent = 0.0;
+    for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+        maxExtent = std::max(maxExtent, coordsMax[iDim] - coordsMin[iDim]);
+    } // for
+    const PylithReal scale = (maxExtent > 0.0) ? maxCoord / maxExtent : 0.0;
+
+    // Keep cells of each material and cohesive cells of each fault together, in the order the groups first appear.
+    PetscDMLabel materialLabel = NULL;
+    err = DMGetLabel(dmMesh, pylith::topology::Mesh::getCellsLabelName(), &materialLabel);PYLITH_CHECK_ERROR(err);
+    std::map<PetscInt, PetscInt> groups;
+    std::vector<_SpaceFillingCurve::CellKey> cellKeys(numCells);
+    std::vector<unsigned int> coordsInt(spaceDim);
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+        PetscInt materialId = -1;
+        if (materialLabel) {
+            err = DMLabelGetValue(materialLabel, c, &materialId);PYLITH_CHECK_ERROR(err);
+        } // if
+        if (groups.find(materialId) == groups.end()) {
+            const PetscInt numGroups = groups.size();
+            groups[materialId] = numGroups;
+        } // if
+
+        for (PetscInt iDim = 0; iDim < spaceDim; ++iDim) {
+            const PylithReal value = (centroids[(c-cStart)*spaceDim+iDim] - coordsMin[iDim]) * scale;
+            coordsInt[iDim] = (unsigned int)(std::min(std::max(value, PylithReal(0.0)), maxCoord));
+        } // for
+
+        _SpaceFillingCurve::CellKey& key = cellKeys[c-cStart];
+        key.group = groups[materialId];
+        key.index = (HILBERT == curve) ? _hilbertIndex(&coordsInt[0], spaceDim, numBits) :
+                    _mortonIndex(&coordsInt[0], spaceDim, numBits);
+        key.cell = c;
+    } // for
+    std::sort(cellKeys.begin(), cellKeys.end());
+
+    // Number cells in sorted order and other points in the order they are first reached in the closures of the
+    // reordered cells, keeping each depth stratum in place.
+    PetscInt depth = 0;
+    err = DMPlexGetDepth(dmMesh, &depth);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> stratumNext(depth+1);
+    for (PetscInt iDepth = 0; iDepth <= depth; ++iDepth) {
+        PetscInt dStart = 0, dEnd = 0;
+        err = DMPlexGetDepthStratum(dmMesh, iDepth, &dStart, &dEnd);PYLITH_CHECK_ERROR(err);
+        stratumNext[iDepth] = dStart;
+    } // for
+
+    PetscInt* perm = NULL;
+    err = PetscMalloc1(pEnd-pStart, &perm);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        perm[p-pStart] = -1;
+    } // for
+    for (PetscInt iCell = 0; iCell < numCells; ++iCell) {
+        const PetscInt cell = cellKeys[iCell].cell;
+        perm[cell-pStart] = cStart + iCell;
+
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            const PetscInt point = closure[2*iPoint];
+            if (perm[point-pStart] < 0) {
+                PetscInt pointDepth = 0;
+                err = DMPlexGetPointDepth(dmMesh, point, &pointDepth);PYLITH_CHECK_ERROR(err);
+                perm[point-pStart] = stratumNext[pointDepth]++;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Points not in the closure of any cell keep their relative order at the end of their stratum.
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        if (perm[p-pStart] < 0) {
+            PetscInt pointDepth = 0;
+            err = DMPlexGetPointDepth(dmMesh, p, &pointDepth);PYLITH_CHECK_ERROR(err);
+            perm[p-pStart] = stratumNext[pointDepth]++;
+        } // if
+    } // for
+
+    err = ISCreateGeneral(PETSC_COMM_SELF, pEnd-pStart, perm, PETSC_OWN_POINTER, permutation);PYLITH_CHECK_ERROR(err);
+    err = ISSetPermutation(*permutation);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _computePermutation
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Update point star forest of permuted mesh.
+void
+pylith::topology::SpaceFillingCurve::_permutePointSF(PetscDM dmNew,
+                                                     const PetscDM dmOrig,
+                                                     const PetscIS permutation) {
+    PYLITH_METHOD_BEGIN;
+
+    assert(dmNew);
+    assert(dmOrig);
+    assert(permutation);
+
+    PetscErrorCode err = 0;
+    PetscSF sfOrig = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    const PetscSFNode* remotes = NULL;
+    err = DMGetPointSF(dmOrig, &sfOrig);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sfOrig, &numRoots, &numLeaves, &leaves, &remotes);PYLITH_CHECK_ERROR(err);
+    if (numRoots < 0) { // Mesh has not been distributed.
+        PYLITH_METHOD_END;
+    } // if
+
+    // Send new numbers of roots to leaves, so leaves can point to the new numbers of their roots.
+    const PetscInt* perm = NULL;
+    PetscInt permSize = 0;
+    err = ISGetLocalSize(permutation, &permSize);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(permutation, &perm);PYLITH_CHECK_ERROR(err);
+    std::vector<PetscInt> remotePerm(permSize, -1);
+    err = PetscSFBcastBegin(sfOrig, MPIU_INT, perm, &remotePerm[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfOrig, MPIU_INT, perm, &remotePerm[0], MPI_REPLACE);PYLITH_CHECK_ERROR(err);
+
+    PetscInt* leavesNew = NULL;
+    PetscSFNode* remotesNew = NULL;
+    err = PetscMalloc1(numLeaves, &leavesNew);PYLITH_CHECK_ERROR(err);
+    err = PetscMalloc1(numLeaves, &remotesNew);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iLeaf = 0; iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt leaf = leaves ? leaves[iLeaf] : iLeaf;
+        leavesNew[iLeaf] = perm[leaf];
+        remotesNew[iLeaf].rank = remotes[iLeaf].rank;
+        remotesNew[iLeaf].index = remotePerm[leaf];
+    } // for
+    err = ISRestoreIndices(permutation, &perm);PYLITH_CHECK_ERROR(err);
+
+    PetscSF sfNew = NULL;
+    err = PetscSFCreate(PetscObjectComm((PetscObject) dmNew), &sfNew);PYLITH_CHECK_ERROR(err);
+    err = PetscSFSetGraph(sfNew, numRoots, numLeaves, leavesNew, PETSC_OWN_POINTER, remotesNew,
+                          PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+    err = DMSetPointSF(dmNew, sfNew);PYLITH_CHECK_ERROR(err);
+    err = PetscSFDestroy(&sfNew);PYLITH_CHECK_ERROR(err);
+
+    PYLITH_METHOD_END;
+} // _permutePointSF
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute index along Morton curve from integer coordinates.
+uint64_t
+pylith::topology::SpaceFillingCurve::_mortonIndex(const unsigned int* coords,
+                                                  const int dim,
+                                                  const int numBits) {
+    assert(coords);
+
+    // Interleave bits of coordinates, most significant bits first.
+    uint64_t index = 0;
+    for (int iBit = numBits-1; iBit >= 0; --iBit) {
+        for (int iDim = 0; iDim < dim; ++iDim) {
+            index = (index << 1) | ((coords[iDim] >> iBit) & 1u);
+        } // for
+    } // for
+
+    return index;
+} // _mortonIndex
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Compute index along Hilbert curve from integer coordinates.
+uint64_t
+pylith::topology::SpaceFillingCurve::_hilbertIndex(const unsigned int* coords,
+                                                   const int dim,
+                                                   const int numBits) {
+    assert(coords);
+    assert(dim <= 3);
+
+    if (1 == dim) {
+        return coords[0];
+    } // if
+
+    unsigned int x[3];
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        x[iDim] = coords[iDim];
+    } // for
+
+    // Inverse undo of excess work.
+    const unsigned int m = 1u << (numBits-1);
+    for (unsigned int q = m; q > 1; q >>= 1) {
+        const unsigned int p = q - 1;
+        for (int iDim = 0; iDim < dim; ++iDim) {
+            if (x[iDim] & q) {
+                x[0] ^= p; // invert
+            } else {
+                const unsigned int t = (x[0] ^ x[iDim]) & p; // exchange
+                x[0] ^= t;
+                x[iDim] ^= t;
+            } // if/else
+        } // for
+    } // for
+
+    // Gray encode.
+    for (int iDim = 1; iDim < dim; ++iDim) {
+        x[iDim] ^= x[iDim-1];
+    } // for
+    unsigned int t = 0;
+    for (unsigned int q = m; q > 1; q >>= 1) {
+        if (x[dim-1] & q) {
+            t ^= q - 1;
+        } // if
+    } // for
+    for (int iDim = 0; iDim < dim; ++iDim) {
+        x[iDim] ^= t;
+    } // for
+
+    // Index is the interleaved bits of the transposed coordinates.
+    return _mortonIndex(x, dim, numBits);
+} // _hilbertIndex
+
+
+// End of file
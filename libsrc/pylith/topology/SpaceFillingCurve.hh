@@ -0,0 +1,126 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Reordering of cells along a space-filling curve (Hilbert or Morton) through the cell centroids.
+ *
+ * Cells are sorted by the position of their centroid along the curve within each value of the material label, so the
+ * cells of each material and the cohesive cells of each fault stay consecutive and in the same relative order. The
+ * other points are numbered in the order they are first reached in the closures of the reordered cells. Unlike
+ * reverse Cuthill-McKee, the reordering only uses local information, so it can be applied on each process after the
+ * mesh has been distributed.
+ */
+
+#if !defined(pylith_topology_spacefillingcurve_hh)
+#define pylith_topology_spacefillingcurve_hh
+
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscDM, PetscIS
+
+#include <stdint.h> // USES uint64_t
+
+class pylith::topology::SpaceFillingCurve {
+    friend class TestSpaceFillingCurve; // unit testing
+
+    // PUBLIC ENUMS ////////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    enum CurveEnum {
+        HILBERT=0, ///< Hilbert curve.
+        MORTON=1 ///< Morton (Z-order) curve.
+    }; // CurveEnum
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /** Reorder vertices and cells of mesh along a space-filling curve.
+     *
+     * @param[inout] mesh PyLith finite-element mesh.
+     * @param[in] curve Type of space-filling curve.
+     */
+    static
+    void reorder(topology::Mesh* mesh,
+                 const CurveEnum curve=HILBERT);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Compute point permutation with cells ordered along a space-filling curve.
+     *
+     * @param[out] permutation Point permutation, permutation[oldPoint] = newPoint.
+     * @param[in] dmMesh PETSc DM for mesh.
+     * @param[in] curve Type of space-filling curve.
+     */
+    static
+    void _computePermutation(PetscIS* permutation,
+                             const PetscDM dmMesh,
+                             const CurveEnum curve);
+
+    /** Update point star forest of permuted mesh.
+     *
+     * @param[inout] dmNew PETSc DM for permuted mesh.
+     * @param[in] dmOrig PETSc DM for original mesh.
+     * @param[in] permutation Point permutation, permutation[oldPoint] = newPoint.
+     */
+    static
+    void _permutePointSF(PetscDM dmNew,
+                         const PetscDM dmOrig,
+                         const PetscIS permutation);
+
+    /** Compute index along Morton curve from integer coordinates.
+     *
+     * @param[in] coords Integer coordinates.
+     * @param[in] dim Number of coordinates.
+     * @param[in] numBits Number of bits in each coordinate.
+     * @returns Index along curve.
+     */
+    static
+    uint64_t _mortonIndex(const unsigned int* coords,
+                          const int dim,
+                          const int numBits);
+
+    /** Compute index along Hilbert curve from integer coordinates.
+     *
+     * Uses the transpose form of the Hilbert index (J. Skilling, Programming the Hilbert curve, AIP Conf. Proc. 707,
+     * 2004).
+     *
+     * @param[in] coords Integer coordinates.
+     * @param[in] dim Number of coordinates.
+     * @param[in] numBits Number of bits in each coordinate.
+     * @returns Index along curve.
+     */
+    static
+    uint64_t _hilbertIndex(const unsigned int* coords,
+                           const int dim,
+                           const int numBits);
+
+    // NOT IMPLEMENTED /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    SpaceFillingCurve(void); ///< Not Implemented
+    SpaceFillingCurve(const SpaceFillingCurve&); ///< Not implemented
+    const SpaceFillingCurve& operator=(const SpaceFillingCurve&); ///< Not implemented
+
+}; // SpaceFillingCurve
+
+#endif // pylith_topology_spacefillingcurve_hh
+
+// End of file
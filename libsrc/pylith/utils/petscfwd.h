@@ -61,6 +61,9 @@ typedef struct _p_DMLabel* PetscDMLabel;
 /// forward declaration for PETSc IS
 typedef struct _p_IS* PetscIS;
 
+/// forward declaration for PETSc SF
+typedef struct _p_PetscSF* PetscSF;
+
 /// forward declaration for PETSc ISLocalToGlobalMapping
 typedef struct _p_ISLocalToGlobalMapping* PetscISLocalToGlobalMapping;
 
@@ -73,6 +76,9 @@ typedef struct _p_PetscDS* PetscDS;
 /// forward declaration for PETSc FE
 typedef struct _p_PetscFE* PetscFE;
 
+/// forward declaration for PETSc Viewer
+typedef struct _p_PetscViewer* PetscViewer;
+
 #endif // pylith_utils_petscfwd_h
 
 // End of file
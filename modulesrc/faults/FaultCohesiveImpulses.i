@@ -0,0 +1,145 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file modulesrc/faults/FaultCohesiveImpulses.i
+ *
+ * @brief Python interface to C++ FaultCohesiveImpulses object.
+ */
+
+namespace pylith {
+    namespace faults {
+        class FaultCohesiveImpulses : public pylith::faults::FaultCohesive {
+            // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Default constructor.
+            FaultCohesiveImpulses(void);
+
+            /// Destructor.
+            virtual ~FaultCohesiveImpulses(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set indices of slip components for impulses.
+             *
+             * @param[in] flags Array of indices of slip components (0=opening, 1=left-lateral, 2=reverse).
+             * @param[in] size Size of array.
+             */
+            %apply(int* INPLACE_ARRAY1, int DIM1) {
+                (const int* flags,
+                 const int size)
+            };
+            void setImpulseDOF(const int* flags,
+                               const int size);
+
+            %clear(const int* flags, const int size);
+
+            /** Get number of slip components for impulses.
+             *
+             * @returns Number of slip components.
+             */
+            int getNumImpulseDOF(void) const;
+
+            /** Set threshold for nonzero impulse amplitude.
+             *
+             * @param[in] value Threshold for nonzero amplitude (dimensional).
+             */
+            void setThreshold(const double value);
+
+            /** Get threshold for nonzero impulse amplitude.
+             *
+             * @returns Threshold for nonzero amplitude (dimensional).
+             */
+            double getThreshold(void) const;
+
+            /** Get number of impulses over all processes.
+             *
+             * @returns Number of impulses.
+             */
+            size_t getNumImpulses(void) const;
+
+            /** Verify configuration is acceptable.
+             *
+             * @param[in] solution Solution field.
+             */
+            void verifyConfiguration(const pylith::topology::Field& solution) const;
+
+            /** Create integrator and set kernels.
+             *
+             * @param[in] solution Solution field.
+             * @returns Integrator if applicable, otherwise NULL.
+             */
+            pylith::feassemble::Integrator* createIntegrator(const pylith::topology::Field& solution);
+
+            /** Create constraint and set kernels.
+             *
+             * @param[in] solution Solution field.
+             * @returns Constraint if applicable, otherwise NULL.
+             */
+            pylith::feassemble::Constraint* createConstraint(const pylith::topology::Field& solution);
+
+            /** Create auxiliary field.
+             *
+             * @param[in] solution Solution field.
+             * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+             *
+             * @returns Auxiliary field if applicable, otherwise NULL.
+             */
+            pylith::topology::Field* createAuxiliaryField(const pylith::topology::Field& solution,
+                                                          const pylith::topology::Mesh& domainMesh);
+
+            /** Create derived field.
+             *
+             * @param[in] solution Solution field.
+             * @param[in\ domainMesh Finite-element mesh associated with integration domain.
+             *
+             * @returns Derived field if applicable, otherwise NULL.
+             */
+            pylith::topology::Field* createDerivedField(const pylith::topology::Field& solution,
+                                                        const pylith::topology::Mesh& domainMesh);
+
+            /** Update auxiliary subfields for impulse.
+             *
+             * @param[out] auxiliaryField Auxiliary field.
+             * @param[in] t Nondimensional time corresponding to index of impulse.
+             */
+            void updateAuxiliaryField(pylith::topology::Field* auxiliaryField,
+                                      const double t);
+
+            // PROTECTED METHODS ///////////////////////////////////////////////////////////////////////////////////////
+protected:
+
+            /** Get auxiliary factory associated with physics.
+             *
+             * @return Auxiliary factory for physics object.
+             */
+            pylith::feassemble::AuxiliaryFactory* _getAuxiliaryFactory(void);
+
+            /** Update kernel constants.
+             *
+             * @param[in] dt Current time step.
+             */
+            void _updateKernelConstants(const PylithReal dt);
+
+        }; // class FaultCohesiveImpulses
+
+    } // faults
+} // pylith
+
+// End of file
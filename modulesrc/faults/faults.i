@@ -21,6 +21,7 @@
 %{
 #include "pylith/faults/FaultCohesive.hh"
 #include "pylith/faults/FaultCohesiveKin.hh"
+#include "pylith/faults/FaultCohesiveImpulses.hh"
 #include "pylith/faults/KinSrc.hh"
 #include "pylith/faults/KinSrcStep.hh"
 #include "pylith/faults/KinSrcRamp.hh"
@@ -59,6 +60,7 @@ import_array();
 
 %include "FaultCohesive.i"
 %include "FaultCohesiveKin.i"
+%include "FaultCohesiveImpulses.i"
 %include "KinSrc.i"
 %include "KinSrcStep.i"
 %include "KinSrcRamp.i"
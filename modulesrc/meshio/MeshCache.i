@@ -0,0 +1,50 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/meshio/MeshCache.i
+ *
+ * @brief Python interface to C++ MeshCache.
+ */
+
+%inline %{
+  /** Write mesh to cache file.
+   *
+   * @param mesh Finite-element mesh.
+   * @param filename Name of cache file.
+   */
+  void
+  MeshCache_write(const pylith::topology::Mesh& mesh,
+		  const char* filename) {
+    pylith::meshio::MeshCache::write(mesh, filename);
+  } // write
+
+  /** Read mesh from cache file.
+   *
+   * @param mesh Finite-element mesh.
+   * @param filename Name of cache file.
+   * @returns True if mesh is distributed, false if it must be redistributed.
+   */
+  bool
+  MeshCache_read(pylith::topology::Mesh* mesh,
+		 const char* filename) {
+    return pylith::meshio::MeshCache::read(mesh, filename);
+  } // read
+%}
+
+// End of file
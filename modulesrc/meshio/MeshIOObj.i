@@ -66,6 +66,18 @@ namespace pylith {
        */
       bool debug(void) const;
       
+      /** Set flag for reading mesh in parallel.
+       *
+       * @param value True if each process reads a slab of the mesh, false if process 0 reads the entire mesh.
+       */
+      void setParallelRead(const bool value);
+      
+      /** Get flag for reading mesh in parallel.
+       *
+       * @returns True if each process reads a slab of the mesh, false if process 0 reads the entire mesh.
+       */
+      bool getParallelRead(void) const;
+      
       /** Read mesh from file.
        *
        * @param mesh PyLith finite-element mesh.
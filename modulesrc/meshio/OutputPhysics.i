@@ -105,6 +105,15 @@ public:
                         const pylith::topology::Field& solution,
                         const bool infoOnly);
 
+            /** Check whether observer will write output at time t when it receives the next update.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @returns True if observer will write output at time t, false otherwise.
+             */
+            bool willWrite(const PylithReal t,
+                           const PylithInt tindex) const;
+
         }; // OutputPhysics
 
     } // meshio
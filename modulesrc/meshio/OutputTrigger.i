@@ -50,6 +50,30 @@ public:
             bool shouldWrite(const PylithReal t,
                              const PylithInt tindex) = 0;
 
+            /** Check whether output will be written at time t without updating the state of the trigger.
+             *
+             * @param[in] t Time of proposed write.
+             * @param[in] tindex Index of current time step.
+             * @returns True if output will be written at time t, false otherwise.
+             */
+            virtual
+            bool willWrite(const PylithReal t,
+                           const PylithInt tindex) const = 0;
+
+            /** Get state of trigger (when output was previously written) for checkpointing.
+             *
+             * @returns State of trigger.
+             */
+            virtual
+            PylithReal getState(void) const = 0;
+
+            /** Set state of trigger (when output was previously written) when restarting from a checkpoint.
+             *
+             * @param[in] value State of trigger.
+             */
+            virtual
+            void setState(const PylithReal value) = 0;
+
         }; // OutputTrigger
 
     } // meshio
@@ -45,6 +45,27 @@ namespace pylith {
 	  bool shouldWrite(const PylithReal t,
 			   const PylithInt tindex);
 
+	  /** Check whether output will be written at time t without updating the state of the trigger.
+	   *
+	   * @param[in] t Time of proposed write.
+	   * @param[in] tindex Index of current time step.
+	   * @returns True if output will be written at time t, false otherwise.
+	   */
+	  bool willWrite(const PylithReal t,
+			 const PylithInt tindex) const;
+
+	  /** Get state of trigger (when output was previously written) for checkpointing.
+	   *
+	   * @returns State of trigger.
+	   */
+	  PylithReal getState(void) const;
+
+	  /** Set state of trigger (when output was previously written) when restarting from a checkpoint.
+	   *
+	   * @param[in] value State of trigger.
+	   */
+	  void setState(const PylithReal value);
+
 	  /** Set number of steps to skip between writes.
 	   *
 	   * @param[in] Number of steps to skip between writes.
@@ -36,6 +36,7 @@
 #if defined(ENABLE_HDF5)
 #include "pylith/meshio/DataWriterHDF5.hh"
 #include "pylith/meshio/DataWriterHDF5Ext.hh"
+#include "pylith/meshio/MeshCache.hh"
 #endif
 #include "pylith/meshio/OutputObserver.hh"
 #include "pylith/meshio/OutputSoln.hh"
@@ -89,6 +90,7 @@ import_array();
 #if defined(ENABLE_HDF5)
 %include "DataWriterHDF5.i"
 %include "DataWriterHDF5Ext.i"
+%include "MeshCache.i"
 #endif
 %include "OutputObserver.i"
 %include "OutputSoln.i"
@@ -22,14 +22,18 @@
 // Header files for module C++ code
 %{
 #include <petsc.h>
+#include <string> // USES std::string
+#include <cstring> // USES strlen()
 %}
 
 %include "typemaps.i"
+%include "std_string.i"
 
 // Interfaces
 %include "mpi_comm.i"
 %include "mpi_error.i"
 %include "mpi_reduce.i"
+%include "mpi_bcast.i"
 
 
 // End of file
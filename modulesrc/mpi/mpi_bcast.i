@@ -0,0 +1,41 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+// ----------------------------------------------------------------------
+// bcast_string
+%inline %{
+  std::string
+    bcast_string(const char* value,
+		 int root,
+		 MPI_Comm* comm) {
+    int rank = 0;
+    MPI_Comm_rank(*comm, &rank);
+    int length = (rank == root && value) ? int(strlen(value)) : 0;
+    MPI_Bcast(&length, 1, MPI_INT, root, *comm);
+    std::string result(length, ' ');
+    if (rank == root && length > 0) {
+      result.assign(value, length);
+    } // if
+    if (length > 0) {
+      MPI_Bcast(&result[0], length, MPI_CHAR, root, *comm);
+    } // if
+    return result;
+  } // bcast_string
+%}
+
+
+// End of file
@@ -0,0 +1,72 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2016 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/problems/GreensFns.i
+ *
+ * @brief Python interface to C++ GreensFns.
+ */
+
+namespace pylith {
+    namespace problems {
+        class GreensFns : public pylith::problems::Problem {
+            // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            /// Constructor
+            GreensFns(void);
+
+            /// Destructor
+            ~GreensFns(void);
+
+            /// Deallocate PETSc and local data structures.
+            void deallocate(void);
+
+            /** Set fault with slip impulses.
+             *
+             * @param[in] fault Fault with slip impulses (must also be one of the interfaces).
+             */
+            void setFaultImpulses(pylith::faults::FaultCohesiveImpulses* fault);
+
+            /** Set number of impulses solved together as a block of right hand sides.
+             *
+             * @param[in] value Number of impulses in each block (1 means solve impulses one at a time).
+             */
+            void setRHSBlockSize(const size_t value);
+
+            /** Get number of impulses solved together as a block of right hand sides.
+             *
+             * @returns Number of impulses in each block.
+             */
+            size_t getRHSBlockSize(void) const;
+
+            /// Verify configuration.
+            void verifyConfiguration(void) const;
+
+            /// Initialize.
+            void initialize(void);
+
+            /// Compute Green's functions for all impulses.
+            void solve(void);
+
+        }; // GreensFns
+
+    } // problems
+} // pylith
+
+// End of file
@@ -72,6 +72,16 @@ public:
                         const pylith::topology::Field& solution,
                         const bool infoOnly) = 0;
 
+            /** Check whether observer will write output at time t when it receives the next update.
+             *
+             * @param[in] t Current time.
+             * @param[in] tindex Current time step.
+             * @returns True if observer will write output at time t, false otherwise.
+             */
+            virtual
+            bool willWrite(const PylithReal t,
+                           const PylithInt tindex) const;
+
         }; // ObserverPhysics
 
     } // problems
@@ -69,6 +69,18 @@ public:
              */
             SolverTypeEnum getSolverType(void) const;
 
+            /** Set per-process memory budget for caching cell geometry in integration domains.
+             *
+             * @param[in] value Maximum memory (in MB) for cached cell geometry.
+             */
+            void setGeometryCacheBudget(const PylithReal value);
+
+            /** Get per-process memory budget for caching cell geometry in integration domains.
+             *
+             * @returns Maximum memory (in MB) for cached cell geometry.
+             */
+            PylithReal getGeometryCacheBudget(void) const;
+
             /** Set manager of scales used to nondimensionalize problem.
              *
              * @param[in] dim Nondimensionalizer.
@@ -140,6 +152,12 @@ public:
             virtual
             void initialize(void);
 
+            /** Write summary of time spent in each physics, ranked by time.
+             *
+             * Times are the maximum over processes; floating point operations are the sum over processes.
+             */
+            void logPerformanceSummary(void) const;
+
         }; // Problem
 
     } // problems
@@ -25,6 +25,20 @@
 namespace pylith {
     namespace problems {
         class TimeDependent : public pylith::problems::Problem {
+            // PUBLIC ENUM /////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+            enum JacobianTypeEnum {
+                JACOBIAN_ASSEMBLED, // Assemble sparse matrix for Jacobian.
+                JACOBIAN_MATRIX_FREE, // Matrix-free action of Jacobian (PETSc MatShell).
+            }; // JacobianTypeEnum
+
+            enum PredictorEnum {
+                PREDICTOR_NONE=0, // Start nonlinear solve from solution at previous time step.
+                PREDICTOR_LINEAR=1, // Extrapolate solutions at previous 2 time steps.
+                PREDICTOR_QUADRATIC=2, // Extrapolate solutions at previous 3 time steps.
+            }; // PredictorEnum
+
             // PUBLIC MEMBERS //////////////////////////////////////////////////////////////////////////////////////////
 public:
 
@@ -85,6 +99,42 @@ public:
              */
             double getInitialTimeStep(void) const;
 
+            /** Set type of Jacobian for implicit time stepping.
+             *
+             * @param[in] value Type of Jacobian.
+             */
+            void setJacobianType(const JacobianTypeEnum value);
+
+            /** Get type of Jacobian for implicit time stepping.
+             *
+             * @returns Type of Jacobian.
+             */
+            JacobianTypeEnum getJacobianType(void) const;
+
+            /** Set predictor for initial guess of nonlinear solve in implicit time stepping.
+             *
+             * @param[in] value Type of predictor.
+             */
+            void setPredictor(const PredictorEnum value);
+
+            /** Get predictor for initial guess of nonlinear solve in implicit time stepping.
+             *
+             * @returns Type of predictor.
+             */
+            PredictorEnum getPredictor(void) const;
+
+            /** Set flag for assembling sparse matrix for preconditioner with matrix-free Jacobian.
+             *
+             * @param[in] value True if preconditioner matrix should be assembled, false otherwise.
+             */
+            void setAssemblePreconditioner(const bool value);
+
+            /** Get flag for assembling sparse matrix for preconditioner with matrix-free Jacobian.
+             *
+             * @returns True if preconditioner matrix is assembled, false otherwise.
+             */
+            bool getAssemblePreconditioner(void) const;
+
             /** Set initial conditions.
              *
              * @param[in] ic Array of initial conditions.
@@ -107,6 +157,90 @@ public:
              */
             void setProgressMonitor(pylith::problems::ProgressMonitorTime* monitor);
 
+            /** Set name of checkpoint file.
+             *
+             * @param[in] filename Name of checkpoint file.
+             */
+            void setCheckpointFilename(const char* filename);
+
+            /** Get name of checkpoint file.
+             *
+             * @returns Name of checkpoint file.
+             */
+            const char* getCheckpointFilename(void) const;
+
+            /** Set number of time steps between writing checkpoints.
+             *
+             * @param[in] value Number of time steps between checkpoints (0 means never write checkpoints).
+             */
+            void setCheckpointInterval(const size_t value);
+
+            /** Get number of time steps between writing checkpoints.
+             *
+             * @returns Number of time steps between checkpoints.
+             */
+            size_t getCheckpointInterval(void) const;
+
+            /** Set flag for restarting from checkpoint file.
+             *
+             * @param[in] value True if problem resumes from checkpoint file, false otherwise.
+             */
+            void setRestart(const bool value);
+
+            /** Get flag for restarting from checkpoint file.
+             *
+             * @returns True if problem resumes from checkpoint file, false otherwise.
+             */
+            bool getRestart(void) const;
+
+            /** Set flag for multirate explicit time stepping.
+             *
+             * @param[in] value True if using multirate explicit time stepping, false otherwise.
+             */
+            void setMultirate(const bool value);
+
+            /** Get flag for multirate explicit time stepping.
+             *
+             * @returns True if using multirate explicit time stepping, false otherwise.
+             */
+            bool getMultirate(void) const;
+
+            /** Set flag for overlapping halo exchange with residual assembly.
+             *
+             * @param[in] value True if overlapping halo exchange with residual assembly, false otherwise.
+             */
+            void setOverlapHaloExchange(const bool value);
+
+            /** Get flag for overlapping halo exchange with residual assembly.
+             *
+             * @returns True if overlapping halo exchange with residual assembly, false otherwise.
+             */
+            bool getOverlapHaloExchange(void) const;
+
+            /** Set flag for managing reuse of the preconditioner across time steps.
+             *
+             * @param[in] value True if managing reuse of the preconditioner, false to leave it to the PETSc options.
+             */
+            void setReusePreconditioner(const bool value);
+
+            /** Get flag for managing reuse of the preconditioner across time steps.
+             *
+             * @returns True if managing reuse of the preconditioner, false otherwise.
+             */
+            bool getReusePreconditioner(void) const;
+
+            /** Set factor for growth in linear iterations that triggers rebuilding the preconditioner.
+             *
+             * @param[in] value Ratio of linear iterations in a time step to those when preconditioner was last rebuilt.
+             */
+            void setPreconditionerRebuildFactor(const double value);
+
+            /** Get factor for growth in linear iterations that triggers rebuilding the preconditioner.
+             *
+             * @returns Ratio of linear iterations in a time step to those when preconditioner was last rebuilt.
+             */
+            double getPreconditionerRebuildFactor(void) const;
+
             /// Initialize.
             void initialize(void);
 
@@ -114,6 +248,10 @@ public:
              */
             void solve(void);
 
+            /** Write checkpoint with current solution, auxiliary fields, time stepping state, and output trigger state.
+             */
+            void checkpoint(void);
+
             /** Perform Perform operations after advancing solution one time step.
              *
              * Update state variables, output.
@@ -41,12 +41,33 @@ namespace pylith {
        *
        * @param newMesh Distributed mesh (result).
        * @param origMesh Mesh to distribute.
-   * @param partitionerName Name of PETSc partitioner to use in distributing mesh.
+       * @param partitionerName Name of PETSc partitioner to use in distributing mesh.
+       * @param weightIds Material and interface identifiers with weights.
+       * @param numWeightIds Number of identifiers with weights.
+       * @param weights Relative cost per cell for each identifier.
+       * @param numWeights Number of weights.
+       * @param faultAdjacentWeight Multiplier for weight of cells adjacent to cohesive cells.
        */
+      %apply(int* IN_ARRAY1, int DIM1) {
+	  (const int* weightIds,
+	   const int numWeightIds)
+	  };
+      %apply(PylithReal* IN_ARRAY1, int DIM1) {
+	  (const PylithReal* weights,
+	   const int numWeights)
+	  };
       static
       void distribute(pylith::topology::Mesh* const newMesh,
 		      const pylith::topology::Mesh& origMesh,
-		      const char* partitionerName);
+		      const char* partitionerName,
+		      const int* weightIds,
+		      const int numWeightIds,
+		      const PylithReal* weights,
+		      const int numWeights,
+		      const PylithReal faultAdjacentWeight);
+
+      %clear(const int* weightIds, const int numWeightIds);
+      %clear(const PylithReal* weights, const int numWeights);
 
       /** Write partitioning info for distributed mesh.
        *
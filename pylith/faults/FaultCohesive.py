@@ -67,6 +67,10 @@ class FaultCohesive(Physics, ModuleFaultCohesive):
     edge = pythia.pyre.inventory.str("edge", default="")
     edge.meta['tip'] = "Label identifier for buried fault edges."
 
+    partitionWeight = pythia.pyre.inventory.float("partition_weight", default=4.0,
+                                                  validator=pythia.pyre.inventory.greater(0.0))
+    partitionWeight.meta['tip'] = "Relative cost per cohesive cell for partitioning the mesh (1.0 for linear elasticity)."
+
     refDir1 = pythia.pyre.inventory.list(
         "ref_dir_1", default=[0.0, 0.0, 1.0], validator=validateDir)
     refDir1.meta['tip'] = "First choice for reference direction to discriminate among tangential directions in 3-D."
@@ -0,0 +1,101 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/faults/FaultCohesiveImpulses.py
+#
+# @brief Python object for a fault surface with slip impulses for
+# Green's functions implemented with cohesive elements.
+#
+# Factory: fault
+
+from .FaultCohesive import FaultCohesive
+from .faults import FaultCohesiveImpulses as ModuleFaultCohesiveImpulses
+
+
+class FaultCohesiveImpulses(FaultCohesive, ModuleFaultCohesiveImpulses):
+    """Python object for a fault surface with slip impulses for Green's
+    functions implemented with cohesive elements.
+
+    The spatial database for the auxiliary field provides the
+    'impulse_amplitude' at each point. Impulses are applied at points
+    where the amplitude exceeds the threshold for each of the slip
+    components in 'impulse_dof'.
+
+    FACTORY: fault
+    """
+
+    import pythia.pyre.inventory
+    from pythia.pyre.units.length import m
+
+    threshold = pythia.pyre.inventory.dimensional("threshold", default=1.0e-6 * m,
+                                                  validator=pythia.pyre.inventory.greaterEqual(0.0 * m))
+    threshold.meta['tip'] = "Threshold for nonzero impulse amplitude."
+
+    impulseDOF = pythia.pyre.inventory.array("impulse_dof", converter=int, default=[])
+    impulseDOF.meta['tip'] = "Indices of slip components for impulses (0=opening, 1=left-lateral, 2=reverse)."
+
+    def __init__(self, name="faultcohesiveimpulses"):
+        """Initialize configuration.
+        """
+        FaultCohesive.__init__(self, name)
+        return
+
+    def preinitialize(self, problem):
+        """Do pre-initialization setup.
+        """
+        import numpy
+
+        from pylith.mpi.Communicator import mpi_comm_world
+        comm = mpi_comm_world()
+        if 0 == comm.rank:
+            self._info.log("Pre-initializing fault '%s'." % self.label)
+
+        FaultCohesive.preinitialize(self, problem)
+
+        ModuleFaultCohesiveImpulses.setImpulseDOF(self, numpy.array(self.impulseDOF, dtype=numpy.int32))
+        ModuleFaultCohesiveImpulses.setThreshold(self, self.threshold.value)
+        return
+
+    def verifyConfiguration(self):
+        """Verify compatibility of configuration.
+        """
+        FaultCohesive.verifyConfiguration(self)
+        return
+
+    def _configure(self):
+        """Setup members using inventory.
+        """
+        FaultCohesive._configure(self)
+        if 0 == len(self.impulseDOF):
+            raise ValueError("'impulse_dof' must be a zero based integer array of indices corresponding to the "
+                             "slip components for impulses.")
+        return
+
+    def _createModuleObj(self):
+        """Create handle to C++ FaultCohesiveImpulses.
+        """
+        ModuleFaultCohesiveImpulses.__init__(self)
+        return
+
+
+# Factories
+
+def fault():
+    """Factory associated with FaultCohesiveImpulses.
+    """
+    return FaultCohesiveImpulses()
+
+
+# End of file
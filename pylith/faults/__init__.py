@@ -20,6 +20,7 @@
 __all__ = [
     "FaultCohesive",
     "FaultCohesiveKin",
+    "FaultCohesiveImpulses",
     "KinSrc",
     "KinSrcConstRate",
     "KinSrcStep",
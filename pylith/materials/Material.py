@@ -46,6 +46,10 @@ class Material(Physics, ModuleMaterial):
     label = pythia.pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for material."
 
+    partitionWeight = pythia.pyre.inventory.float("partition_weight", default=1.0,
+                                                  validator=pythia.pyre.inventory.greater(0.0))
+    partitionWeight.meta['tip'] = "Relative cost per cell for partitioning the mesh (1.0 for linear elasticity)."
+
     def __init__(self, name="material"):
         """Constructor.
         """
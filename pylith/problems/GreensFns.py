@@ -0,0 +1,104 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2015 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/problems/GreensFns.py
+#
+# @brief Python class for computing Green's functions for slip
+# impulses on a fault.
+#
+# Factory: problem.
+
+from .Problem import Problem
+from .problems import GreensFns as ModuleGreensFns
+
+
+class GreensFns(Problem, ModuleGreensFns):
+    """Python class for computing Green's functions for slip impulses on a fault.
+
+    The fault with the impulses must be a FaultCohesiveImpulses interface. The
+    solution for each impulse is passed to the observers with the index of the
+    impulse as the time stamp.
+
+    FACTORY: problem.
+    """
+
+    import pythia.pyre.inventory
+
+    faultId = pythia.pyre.inventory.int("fault_id", default=100)
+    faultId.meta['tip'] = "Id of fault on which to impose impulses."
+
+    rhsBlockSize = pythia.pyre.inventory.int("rhs_block_size", default=1, validator=pythia.pyre.inventory.greater(0))
+    rhsBlockSize.meta['tip'] = "Number of impulses solved together as a block of right hand sides."
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self, name="greensfns"):
+        """Constructor.
+        """
+        Problem.__init__(self, name)
+        return
+
+    def preinitialize(self, mesh):
+        """Setup integrators for each element family (material/quadrature,
+        bc/quadrature, etc.).
+        """
+        self._setupLogging()
+
+        import weakref
+        self.mesh = weakref.ref(mesh)
+
+        Problem.preinitialize(self, mesh)
+
+        faultImpulses = None
+        for fault in self.interfaces.components():
+            if fault.matId == self.faultId:
+                faultImpulses = fault
+                break
+        if faultImpulses is None:
+            raise ValueError("Could not find fault with id '%d' for Green's function impulses." % self.faultId)
+        ModuleGreensFns.setFaultImpulses(self, faultImpulses)
+        ModuleGreensFns.setRHSBlockSize(self, self.rhsBlockSize)
+        return
+
+    def run(self, app):
+        """Compute Green's functions.
+        """
+        from pylith.mpi.Communicator import mpi_comm_world
+        comm = mpi_comm_world()
+
+        if 0 == comm.rank:
+            self._info.log("Computing Green's functions.")
+
+        ModuleGreensFns.solve(self)
+        return
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _createModuleObj(self):
+        """Create handle to C++ object.
+        """
+        ModuleGreensFns.__init__(self)
+        return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def problem():
+    """Factory associated with GreensFns.
+    """
+    return GreensFns()
+
+
+# End of file
@@ -80,6 +80,13 @@ class Problem(PetscComponent, ModuleProblem):
                                       validator=pythia.pyre.inventory.choice(["linear", "nonlinear"]))
     solverChoice.meta['tip'] = "Type of solver to use ['linear', 'nonlinear']."
 
+    geometryCacheBudget = pythia.pyre.inventory.float("geometry_cache_budget", default=512.0,
+                                                     validator=pythia.pyre.inventory.greaterEqual(0.0))
+    geometryCacheBudget.meta['tip'] = "Per-process memory (MB) for caching cell geometry; geometry is recomputed for materials that do not fit."
+
+    performanceSummary = pythia.pyre.inventory.bool("performance_summary", default=False)
+    performanceSummary.meta['tip'] = "Write summary of time spent in each material, boundary condition, and fault at end of run."
+
     from .Solution import Solution
     solution = pythia.pyre.inventory.facility("solution", family="solution", factory=Solution)
     solution.meta['tip'] = "Solution field for problem."
@@ -143,6 +150,7 @@ class Problem(PetscComponent, ModuleProblem):
             ModuleProblem.setSolverType(self, ModuleProblem.NONLINEAR)
         else:
             raise ValueError("Unknown solver choice '%s'." % self.solverChoice)
+        ModuleProblem.setGeometryCacheBudget(self, self.geometryCacheBudget)
         ModuleProblem.setNormalizer(self, self.normalizer)
         if not isinstance(self.gravityField, NullComponent):
             ModuleProblem.setGravityField(self, self.gravityField)
@@ -211,6 +219,8 @@ class Problem(PetscComponent, ModuleProblem):
         comm = mpi_comm_world()
         if 0 == comm.rank:
             self._info.log("Finalizing problem.")
+        if self.performanceSummary:
+            ModuleProblem.logPerformanceSummary(self)
         return
 
     def checkpoint(self):
@@ -62,11 +62,45 @@ class TimeDependent(Problem, ModuleTimeDependent):
     shouldNotifyIC = pythia.pyre.inventory.bool("notify_observers_ic", default=False)
     shouldNotifyIC.meta["tip"] = "Notify observers of solution with initial conditions."
 
+    jacobianChoice = pythia.pyre.inventory.str("jacobian", default="assembled",
+                                               validator=pythia.pyre.inventory.choice(["assembled", "matrix_free"]))
+    jacobianChoice.meta['tip'] = "Type of Jacobian for implicit time stepping ['assembled', 'matrix_free']."
+
+    assemblePreconditioner = pythia.pyre.inventory.bool("assemble_preconditioner", default=True)
+    assemblePreconditioner.meta['tip'] = "Assemble block diagonal sparse matrix for preconditioner with matrix-free Jacobian."
+
+    predictor = pythia.pyre.inventory.str("predictor", default="none",
+                                          validator=pythia.pyre.inventory.choice(["none", "linear", "quadratic"]))
+    predictor.meta['tip'] = "Extrapolate previous solutions for initial guess of nonlinear solve ['none', 'linear', 'quadratic']."
+
     from .ProgressMonitorTime import ProgressMonitorTime
     progressMonitor = pythia.pyre.inventory.facility(
         "progress_monitor", family="progress_monitor", factory=ProgressMonitorTime)
     progressMonitor.meta['tip'] = "Simple progress monitor via text file."
 
+    checkpointInterval = pythia.pyre.inventory.int("checkpoint_interval", default=0,
+                                                   validator=pythia.pyre.inventory.greaterEqual(0))
+    checkpointInterval.meta['tip'] = "Number of time steps between writing checkpoints (0 means never write checkpoints)."
+
+    checkpointFilename = pythia.pyre.inventory.str("checkpoint_filename", default="")
+    checkpointFilename.meta['tip'] = "Name of checkpoint file (default is OUTPUT_DIR/SIMNAME-checkpoint.h5)."
+
+    restart = pythia.pyre.inventory.bool("restart", default=False)
+    restart.meta['tip'] = "Resume simulation from checkpoint file."
+
+    multirate = pythia.pyre.inventory.bool("multirate", default=False)
+    multirate.meta['tip'] = "Advance cells that are unstable with the initial time step at a faster rate (dynamic formulation only)."
+
+    overlapHaloExchange = pythia.pyre.inventory.bool("overlap_halo_exchange", default=False)
+    overlapHaloExchange.meta['tip'] = "Integrate cells not shared with other processes while communicating residual contributions of shared points."
+
+    reusePreconditioner = pythia.pyre.inventory.bool("reuse_preconditioner", default=False)
+    reusePreconditioner.meta['tip'] = "Rebuild preconditioner only when LHS Jacobian is reformed or linear iterations grow."
+
+    pcRebuildFactor = pythia.pyre.inventory.float("preconditioner_rebuild_factor", default=2.0,
+                                                  validator=pythia.pyre.inventory.greaterEqual(1.0))
+    pcRebuildFactor.meta['tip'] = "Rebuild preconditioner when linear iterations exceed this factor times those when it was last built."
+
     # PUBLIC METHODS /////////////////////////////////////////////////////
 
     def __init__(self, name="timedependent"):
@@ -91,6 +125,34 @@ class TimeDependent(Problem, ModuleTimeDependent):
         ModuleTimeDependent.setInitialTimeStep(self, self.dtInitial.value)
         ModuleTimeDependent.setMaxTimeSteps(self, self.maxTimeSteps)
         ModuleTimeDependent.setShouldNotifyIC(self, self.shouldNotifyIC)
+        if self.jacobianChoice == "assembled":
+            ModuleTimeDependent.setJacobianType(self, ModuleTimeDependent.JACOBIAN_ASSEMBLED)
+        elif self.jacobianChoice == "matrix_free":
+            ModuleTimeDependent.setJacobianType(self, ModuleTimeDependent.JACOBIAN_MATRIX_FREE)
+        else:
+            raise ValueError("Unknown Jacobian choice '%s'." % self.jacobianChoice)
+        ModuleTimeDependent.setAssemblePreconditioner(self, self.assemblePreconditioner)
+        if self.predictor == "none":
+            ModuleTimeDependent.setPredictor(self, ModuleTimeDependent.PREDICTOR_NONE)
+        elif self.predictor == "linear":
+            ModuleTimeDependent.setPredictor(self, ModuleTimeDependent.PREDICTOR_LINEAR)
+        elif self.predictor == "quadratic":
+            ModuleTimeDependent.setPredictor(self, ModuleTimeDependent.PREDICTOR_QUADRATIC)
+        else:
+            raise ValueError("Unknown predictor '%s'." % self.predictor)
+
+        from pylith.meshio.DataWriter import DataWriter
+        checkpointFilename = self.checkpointFilename or DataWriter.mkfilename(
+            self.defaults.outputDir, self.defaults.simName, "checkpoint", "h5")
+        if self.checkpointInterval > 0:
+            self._mkpath(checkpointFilename)
+        ModuleTimeDependent.setCheckpointFilename(self, checkpointFilename)
+        ModuleTimeDependent.setCheckpointInterval(self, self.checkpointInterval)
+        ModuleTimeDependent.setRestart(self, self.restart)
+        ModuleTimeDependent.setMultirate(self, self.multirate)
+        ModuleTimeDependent.setOverlapHaloExchange(self, self.overlapHaloExchange)
+        ModuleTimeDependent.setReusePreconditioner(self, self.reusePreconditioner)
+        ModuleTimeDependent.setPreconditionerRebuildFactor(self, self.pcRebuildFactor)
 
         # Preinitialize initial conditions.
         for ic in self.ic.components():
@@ -115,6 +177,19 @@ class TimeDependent(Problem, ModuleTimeDependent):
 
     # PRIVATE METHODS ////////////////////////////////////////////////////
 
+    def _mkpath(self, filename):
+        """Create directory for checkpoint file.
+        """
+        import os
+        relpath = os.path.dirname(filename)
+        if relpath and not os.path.exists(relpath):
+            # Only create directory on proc 0
+            from pylith.mpi.Communicator import mpi_comm_world
+            comm = mpi_comm_world()
+            if not comm.rank:
+                os.makedirs(relpath)
+        return
+
     def _configure(self):
         """Set members based using inventory.
         """
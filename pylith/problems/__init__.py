@@ -21,6 +21,7 @@
 __all__ = [
     "Problem",
     "TimeDependent",
+    "GreensFns",
     "InitialCondition",
     "InitialConditionDomain",
     "InitialConditionPatch",
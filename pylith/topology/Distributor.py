@@ -35,8 +35,15 @@ class Distributor(PetscComponent, ModuleDistributor):
                                      validator=pythia.pyre.inventory.choice(["chaco", "metis", "parmetis", "simple"]))
     partitioner.meta['tip'] = "Name of mesh partitioner."
 
+    useCellWeights = pythia.pyre.inventory.bool("use_cell_weights", default=False)
+    useCellWeights.meta['tip'] = "Weight cells by the partition weights of materials and faults in partitioning."
+
+    faultAdjacentWeight = pythia.pyre.inventory.float("fault_adjacent_weight", default=1.0,
+                                                      validator=pythia.pyre.inventory.greater(0.0))
+    faultAdjacentWeight.meta['tip'] = "Multiplier for weight of cells adjacent to cohesive cells (if using cell weights)."
+
     writePartition = pythia.pyre.inventory.bool("write_partition", default=False)
-    writePartition.meta['tip'] = "Write partition information to file."
+    writePartition.meta['tip'] = "Write partition information (rank and partition statistics of each cell) to file."
 
     from pylith.meshio.DataWriterVTK import DataWriterVTK
     dataWriter = pythia.pyre.inventory.facility("data_writer", factory=DataWriterVTK, family="data_writer")
@@ -50,13 +57,18 @@ class Distributor(PetscComponent, ModuleDistributor):
         PetscComponent.__init__(self, name, facility="mesh_distributor")
         return
 
-    def preinitialize(self):
+    def preinitialize(self, problem):
         """Do minimal initialization."""
         ModuleDistributor.__init__(self)
+        if self.writePartition:
+            self.dataWriter.preinitialize()
+            self.dataWriter.setFilename(problem.defaults.outputDir, problem.defaults.simName, "partition")
         return
 
-    def distribute(self, mesh, normalizer):
+    def distribute(self, mesh, normalizer, materials=None, interfaces=None):
         """Distribute a Mesh
+
+        If using cell weights, the weight of each cell is the partition weight of its material or fault.
         """
         self._setupLogging()
         logEvent = "%sdistribute" % self._loggingPrefix
@@ -68,12 +80,26 @@ class Distributor(PetscComponent, ModuleDistributor):
             partitionerName = "parmetis"
         else:
             partitionerName = self.partitioner
-        ModuleDistributor.distribute(newMesh, mesh, partitionerName)
+        import numpy
+        weightIds = []
+        weights = []
+        faultAdjacentWeight = 1.0
+        if self.useCellWeights:
+            for material in materials or []:
+                weightIds.append(material.materialId)
+                weights.append(material.partitionWeight)
+            for interface in interfaces or []:
+                weightIds.append(interface.matId)
+                weights.append(interface.partitionWeight)
+            faultAdjacentWeight = self.faultAdjacentWeight
+        ModuleDistributor.distribute(newMesh, mesh, partitionerName,
+                                     numpy.array(weightIds, dtype=numpy.int32),
+                                     numpy.array(weights, dtype=numpy.float64),
+                                     faultAdjacentWeight)
 
         mesh.cleanup()
 
         if self.writePartition:
-            self.dataWriter.initialize(normalizer)
             ModuleDistributor.write(self.dataWriter, newMesh)
 
         self._eventLogger.eventEnd(logEvent)
@@ -31,7 +31,26 @@ class MeshImporter(MeshGenerator):
     import pythia.pyre.inventory
 
     reorderMesh = pythia.pyre.inventory.bool("reorder_mesh", default=True)
-    reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
+    reorderMesh.meta['tip'] = "Reorder cells and vertices of mesh to improve memory locality."
+
+    reorderMethod = pythia.pyre.inventory.str("reorder_method", default="rcm",
+                                              validator=pythia.pyre.inventory.choice(["rcm", "hilbert", "morton"]))
+    reorderMethod.meta['tip'] = "Algorithm for reordering mesh ('rcm'=reverse Cuthill-McKee, 'hilbert'=Hilbert curve, " \
+        "'morton'=Morton curve)."
+
+    reorderLocal = pythia.pyre.inventory.bool("reorder_local", default=False)
+    reorderLocal.meta['tip'] = "Reorder mesh on each process after distribution and refinement instead of before " \
+        "distribution (requires a space-filling curve reorder method)."
+
+    parallelRead = pythia.pyre.inventory.bool("parallel_read", default=False)
+    parallelRead.meta['tip'] = "Each process reads a slab of the mesh instead of reading the entire mesh on process 0."
+
+    useMeshCache = pythia.pyre.inventory.bool("use_mesh_cache", default=False)
+    useMeshCache.meta['tip'] = "Load prepared (reordered, with faults, distributed, refined) mesh from cache if available, " \
+        "otherwise write it to the cache."
+
+    meshCacheDir = pythia.pyre.inventory.str("mesh_cache_dir", default="mesh_cache")
+    meshCacheDir.meta['tip'] = "Directory for mesh cache files."
 
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pythia.pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
@@ -60,20 +79,66 @@ class MeshImporter(MeshGenerator):
         MeshGenerator.preinitialize(self, problem)
 
         self.reader.preinitialize()
-        self.distributor.preinitialize()
+        self.reader.setParallelRead(self.parallelRead)
+        self.distributor.preinitialize(problem)
         self.refiner.preinitialize()
         return
 
     def create(self, problem, faults=None):
         """Hook for creating mesh.
         """
-        from pylith.utils.profiling import resourceUsageString
         from pylith.mpi.Communicator import petsc_comm_world
+        import time
         comm = petsc_comm_world()
 
+        if self.parallelRead and faults and comm.size > 1:
+            raise ValueError("Reading the mesh in parallel is not supported with faults, because cohesive cells are "
+                             "inserted before the mesh is distributed. Set parallel_read to False.")
+
         self._setupLogging()
         logEvent = "%screate" % self._loggingPrefix
         self._eventLogger.eventBegin(logEvent)
+        startTime = time.time()
+
+        newMesh = None
+        if self.useMeshCache:
+            cacheFilename = self._getCacheFilename(problem, faults)
+            newMesh = self._readCache(cacheFilename, problem, faults)
+        if newMesh is None:
+            newMesh = self._prepareMesh(problem, faults)
+            if self.useMeshCache:
+                self._writeCache(newMesh, cacheFilename)
+
+        # Nondimensionalize mesh (coordinates of vertices).
+        from pylith.topology.topology import MeshOps_nondimensionalize
+        MeshOps_nondimensionalize(newMesh, problem.normalizer)
+
+        if 0 == comm.rank:
+            from pylith.utils.profiling import peakMemoryUsage
+            self._info.log("Mesh setup time: %.2f s, peak memory on process 0: %.2f MB." %
+                           (time.time() - startTime, peakMemoryUsage()))
+
+        self._eventLogger.eventEnd(logEvent)
+        return newMesh
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _configure(self):
+        """Set members based on inventory.
+        """
+        MeshGenerator._configure(self)
+        if self.reorderLocal and self.reorderMethod == "rcm":
+            raise ValueError("Reordering the mesh on each process requires a space-filling curve reorder method "
+                             "('hilbert' or 'morton'), because reverse Cuthill-McKee cannot reorder a mesh with "
+                             "cohesive cells.")
+        return
+
+    def _prepareMesh(self, problem, faults):
+        """Read, reorder, adjust topology, distribute, and refine mesh.
+        """
+        from pylith.utils.profiling import resourceUsageString
+        from pylith.mpi.Communicator import petsc_comm_world
+        comm = petsc_comm_world()
 
         # Read mesh
         mesh = self.reader.read(self.debug)
@@ -81,16 +146,8 @@ class MeshImporter(MeshGenerator):
             mesh.view()
 
         # Reorder mesh
-        if self.reorderMesh:
-            logEvent2 = "%sreorder" % self._loggingPrefix
-            self._eventLogger.eventBegin(logEvent2)
-            self._debug.log(resourceUsageString())
-            if 0 == comm.rank:
-                self._info.log("Reordering cells and vertices.")
-            from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
-            ordering = ReverseCuthillMcKee()
-            ordering.reorder(mesh)
-            self._eventLogger.eventEnd(logEvent2)
+        if self.reorderMesh and not self.reorderLocal:
+            self._reorder(mesh)
 
         # Adjust topology
         self._debug.log(resourceUsageString())
@@ -98,12 +155,12 @@ class MeshImporter(MeshGenerator):
             self._info.log("Adjusting topology.")
         self._adjustTopology(mesh, faults, problem)
 
-        # Distribute mesh
+        # Distribute mesh (redistribute slabs if mesh was read in parallel)
         if comm.size > 1:
             if 0 == comm.rank:
                 self._info.log("Distributing mesh.")
             self.distributor.initialize()
-            mesh = self.distributor.distribute(mesh, problem.normalizer)
+            mesh = self.distributor.distribute(mesh, problem.normalizer, problem.materials.components(), faults)
             if self.debug:
                 mesh.view()
             mesh.memLoggingStage = "DistributedMesh"
@@ -114,22 +171,137 @@ class MeshImporter(MeshGenerator):
             mesh.cleanup()
             newMesh.memLoggingStage = "RefinedMesh"
 
-        # Can't reorder mesh again, because we do not have routine to
-        # unmix normal and hybrid cells.
+        # Reorder local mesh on each process (cohesive cells already inserted)
+        if self.reorderMesh and self.reorderLocal:
+            self._reorder(newMesh)
+        return newMesh
 
-        # Nondimensionalize mesh (coordinates of vertices).
-        from pylith.topology.topology import MeshOps_nondimensionalize
-        MeshOps_nondimensionalize(newMesh, problem.normalizer)
+    def _reorder(self, mesh):
+        """Reorder cells and vertices of mesh.
+        """
+        from pylith.utils.profiling import resourceUsageString
+        from pylith.mpi.Communicator import petsc_comm_world
+        comm = petsc_comm_world()
 
+        logEvent = "%sreorder" % self._loggingPrefix
+        self._eventLogger.eventBegin(logEvent)
+        self._debug.log(resourceUsageString())
+        if 0 == comm.rank:
+            self._info.log("Reordering cells and vertices using '%s'." % self.reorderMethod)
+        if self.reorderMethod == "rcm":
+            from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+            ordering = ReverseCuthillMcKee()
+            ordering.reorder(mesh)
+        else:
+            from pylith.topology.SpaceFillingCurve import SpaceFillingCurve
+            ordering = SpaceFillingCurve()
+            ordering.reorder(mesh, self.reorderMethod)
         self._eventLogger.eventEnd(logEvent)
-        return newMesh
+        return
 
-    # PRIVATE METHODS ////////////////////////////////////////////////////
+    def _getCacheFilename(self, problem, faults):
+        """Get name of mesh cache file from hash of mesh files and settings that change the prepared mesh.
 
-    def _configure(self):
-        """Set members based on inventory.
+        The number of processes is not part of the hash; a mesh cached with a different number of processes is
+        redistributed when it is loaded. Only process 0 reads the mesh files, and it broadcasts their hash to the
+        other processes.
         """
-        MeshGenerator._configure(self)
+        import hashlib
+        import os
+        import pylith.mpi.mpi as mpi
+        from pylith.mpi.Communicator import petsc_comm_world
+        comm = petsc_comm_world()
+
+        filesDigest = ""
+        if 0 == comm.rank:
+            filesKey = hashlib.sha256()
+            try:
+                for name in ["filename", "filenameGmv", "filenamePset"]:
+                    filename = getattr(self.reader, name, None)
+                    if filename:
+                        with open(filename, "rb") as fin:
+                            for chunk in iter(lambda: fin.read(2**20), b""):
+                                filesKey.update(chunk)
+                filesDigest = filesKey.hexdigest()
+            except IOError as err:
+                self._info.log("Could not read mesh files to compute mesh cache key: %s" % err)
+        filesDigest = mpi.bcast_string(filesDigest, 0, comm.handle)
+        if not filesDigest:
+            raise IOError("Could not read mesh files to compute mesh cache key.")
+
+        key = hashlib.sha256()
+
+        def addValue(value):
+            key.update(repr(value).encode("utf-8"))
+
+        addValue(self.reader.__class__.__name__)
+        addValue(filesDigest)
+        for name in ["useNames", "flipEndian", "ioInt32", "isRecordHeader32Bit"]:
+            addValue(getattr(self.reader, name, None))
+        addValue((self.reorderMesh, self.reorderMethod, self.reorderLocal, self.parallelRead))
+        for fault in faults or []:
+            addValue((fault.__class__.__name__, fault.label, fault.edge, fault.matId))
+        distributor = self.distributor
+        addValue((distributor.partitioner, distributor.useCellWeights, distributor.faultAdjacentWeight))
+        if distributor.useCellWeights:
+            addValue([(material.materialId, material.partitionWeight) for material in problem.materials.components()])
+            addValue([fault.partitionWeight for fault in faults or []])
+        addValue((self.refiner.__class__.__name__, getattr(self.refiner, "levels", 0)))
+        return os.path.join(self.meshCacheDir, "mesh-%s.h5" % key.hexdigest()[:16])
+
+    def _readCache(self, filename, problem, faults):
+        """Read prepared mesh from cache file.
+
+        @returns Mesh or None if cache file does not exist.
+        """
+        import os
+        import pylith.mpi.mpi as mpi
+        from pylith.mpi.Communicator import petsc_comm_world
+        comm = petsc_comm_world()
+
+        # All processes must agree on whether the cache file exists.
+        exists = mpi.allreduce_scalar_int(int(os.path.isfile(filename)), mpi.mpi_min(), comm.handle)
+        if not exists:
+            if 0 == comm.rank:
+                self._info.log("Mesh cache file '%s' not found; mesh will be prepared and cached." % filename)
+            return None
+        if 0 == comm.rank:
+            self._info.log("Reading prepared mesh from cache file '%s'." % filename)
+
+        # Faults still need minimal initialization, but the mesh already contains the cohesive cells.
+        for interface in faults or []:
+            interface.preinitialize(problem)
+
+        from pylith.topology.Mesh import Mesh
+        from pylith.meshio.meshio import MeshCache_read
+        coordsys = self.reader.coordsys
+        mesh = Mesh(dim=coordsys.getSpaceDim(), comm=comm)
+        mesh.setCoordSys(coordsys)
+        isDistributed = MeshCache_read(mesh, filename)
+        if not isDistributed:
+            if 0 == comm.rank:
+                self._info.log("Mesh cache was written with a different number of processes; redistributing mesh.")
+            self.distributor.initialize()
+            mesh = self.distributor.distribute(mesh, problem.normalizer, problem.materials.components(), faults)
+        mesh.memLoggingStage = "CachedMesh"
+        return mesh
+
+    def _writeCache(self, mesh, filename):
+        """Write prepared mesh to cache file.
+        """
+        import os
+        from pylith.mpi.Communicator import petsc_comm_world
+        comm = petsc_comm_world()
+
+        if 0 == comm.rank:
+            self._info.log("Writing prepared mesh to cache file '%s'." % filename)
+            dirname = os.path.dirname(filename)
+            if dirname and not os.path.isdir(dirname):
+                os.makedirs(dirname)
+        comm.barrier()
+
+        from pylith.meshio.meshio import MeshCache_write
+        MeshCache_write(mesh, filename)
         return
 
     def _setupLogging(self):
@@ -0,0 +1,52 @@
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+# @file pylith/topology/SpaceFillingCurve.py
+#
+# @brief Python interface to reordering of mesh cells and vertices
+# along a space-filling curve.
+
+from .topology import SpaceFillingCurve as ModuleSpaceFillingCurve
+
+
+class SpaceFillingCurve(ModuleSpaceFillingCurve):
+    """Python interface to reordering of mesh cells and vertices along a
+    space-filling curve (Hilbert or Morton) through the cell centroids.
+    """
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self):
+        """Constructor.
+        """
+        return
+
+    def reorder(self, mesh, curve="hilbert"):
+        """Reorder cells and vertices of mesh.
+
+        @param mesh Finite-element mesh.
+        @param curve Type of space-filling curve ('hilbert' or 'morton').
+        """
+        mapCurve = {
+            "hilbert": ModuleSpaceFillingCurve.HILBERT,
+            "morton": ModuleSpaceFillingCurve.MORTON,
+        }
+        if not curve in mapCurve:
+            raise ValueError("Unknown space-filling curve '%s'. Options are %s." % (curve, list(mapCurve.keys())))
+        ModuleSpaceFillingCurve.reorder(mesh, mapCurve[curve])
+        return
+
+
+# End of file
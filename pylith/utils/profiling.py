@@ -34,6 +34,23 @@ def resourceUsage():
     return (cputime, memory)
 
 
+# ----------------------------------------------------------------------
+def peakMemoryUsage():
+    """Get peak resident memory (MB) of this process.
+    """
+
+    try:
+        import resource
+        import sys
+        maxrss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+        # Linux reports kilobytes; macOS reports bytes.
+        scale = 1.0/1024.0**2 if sys.platform == "darwin" else 1.0/1024.0
+        memory = maxrss*scale
+    except:
+        memory = 0
+    return memory
+
+
 # ----------------------------------------------------------------------
 def resourceUsageString():
     """Get CPU time and memory usage as a string.
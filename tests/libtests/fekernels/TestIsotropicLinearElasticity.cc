@@ -0,0 +1,162 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestIsotropicLinearElasticity.hh" // Implementation of class methods
+
+#include "pylith/fekernels/IsotropicLinearElasticity.hh" // Test subject
+
+#include <cmath> // USES sin()
+#include <sstream> // USES std::ostringstream
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace fekernels {
+        namespace _TestIsotropicLinearElasticity {
+            /// Pointwise kernel with the signature of f1v(), meanStress(), and deviatoricStress().
+            typedef void (*kernel_type)(const PylithInt,
+                                        const PylithInt,
+                                        const PylithInt,
+                                        const PylithInt[],
+                                        const PylithInt[],
+                                        const PylithScalar[],
+                                        const PylithScalar[],
+                                        const PylithScalar[],
+                                        const PylithInt[],
+                                        const PylithInt[],
+                                        const PylithScalar[],
+                                        const PylithScalar[],
+                                        const PylithScalar[],
+                                        const PylithReal,
+                                        const PylithScalar[],
+                                        const PylithInt,
+                                        const PylithScalar[],
+                                        PylithScalar[]);
+
+            /** Compute f1v() the way it was computed before the stress was inlined: accumulate the stress from
+             * meanStress() and deviatoricStress() into a zeroed tensor and subtract it from f1.
+             *
+             * Solution fields: [disp(dim), ...]
+             * Auxiliary fields: [..., shear_modulus(1), bulk_modulus(1)]
+             */
+            void f1vReference(const PylithInt dim,
+                              const PylithInt numS,
+                              const PylithInt numA,
+                              const PylithInt sOff[],
+                              const PylithInt sOff_x[],
+                              const PylithScalar s[],
+                              const PylithScalar s_x[],
+                              const PylithInt aOff[],
+                              const PylithScalar a[],
+                              const PylithScalar x[],
+                              kernel_type meanStress,
+                              kernel_type deviatoricStress,
+                              PylithScalar f1[]) {
+                const PylithInt i_disp = 0;
+                const PylithInt i_shearModulus = numA-2;
+                const PylithInt i_bulkModulus = numA-1;
+
+                const PylithInt _numS = 1;
+                const PylithInt sOffDisp[1] = { sOff[i_disp] };
+                const PylithInt sOffDisp_x[1] = { sOff_x[i_disp] };
+                const PylithInt aOffMean[1] = { aOff[i_bulkModulus] };
+                const PylithInt aOffDev[1] = { aOff[i_shearModulus] };
+
+                PylithScalar stressTensor[9] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+                meanStress(dim, _numS, 1, sOffDisp, sOffDisp_x, s, NULL, s_x, aOffMean, NULL, a, NULL, NULL,
+                           0.0, x, 0, NULL, stressTensor);
+                deviatoricStress(dim, _numS, 1, sOffDisp, sOffDisp_x, s, NULL, s_x, aOffDev, NULL, a, NULL, NULL,
+                                 0.0, x, 0, NULL, stressTensor);
+                for (PylithInt i = 0; i < dim*dim; ++i) {
+                    f1[i] -= stressTensor[i];
+                } // for
+            } // f1vReference
+
+            /** Check f1v() against f1vReference() at several points with a nonzero initial f1, a velocity subfield after
+             * the displacement, and a density subfield before the elastic moduli.
+             */
+            void checkF1v(const PylithInt dim,
+                          kernel_type f1v,
+                          kernel_type meanStress,
+                          kernel_type deviatoricStress) {
+                const PylithInt numS = 2;
+                const PylithInt sOff[2] = { 0, dim };
+                const PylithInt sOff_x[2] = { 0, dim*dim };
+                const PylithInt numA = 3;
+                const PylithInt aOff[3] = { 0, 1, 2 };
+                const PylithScalar x[3] = { 0.0, 0.0, 0.0 };
+
+                const int numPoints = 5;
+                const PylithReal tolerance = 1.0e-12;
+                for (int iPoint = 0; iPoint < numPoints; ++iPoint) {
+                    PylithScalar s[6];
+                    PylithScalar s_x[18];
+                    for (PylithInt i = 0; i < numS*dim; ++i) {
+                        s[i] = 0.1 * i;
+                    } // for
+                    for (PylithInt i = 0; i < numS*dim*dim; ++i) {
+                        s_x[i] = 1.0e-3 * sin(1.3*i + 0.7*iPoint + 0.1);
+                    } // for
+                    const PylithScalar a[3] = { 2.5, 1.5 + 0.25*iPoint, 4.0 + 0.5*iPoint };
+
+                    PylithScalar f1[9];
+                    PylithScalar f1E[9];
+                    for (PylithInt i = 0; i < dim*dim; ++i) {
+                        f1[i] = f1E[i] = 1.0e-2 * (i + 1);
+                    } // for
+
+                    f1v(dim, numS, numA, sOff, sOff_x, s, NULL, s_x, aOff, NULL, a, NULL, NULL, 0.0, x, 0, NULL, f1);
+                    f1vReference(dim, numS, numA, sOff, sOff_x, s, s_x, aOff, a, x, meanStress, deviatoricStress, f1E);
+
+                    for (PylithInt i = 0; i < dim*dim; ++i) {
+                        std::ostringstream msg;
+                        msg << "Mismatch in f1[" << i << "] at point " << iPoint << ".";
+                        CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), f1E[i], f1[i], tolerance);
+                    } // for
+                } // for
+            } // checkF1v
+
+        } // _TestIsotropicLinearElasticity
+    } // fekernels
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::fekernels::TestIsotropicLinearElasticity);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test plane strain f1v() matches stress from meanStress() and deviatoricStress().
+void
+pylith::fekernels::TestIsotropicLinearElasticity::testF1vPlaneStrain(void) {
+    _TestIsotropicLinearElasticity::checkF1v(2, IsotropicLinearElasticityPlaneStrain::f1v,
+                                             IsotropicLinearElasticityPlaneStrain::meanStress,
+                                             IsotropicLinearElasticityPlaneStrain::deviatoricStress);
+} // testF1vPlaneStrain
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test 3D f1v() matches stress from meanStress() and deviatoricStress().
+void
+pylith::fekernels::TestIsotropicLinearElasticity::testF1v3D(void) {
+    _TestIsotropicLinearElasticity::checkF1v(3, IsotropicLinearElasticity3D::f1v,
+                                             IsotropicLinearElasticity3D::meanStress,
+                                             IsotropicLinearElasticity3D::deviatoricStress);
+} // testF1v3D
+
+
+// End of file
@@ -0,0 +1,61 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/fekernels/TestIsotropicLinearElasticity.hh
+ *
+ * @brief C++ TestIsotropicLinearElasticity object.
+ *
+ * C++ unit testing for IsotropicLinearElasticityPlaneStrain and IsotropicLinearElasticity3D kernels.
+ */
+
+#if !defined(pylith_fekernels_testisotropiclinearelasticity_hh)
+#define pylith_fekernels_testisotropiclinearelasticity_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace fekernels {
+        class TestIsotropicLinearElasticity;
+    } // fekernels
+} // pylith
+
+class pylith::fekernels::TestIsotropicLinearElasticity : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestIsotropicLinearElasticity);
+
+    CPPUNIT_TEST(testF1vPlaneStrain);
+    CPPUNIT_TEST(testF1v3D);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Test plane strain f1v() matches stress from meanStress() and deviatoricStress().
+    void testF1vPlaneStrain(void);
+
+    /// Test 3D f1v() matches stress from meanStress() and deviatoricStress().
+    void testF1v3D(void);
+
+}; // class TestIsotropicLinearElasticity
+
+#endif // pylith_fekernels_testisotropiclinearelasticity_hh
+
+// End of file
@@ -0,0 +1,366 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshCache.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshCache.hh" // USES MeshCache
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/testing/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include <petscviewerhdf5.h> // USES PetscViewerHDF5
+
+#include <vector> // USES std::vector
+#include <string> // USES std::string
+#include <algorithm> // USES std::min(), std::max()
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestMeshCache::setUp(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _data = new TestMeshCache_Data();CPPUNIT_ASSERT(_data);
+    _mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::meshio::TestMeshCache::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _data;_data = NULL;
+    delete _mesh;_mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test write() stores owner of cells and cell types of cohesive cells without changing mesh.
+void
+pylith::meshio::TestMeshCache::testWriteLabels(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    MeshCache::write(*_mesh, _data->cacheFilename);
+
+    // Temporary labels must be removed from mesh after writing.
+    PetscDM dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+    PetscErrorCode err = 0;
+    PetscBool hasLabel = PETSC_FALSE;
+    err = DMHasLabel(dmMesh, MeshCache::_partitionLabelName, &hasLabel);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(!hasLabel);
+    err = DMHasLabel(dmMesh, MeshCache::_cellTypeLabelName, &hasLabel);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(!hasLabel);
+
+    // Load cache file directly to check labels that are removed by read().
+    PetscDM dmCache = NULL;
+    err = DMCreate(_mesh->comm(), &dmCache);CPPUNIT_ASSERT(!err);
+    err = DMSetType(dmCache, DMPLEX);CPPUNIT_ASSERT(!err);
+    err = PetscObjectSetName((PetscObject) dmCache, "domain");CPPUNIT_ASSERT(!err);
+    PetscViewer viewer = NULL;
+    const PetscInt numProcessesDefault = 0;
+    PetscInt numProcesses = 0;
+    err = PetscViewerHDF5Open(_mesh->comm(), _data->cacheFilename, FILE_MODE_READ, &viewer);CPPUNIT_ASSERT(!err);
+    err = PetscViewerPushFormat(viewer, PETSC_VIEWER_HDF5_PETSC);CPPUNIT_ASSERT(!err);
+    err = DMLoad(dmCache, viewer);CPPUNIT_ASSERT(!err);
+    err = PetscViewerPopFormat(viewer);CPPUNIT_ASSERT(!err);
+    err = PetscViewerHDF5ReadAttribute(viewer, "/", MeshCache::_numProcessesAttribute, PETSC_INT, &numProcessesDefault,
+                                       &numProcesses);CPPUNIT_ASSERT(!err);
+    err = PetscViewerDestroy(&viewer);CPPUNIT_ASSERT(!err);
+
+    int commSize = 0;
+    err = MPI_Comm_size(_mesh->comm(), &commSize);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(commSize), numProcesses);
+
+    // Mesh is not distributed, so process 0 owns all of the cells.
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    PetscInt numCellsLocal = cellsStratum.size();
+    PetscInt numCells = 0;
+    err = MPI_Allreduce(&numCellsLocal, &numCells, 1, MPIU_INT, MPI_SUM, _mesh->comm());CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(numCells, _globalStratumSize(dmCache, MeshCache::_partitionLabelName, 0));
+    for (PetscInt rank = 1; rank < commSize; ++rank) {
+        CPPUNIT_ASSERT_EQUAL(PetscInt(0), _globalStratumSize(dmCache, MeshCache::_partitionLabelName, rank));
+    } // for
+
+    // Cell type label holds the cohesive cells.
+    CPPUNIT_ASSERT_EQUAL(PetscInt(_data->numCohesiveCells),
+                         _globalStratumSize(dmCache, MeshCache::_cellTypeLabelName, _data->cohesiveCellType));
+
+    err = DMDestroy(&dmCache);CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_END;
+} // testWriteLabels
+
+
+// ----------------------------------------------------------------------
+// Test write() and read() with same number of processes.
+void
+pylith::meshio::TestMeshCache::testReadSameProcesses(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    MeshCache::write(*_mesh, _data->cacheFilename);
+
+    topology::Mesh mesh(_mesh->dimension(), _mesh->comm());
+    const bool isDistributed = MeshCache::read(&mesh, _data->cacheFilename);
+    CPPUNIT_ASSERT(isDistributed);
+
+    _checkMesh(*_mesh, mesh);
+
+    PYLITH_METHOD_END;
+} // testReadSameProcesses
+
+
+// ----------------------------------------------------------------------
+// Test write() and read() with different number of processes.
+void
+pylith::meshio::TestMeshCache::testReadDifferentProcesses(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+    CPPUNIT_ASSERT(_data);
+
+    MeshCache::write(*_mesh, _data->cacheFilename);
+
+    // Mark cache as written with a different number of processes.
+    PetscErrorCode err = 0;
+    int commSize = 0;
+    err = MPI_Comm_size(_mesh->comm(), &commSize);CPPUNIT_ASSERT(!err);
+    const PetscInt numProcesses = commSize + 1;
+    PetscViewer viewer = NULL;
+    err = PetscViewerHDF5Open(_mesh->comm(), _data->cacheFilename, FILE_MODE_APPEND, &viewer);CPPUNIT_ASSERT(!err);
+    err = PetscViewerHDF5WriteAttribute(viewer, "/", MeshCache::_numProcessesAttribute, PETSC_INT,
+                                        &numProcesses);CPPUNIT_ASSERT(!err);
+    err = PetscViewerDestroy(&viewer);CPPUNIT_ASSERT(!err);
+
+    // Mesh on a single process never needs to be redistributed.
+    topology::Mesh mesh(_mesh->dimension(), _mesh->comm());
+    const bool isDistributed = MeshCache::read(&mesh, _data->cacheFilename);
+    CPPUNIT_ASSERT_EQUAL(1 == commSize, isDistributed);
+
+    _checkMesh(*_mesh, mesh);
+
+    PYLITH_METHOD_END;
+} // testReadDifferentProcesses
+
+
+// ----------------------------------------------------------------------
+// Setup mesh.
+void
+pylith::meshio::TestMeshCache::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
+
+    delete _mesh;_mesh = new topology::Mesh;CPPUNIT_ASSERT(_mesh);
+    MeshIOAscii iohandler;
+    iohandler.filename(_data->meshFilename);
+    iohandler.read(_mesh);
+
+    if (_data->faultLabel) {
+        pylith::faults::FaultCohesiveStub fault;
+        fault.setInterfaceId(_data->faultId);
+        fault.setSurfaceMarkerLabel(_data->faultLabel);
+        fault.adjustTopology(_mesh);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ----------------------------------------------------------------------
+// Check mesh read from cache against original mesh.
+void
+pylith::meshio::TestMeshCache::_checkMesh(const topology::Mesh& meshE,
+                                          const topology::Mesh& mesh) {
+    PYLITH_METHOD_BEGIN;
+
+    const PetscDM dmE = meshE.dmMesh();CPPUNIT_ASSERT(dmE);
+    const PetscDM dm = mesh.dmMesh();CPPUNIT_ASSERT(dm);
+    PetscErrorCode err = 0;
+
+    // Topology: number of points in each depth stratum and of each cell type.
+    PetscInt depthE = 0, depth = 0;
+    err = DMPlexGetDepth(dmE, &depthE);CPPUNIT_ASSERT(!err);
+    err = DMPlexGetDepth(dm, &depth);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(depthE, depth);
+    for (PetscInt iDepth = 0; iDepth <= depth; ++iDepth) {
+        CPPUNIT_ASSERT_EQUAL(_globalStratumSize(dmE, "depth", iDepth), _globalStratumSize(dm, "depth", iDepth));
+    } // for
+    for (PetscInt cellType = 0; cellType < DM_NUM_POLYTOPES; ++cellType) {
+        CPPUNIT_ASSERT_EQUAL(_globalStratumSize(dmE, "celltype", cellType), _globalStratumSize(dm, "celltype", cellType));
+    } // for
+
+    // Labels: same labels with the same number of points for each value, and no temporary cache labels.
+    PetscInt numLabels = 0;
+    err = DMGetNumLabels(dmE, &numLabels);CPPUNIT_ASSERT(!err);
+    for (PetscInt iLabel = 0; iLabel < numLabels; ++iLabel) {
+        const char* name = NULL;
+        err = DMGetLabelName(dmE, iLabel, &name);CPPUNIT_ASSERT(!err);
+        const std::string labelName(name);
+        PetscBool hasLabel = PETSC_FALSE;
+        err = DMHasLabel(dm, labelName.c_str(), &hasLabel);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_MESSAGE(std::string("Missing label '") + labelName + "'.", hasLabel);
+
+        PetscDMLabel label = NULL;
+        PetscInt valueRange[2] = { PETSC_MAX_INT, PETSC_MIN_INT };
+        err = DMGetLabel(dmE, labelName.c_str(), &label);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(label);
+        PetscIS valuesIS = NULL;
+        PetscInt numValues = 0;
+        const PetscInt* values = NULL;
+        err = DMLabelGetValueIS(label, &valuesIS);CPPUNIT_ASSERT(!err);
+        err = ISGetLocalSize(valuesIS, &numValues);CPPUNIT_ASSERT(!err);
+        err = ISGetIndices(valuesIS, &values);CPPUNIT_ASSERT(!err);
+        for (PetscInt iValue = 0; iValue < numValues; ++iValue) {
+            valueRange[0] = std::min(valueRange[0], values[iValue]);
+            valueRange[1] = std::max(valueRange[1], values[iValue]);
+        } // for
+        err = ISRestoreIndices(valuesIS, &values);CPPUNIT_ASSERT(!err);
+        err = ISDestroy(&valuesIS);CPPUNIT_ASSERT(!err);
+
+        PetscInt valueMin = 0, valueMax = 0;
+        err = MPI_Allreduce(&valueRange[0], &valueMin, 1, MPIU_INT, MPI_MIN, meshE.comm());CPPUNIT_ASSERT(!err);
+        err = MPI_Allreduce(&valueRange[1], &valueMax, 1, MPIU_INT, MPI_MAX, meshE.comm());CPPUNIT_ASSERT(!err);
+        for (PetscInt value = valueMin; value <= valueMax; ++value) {
+            CPPUNIT_ASSERT_EQUAL_MESSAGE(std::string("Mismatch in label '") + labelName + "'.",
+                                         _globalStratumSize(dmE, labelName.c_str(), value),
+                                         _globalStratumSize(dm, labelName.c_str(), value));
+        } // for
+    } // for
+    PetscBool hasLabel = PETSC_FALSE;
+    err = DMHasLabel(dm, MeshCache::_partitionLabelName, &hasLabel);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(!hasLabel);
+    err = DMHasLabel(dm, MeshCache::_cellTypeLabelName, &hasLabel);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(!hasLabel);
+
+    // Coordinates: checksum of coordinates in closure of each cell.
+    PylithScalar coordsCheck[2] = { 0.0, 0.0 };
+    const PetscDM dms[2] = { dmE, dm };
+    for (int iMesh = 0; iMesh < 2; ++iMesh) {
+        topology::CoordsVisitor coordsVisitor(dms[iMesh]);
+        topology::Stratum cellsStratum(dms[iMesh], topology::Stratum::HEIGHT, 0);
+        PylithScalar coordsCheckLocal = 0.0;
+        for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+            PetscScalar* coordsCell = NULL;
+            PetscInt coordsSize = 0;
+            PylithScalar value = 0.0;
+            coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+            for (int i = 0; i < coordsSize; ++i) {
+                value += coordsCell[i];
+            } // for
+            coordsCheckLocal += value*value;
+            coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+        } // for
+        err = MPI_Allreduce(&coordsCheckLocal, &coordsCheck[iMesh], 1, MPIU_SCALAR, MPI_SUM, meshE.comm());CPPUNIT_ASSERT(!err);
+    } // for
+    const PylithScalar tolerance = 1.0e-6;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(coordsCheck[0], coordsCheck[1], tolerance*coordsCheck[0]);
+
+    PYLITH_METHOD_END;
+} // _checkMesh
+
+
+// ----------------------------------------------------------------------
+// Compute global number of points in label stratum.
+PetscInt
+pylith::meshio::TestMeshCache::_globalStratumSize(const PetscDM dmMesh,
+                                                  const char* name,
+                                                  const PetscInt value) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(dmMesh);
+    CPPUNIT_ASSERT(name);
+
+    PetscErrorCode err = 0;
+
+    // Points that are leaves of the point star forest are owned by another process.
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmMesh, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    std::vector<bool> isOwned(pEnd-pStart, true);
+    PetscSF sf = NULL;
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dmMesh, &sf);CPPUNIT_ASSERT(!err);
+    err = PetscSFGetGraph(sf, &numRoots, &numLeaves, &leaves, NULL);CPPUNIT_ASSERT(!err);
+    for (PetscInt iLeaf = 0; numRoots >= 0 && iLeaf < numLeaves; ++iLeaf) {
+        const PetscInt leaf = leaves ? leaves[iLeaf] : iLeaf;
+        isOwned[leaf-pStart] = false;
+    } // for
+
+    PetscInt numPointsLocal = 0;
+    PetscDMLabel label = NULL;
+    err = DMGetLabel(dmMesh, name, &label);CPPUNIT_ASSERT(!err);
+    if (label) {
+        PetscIS pointsIS = NULL;
+        err = DMLabelGetStratumIS(label, value, &pointsIS);CPPUNIT_ASSERT(!err);
+        if (pointsIS) {
+            PetscInt numPoints = 0;
+            const PetscInt* points = NULL;
+            err = ISGetLocalSize(pointsIS, &numPoints);CPPUNIT_ASSERT(!err);
+            err = ISGetIndices(pointsIS, &points);CPPUNIT_ASSERT(!err);
+            for (PetscInt iPoint = 0; iPoint < numPoints; ++iPoint) {
+                numPointsLocal += isOwned[points[iPoint]-pStart] ? 1 : 0;
+            } // for
+            err = ISRestoreIndices(pointsIS, &points);CPPUNIT_ASSERT(!err);
+            err = ISDestroy(&pointsIS);CPPUNIT_ASSERT(!err);
+        } // if
+    } // if
+
+    PetscInt numPoints = 0;
+    err = MPI_Allreduce(&numPointsLocal, &numPoints, 1, MPIU_INT, MPI_SUM,
+                        PetscObjectComm((PetscObject) dmMesh));CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_RETURN(numPoints);
+} // _globalStratumSize
+
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::TestMeshCache_Data::TestMeshCache_Data(void) :
+    meshFilename(NULL),
+    cacheFilename(NULL),
+    faultLabel(NULL),
+    faultId(100),
+    numCohesiveCells(0),
+    cohesiveCellType(0) {} // constructor
+
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::TestMeshCache_Data::~TestMeshCache_Data(void) {} // destructor
+
+
+// End of file
@@ -0,0 +1,132 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/meshio/TestMeshCache.hh
+ *
+ * @brief C++ TestMeshCache object
+ *
+ * C++ unit testing for MeshCache.
+ */
+
+#if !defined(pylith_meshio_testmeshcache_hh)
+#define pylith_meshio_testmeshcache_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace meshio {
+        class TestMeshCache;
+        class TestMeshCache_Data;
+    } // meshio
+} // pylith
+
+/// C++ unit testing for MeshCache
+class pylith::meshio::TestMeshCache : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestMeshCache);
+
+    CPPUNIT_TEST(testWriteLabels);
+    CPPUNIT_TEST(testReadSameProcesses);
+    CPPUNIT_TEST(testReadDifferentProcesses);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Deallocate testing data.
+    void tearDown(void);
+
+    /// Test write() stores owner of cells and cell types of cohesive cells without changing mesh.
+    void testWriteLabels(void);
+
+    /// Test write() and read() with same number of processes.
+    void testReadSameProcesses(void);
+
+    /// Test write() and read() with different number of processes.
+    void testReadDifferentProcesses(void);
+
+    // PROTECTED MEMBERS //////////////////////////////////////////////////
+protected:
+
+    TestMeshCache_Data* _data; ///< Data for testing.
+    topology::Mesh* _mesh; ///< Finite-element mesh.
+
+    // PRIVATE METHODS ////////////////////////////////////////////////////
+private:
+
+    /// Setup mesh.
+    void _initialize(void);
+
+    /** Check mesh read from cache against original mesh.
+     *
+     * @param[in] meshE Original mesh.
+     * @param[in] mesh Mesh read from cache.
+     */
+    static
+    void _checkMesh(const topology::Mesh& meshE,
+                    const topology::Mesh& mesh);
+
+    /** Compute global number of points in label stratum.
+     *
+     * @param[in] dmMesh PETSc DM for mesh.
+     * @param[in] name Name of label.
+     * @param[in] value Value of label stratum.
+     * @returns Number of points over all processes.
+     */
+    static
+    PetscInt _globalStratumSize(const PetscDM dmMesh,
+                                const char* name,
+                                const PetscInt value);
+
+}; // class TestMeshCache
+
+// ======================================================================
+class pylith::meshio::TestMeshCache_Data {
+    // PUBLIC METHODS ///////////////////////////////////////////////////
+public:
+
+    /// Constructor
+    TestMeshCache_Data(void);
+
+    /// Destructor
+    ~TestMeshCache_Data(void);
+
+    // PUBLIC MEMBERS ///////////////////////////////////////////////////
+public:
+
+    const char* meshFilename; ///< Name of file with input mesh.
+    const char* cacheFilename; ///< Name of mesh cache file.
+    const char* faultLabel; ///< Name of group of vertices for fault (NULL for no fault).
+    int faultId; ///< Material identifier for fault.
+    int numCohesiveCells; ///< Expected number of cohesive cells.
+    int cohesiveCellType; ///< Cell type (DMPolytopeType) of cohesive cells.
+
+}; // class TestMeshCache_Data
+
+#endif // pylith_meshio_testmeshcache_hh
+
+// End of file
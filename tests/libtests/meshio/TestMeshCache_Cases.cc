@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshCache.hh" // Implementation of cases
+
+#include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
+
+#include <petscdm.h> // USES DMPolytopeType
+
+namespace pylith {
+    namespace meshio {
+        // --------------------------------------------------------------
+        class TestMeshCache_Tri : public TestMeshCache {
+            CPPUNIT_TEST_SUB_SUITE(TestMeshCache_Tri, TestMeshCache);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestMeshCache::setUp();
+                CPPUNIT_ASSERT(_data);
+
+                _data->meshFilename = "data/tri3.mesh";
+                _data->cacheFilename = "tri3_cache.h5";
+                _data->faultLabel = "fault";
+                _data->faultId = 100;
+                _data->numCohesiveCells = 1;
+                _data->cohesiveCellType = DM_POLYTOPE_SEG_PRISM_TENSOR;
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestMeshCache_Tri
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestMeshCache_Tri);
+
+        // --------------------------------------------------------------
+        class TestMeshCache_Hex : public TestMeshCache {
+            CPPUNIT_TEST_SUB_SUITE(TestMeshCache_Hex, TestMeshCache);
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                PYLITH_METHOD_BEGIN;
+
+                TestMeshCache::setUp();
+                CPPUNIT_ASSERT(_data);
+
+                _data->meshFilename = "data/hex8.mesh";
+                _data->cacheFilename = "hex8_cache.h5";
+                _data->faultLabel = "fault";
+                _data->faultId = 100;
+                _data->numCohesiveCells = 1;
+                _data->cohesiveCellType = DM_POLYTOPE_QUAD_PRISM_TENSOR;
+
+                PYLITH_METHOD_END;
+            } // setUp
+
+        }; // class TestMeshCache_Hex
+        CPPUNIT_TEST_SUITE_REGISTRATION(TestMeshCache_Hex);
+
+    } // meshio
+} // pylith
+
+// End of file
@@ -23,12 +23,61 @@
 #include "pylith/meshio/MeshIOCubit.hh"
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES CoordsVisitor
 
 #include "pylith/utils/error.hh" // USES PYLITH_METHOD_BEGIN/END
 #include "pylith/utils/journals.hh" // USES JournalingComponent
 
+#include <sstream> // USES std::ostringstream
 #include <strings.h> // USES strcasecmp()
 
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace meshio {
+        class _TestMeshIOCubit {
+public:
+
+            /** Count points in label stratum owned by this process, summed over all processes.
+             *
+             * @param[in] mesh Finite-element mesh.
+             * @param[in] labelName Name of label.
+             * @param[in] labelValue Value of label.
+             * @returns Number of points in stratum over all processes.
+             */
+            static
+            PylithInt countStratum(const pylith::topology::Mesh& mesh,
+                                   const char* labelName,
+                                   const PylithInt labelValue);
+
+            /** Count cells and vertices owned by this process and sum squares of their vertex coordinates, summed
+             * over all processes.
+             *
+             * @param[in] mesh Finite-element mesh.
+             * @param[out] numCells Number of cells over all processes.
+             * @param[out] numVertices Number of vertices over all processes.
+             * @param[out] coordsNorm Sum of squares of vertex coordinates over all processes.
+             */
+            static
+            void countMesh(const pylith::topology::Mesh& mesh,
+                           PylithInt* numCells,
+                           PylithInt* numVertices,
+                           PylithReal* coordsNorm);
+
+            /** Check whether point is owned by this process.
+             *
+             * @param[in] dm PETSc DM for mesh.
+             * @param[in] point Point in mesh.
+             * @returns True if point is not a leaf of the point star forest, false otherwise.
+             */
+            static
+            bool isOwned(PetscDM dm,
+                         const PylithInt point);
+
+        }; // _TestMeshIOCubit
+    } // meshio
+} // pylith
+
 // ----------------------------------------------------------------------
 // Setup testing data.
 void
@@ -120,6 +169,69 @@ pylith::meshio::TestMeshIOCubit::testRead(void) {
 } // testRead
 
 
+// ----------------------------------------------------------------------
+// Test read() with each process reading a slab matches reading on process 0.
+void
+pylith::meshio::TestMeshIOCubit::testReadParallel(void) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(_io);
+    CPPUNIT_ASSERT(_data);
+
+    _io->filename(_data->filename);
+    _io->useNodesetNames(true);
+
+    // Read mesh on process 0.
+    CPPUNIT_ASSERT(!_io->getParallelRead());
+    topology::Mesh meshSerial;
+    _io->read(&meshSerial);
+
+    // Read mesh with each process reading a slab.
+    _io->setParallelRead(true);
+    CPPUNIT_ASSERT(_io->getParallelRead());
+    delete _mesh;_mesh = new topology::Mesh;CPPUNIT_ASSERT(_mesh);
+    _io->read(_mesh);
+
+    CPPUNIT_ASSERT_EQUAL(meshSerial.dimension(), _mesh->dimension());
+    CPPUNIT_ASSERT_EQUAL(meshSerial.numCorners(), _mesh->numCorners());
+
+    PylithInt numCellsSerial = 0, numVerticesSerial = 0;
+    PylithReal coordsNormSerial = 0.0;
+    _TestMeshIOCubit::countMesh(meshSerial, &numCellsSerial, &numVerticesSerial, &coordsNormSerial);
+    PylithInt numCells = 0, numVertices = 0;
+    PylithReal coordsNorm = 0.0;
+    _TestMeshIOCubit::countMesh(*_mesh, &numCells, &numVertices, &coordsNorm);
+
+    CPPUNIT_ASSERT_EQUAL(_data->numCells, numCellsSerial);
+    CPPUNIT_ASSERT_EQUAL(_data->numVertices, numVerticesSerial);
+    CPPUNIT_ASSERT_EQUAL(numCellsSerial, numCells);
+    CPPUNIT_ASSERT_EQUAL(numVerticesSerial, numVertices);
+    const PylithReal tolerance = 1.0e-6;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, coordsNorm/coordsNormSerial, tolerance);
+
+    // Check materials
+    for (PylithInt i = 0; i < _data->numCells; ++i) {
+        const PylithInt matId = _data->materialIds[i];
+        std::ostringstream msg;
+        msg << "Mismatch in number of cells for material " << matId << ".";
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), _TestMeshIOCubit::countStratum(meshSerial, "material-id", matId),
+                                     _TestMeshIOCubit::countStratum(*_mesh, "material-id", matId));
+    } // for
+
+    // Check groups
+    for (PylithInt iGroup = 0; iGroup < _data->numGroups; ++iGroup) {
+        const char* groupName = _data->groupNames[iGroup];
+        std::ostringstream msg;
+        msg << "Mismatch in number of points in group '" << groupName << "'.";
+        const PylithInt groupSize = _TestMeshIOCubit::countStratum(meshSerial, groupName, 1);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), _data->groupSizes[iGroup], groupSize);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), groupSize, _TestMeshIOCubit::countStratum(*_mesh, groupName, 1));
+    } // for
+
+    PYLITH_METHOD_END;
+} // testReadParallel
+
+
 // ----------------------------------------------------------------------
 // Get test data.
 pylith::meshio::TestMeshIO_Data*
@@ -139,4 +251,106 @@ pylith::meshio::TestMeshIOCubit_Data::TestMeshIOCubit_Data(void) :
 pylith::meshio::TestMeshIOCubit_Data::~TestMeshIOCubit_Data(void) {}
 
 
+// ----------------------------------------------------------------------
+// Count points in label stratum owned by this process, summed over all processes.
+PylithInt
+pylith::meshio::_TestMeshIOCubit::countStratum(const pylith::topology::Mesh& mesh,
+                                               const char* labelName,
+                                               const PylithInt labelValue) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+    PetscErrorCode err = 0;
+
+    PylithInt countLocal = 0;
+    PetscIS pointIS = NULL;
+    err = DMGetStratumIS(dmMesh, labelName, labelValue, &pointIS);CPPUNIT_ASSERT(!err);
+    if (pointIS) {
+        PylithInt numPoints = 0;
+        const PylithInt* points = NULL;
+        err = ISGetLocalSize(pointIS, &numPoints);CPPUNIT_ASSERT(!err);
+        err = ISGetIndices(pointIS, &points);CPPUNIT_ASSERT(!err);
+        for (PylithInt p = 0; p < numPoints; ++p) {
+            countLocal += isOwned(dmMesh, points[p]) ? 1 : 0;
+        } // for
+        err = ISRestoreIndices(pointIS, &points);CPPUNIT_ASSERT(!err);
+        err = ISDestroy(&pointIS);CPPUNIT_ASSERT(!err);
+    } // if
+
+    PylithInt count = 0;
+    err = MPI_Allreduce(&countLocal, &count, 1, MPIU_INT, MPI_SUM, mesh.comm());CPPUNIT_ASSERT(!err);
+
+    PYLITH_METHOD_RETURN(count);
+} // countStratum
+
+
+// ----------------------------------------------------------------------
+// Count cells and vertices owned by this process and sum squares of their vertex coordinates.
+void
+pylith::meshio::_TestMeshIOCubit::countMesh(const pylith::topology::Mesh& mesh,
+                                            PylithInt* numCells,
+                                            PylithInt* numVertices,
+                                            PylithReal* coordsNorm) {
+    PYLITH_METHOD_BEGIN;
+
+    CPPUNIT_ASSERT(numCells);
+    CPPUNIT_ASSERT(numVertices);
+    CPPUNIT_ASSERT(coordsNorm);
+
+    PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+    PetscErrorCode err = 0;
+
+    PylithInt countsLocal[2] = { 0, 0 };
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    for (PylithInt c = cellsStratum.begin(); c < cellsStratum.end(); ++c) {
+        countsLocal[0] += isOwned(dmMesh, c) ? 1 : 0;
+    } // for
+
+    PylithReal coordsNormLocal = 0.0;
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    const PetscScalar* coordsArray = coordsVisitor.localArray();
+    for (PylithInt v = verticesStratum.begin(); v < verticesStratum.end(); ++v) {
+        if (!isOwned(dmMesh, v)) {
+            continue;
+        } // if
+        ++countsLocal[1];
+        const PylithInt off = coordsVisitor.sectionOffset(v);
+        const PylithInt dof = coordsVisitor.sectionDof(v);
+        for (PylithInt iDim = 0; iDim < dof; ++iDim) {
+            coordsNormLocal += coordsArray[off+iDim]*coordsArray[off+iDim];
+        } // for
+    } // for
+
+    PylithInt counts[2] = { 0, 0 };
+    err = MPI_Allreduce(countsLocal, counts, 2, MPIU_INT, MPI_SUM, mesh.comm());CPPUNIT_ASSERT(!err);
+    err = MPI_Allreduce(&coordsNormLocal, coordsNorm, 1, MPIU_REAL, MPI_SUM, mesh.comm());CPPUNIT_ASSERT(!err);
+    *numCells = counts[0];
+    *numVertices = counts[1];
+
+    PYLITH_METHOD_END;
+} // countMesh
+
+
+// ----------------------------------------------------------------------
+// Check whether point is owned by this process.
+bool
+pylith::meshio::_TestMeshIOCubit::isOwned(PetscDM dm,
+                                          const PylithInt point) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscSF pointSF = NULL;
+    const PylithInt* leaves = NULL;
+    PylithInt numLeaves = 0;
+    PetscErrorCode err = DMGetPointSF(dm, &pointSF);CPPUNIT_ASSERT(!err);
+    err = PetscSFGetGraph(pointSF, NULL, &numLeaves, &leaves, NULL);CPPUNIT_ASSERT(!err);
+    bool owned = true;
+    for (PylithInt i = 0; i < numLeaves && owned; ++i) {
+        owned = point != (leaves ? leaves[i] : i);
+    } // for
+
+    PYLITH_METHOD_RETURN(owned);
+} // isOwned
+
+
 // End of file
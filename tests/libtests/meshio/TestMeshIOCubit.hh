@@ -49,6 +49,7 @@ class pylith::meshio::TestMeshIOCubit : public TestMeshIO { // class TestMeshIOC
     CPPUNIT_TEST(testDebug);
     CPPUNIT_TEST(testFilename);
     CPPUNIT_TEST(testRead);
+    CPPUNIT_TEST(testReadParallel);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -73,6 +74,9 @@ public:
     /// Test read().
     void testRead(void);
 
+    /// Test read() with each process reading a slab matches reading on process 0.
+    void testReadParallel(void);
+
     /** Get test data.
      *
      * @returns Test data.
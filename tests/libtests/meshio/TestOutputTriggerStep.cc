@@ -73,4 +73,27 @@ pylith::meshio::TestOutputTriggerStep::testShouldWrite(void) {
 } // testShouldWrite
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Test willWrite().
+void
+pylith::meshio::TestOutputTriggerStep::testWillWrite(void) {
+    OutputTriggerStep trigger;
+    trigger.setNumStepsSkip(1);
+
+    const PylithReal dt = 0.1;
+    PylithReal t = 0.0;
+    PylithInt tindex = 0;
+    CPPUNIT_ASSERT(trigger.willWrite(t, tindex));
+    CPPUNIT_ASSERT(trigger.willWrite(t, tindex)); // State is not updated.
+    CPPUNIT_ASSERT(trigger.shouldWrite(t, tindex++));t += dt;
+
+    CPPUNIT_ASSERT(!trigger.willWrite(t, tindex));
+    CPPUNIT_ASSERT(!trigger.shouldWrite(t, tindex++));t += dt;
+
+    CPPUNIT_ASSERT(trigger.willWrite(t, tindex));
+    CPPUNIT_ASSERT(trigger.shouldWrite(t, tindex++));t += dt;
+    CPPUNIT_ASSERT(!trigger.willWrite(t, tindex));
+} // testWillWrite
+
+
 // End of file
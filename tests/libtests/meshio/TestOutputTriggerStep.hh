@@ -44,6 +44,7 @@ class pylith::meshio::TestOutputTriggerStep : public CppUnit::TestFixture {
 
     CPPUNIT_TEST(testNumStepsSkip);
     CPPUNIT_TEST(testShouldWrite);
+    CPPUNIT_TEST(testWillWrite);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -56,6 +57,9 @@ public:
     /// Test shouldWrite().
     void testShouldWrite(void);
 
+    /// Test willWrite().
+    void testWillWrite(void);
+
 }; // class TestOutputTriggerStep
 
 #endif // pylith_meshio_testoutputtriggerstep_hh
@@ -73,4 +73,27 @@ pylith::meshio::TestOutputTriggerTime::testShouldWrite(void) {
 } // testShouldWrite
 
 
+// ---------------------------------------------------------------------------------------------------------------------
+// Test willWrite().
+void
+pylith::meshio::TestOutputTriggerTime::testWillWrite(void) {
+    OutputTriggerTime trigger;
+    trigger.setTimeSkip(0.1999);
+
+    const PylithReal dt = 0.1;
+    PylithReal t = 0.0;
+    PylithInt tindex = 0;
+    CPPUNIT_ASSERT(trigger.willWrite(t, tindex));
+    CPPUNIT_ASSERT(trigger.willWrite(t, tindex)); // State is not updated.
+    CPPUNIT_ASSERT(trigger.shouldWrite(t, tindex++));t += dt;
+
+    CPPUNIT_ASSERT(!trigger.willWrite(t, tindex));
+    CPPUNIT_ASSERT(!trigger.shouldWrite(t, tindex++));t += dt;
+
+    CPPUNIT_ASSERT(trigger.willWrite(t, tindex));
+    CPPUNIT_ASSERT(trigger.shouldWrite(t, tindex++));t += dt;
+    CPPUNIT_ASSERT(!trigger.willWrite(t, tindex));
+} // testWillWrite
+
+
 // End of file
@@ -44,6 +44,7 @@ class pylith::meshio::TestOutputTriggerTime : public CppUnit::TestFixture {
 
     CPPUNIT_TEST(testTimeSkip);
     CPPUNIT_TEST(testShouldWrite);
+    CPPUNIT_TEST(testWillWrite);
 
     CPPUNIT_TEST_SUITE_END();
 
@@ -56,6 +57,9 @@ public:
     /// Test shouldWrite().
     void testShouldWrite(void);
 
+    /// Test willWrite().
+    void testWillWrite(void);
+
 }; // class TestOutputTriggerTime
 
 #endif // pylith_meshio_testoutputtriggertime_hh
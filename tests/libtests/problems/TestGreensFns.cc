@@ -0,0 +1,484 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestGreensFns.hh" // Implementation of class methods
+
+#include "pylith/problems/GreensFns.hh" // Test subject
+#include "pylith/problems/ObserverSoln.hh" // ISA ObserverSoln
+#include "pylith/problems/SolutionFactory.hh" // USES SolutionFactory
+#include "pylith/faults/FaultCohesiveImpulses.hh" // USES FaultCohesiveImpulses
+#include "pylith/materials/Elasticity.hh" // USES Elasticity
+#include "pylith/materials/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity
+#include "pylith/bc/DirichletUserFn.hh" // USES DirichletUserFn
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "spatialdata/spatialdb/UserFunctionDB.hh" // USES UserFunctionDB
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <map> // USES std::map
+#include <cmath> // USES sqrt()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _TestGreensFns {
+public:
+
+            static double density(const double x,
+                                  const double y) {
+                return 2500.0;
+            } // density
+
+            static const char* density_units(void) {
+                return "kg/m**3";
+            } // density_units
+
+            static double vs(const double x,
+                             const double y) {
+                return 3000.0;
+            } // vs
+
+            static double vp(const double x,
+                             const double y) {
+                return sqrt(3.0)*vs(x,y);
+            } // vp
+
+            static const char* velocity_units(void) {
+                return "m/s";
+            } // velocity_units
+
+            // Impulses at the two fault vertices with y >= 0 (y = 0 km and y = +4 km).
+            static double impulse_amplitude(const double x,
+                                            const double y) {
+                return y >= 0.0 ? 1.0 : 0.0;
+            } // impulse_amplitude
+
+            static const char* amplitude_units(void) {
+                return "m";
+            } // amplitude_units
+
+            static PetscErrorCode solnkernel_disp(PetscInt spaceDim,
+                                                  PetscReal t,
+                                                  const PetscReal x[],
+                                                  PetscInt numComponents,
+                                                  PetscScalar* s,
+                                                  void* context) {
+                CPPUNIT_ASSERT(2 == numComponents);
+                CPPUNIT_ASSERT(s);
+
+                s[0] = 0.0;
+                s[1] = 0.0;
+
+                return 0;
+            } // solnkernel_disp
+
+            static const size_t numImpulses;
+            static const PylithReal lengthScale;
+
+        }; // _TestGreensFns
+        const size_t _TestGreensFns::numImpulses = 4; // 2 points x 2 components
+        const PylithReal _TestGreensFns::lengthScale = 1.0e+3;
+
+        // Observer that keeps a copy of the solution (local vector) for each impulse.
+        class _TestGreensFnsObserver : public ObserverSoln {
+public:
+
+            ~_TestGreensFnsObserver(void) {
+                clear();
+            } // destructor
+
+            void setTimeScale(const PylithReal value) {}
+
+            void verifyConfiguration(const pylith::topology::Field& solution) const {}
+
+            void update(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution) {
+                PetscErrorCode err = 0;
+                if (solutions.count(tindex)) {
+                    err = VecDestroy(&solutions[tindex]);CPPUNIT_ASSERT(!err);
+                } // if
+                PetscVec solutionVec = NULL;
+                err = VecDuplicate(solution.localVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+                err = VecCopy(solution.localVector(), solutionVec);CPPUNIT_ASSERT(!err);
+                solutions[tindex] = solutionVec;
+            } // update
+
+            void clear(void) {
+                for (std::map<PylithInt, PetscVec>::iterator iter = solutions.begin(); iter != solutions.end(); ++iter) {
+                    PetscErrorCode err = VecDestroy(&iter->second);CPPUNIT_ASSERT(!err);
+                } // for
+                solutions.clear();
+            } // clear
+
+            std::map<PylithInt, PetscVec> solutions; ///< Solution for each impulse.
+
+        }; // _TestGreensFnsObserver
+
+    } // problems
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::problems::TestGreensFns);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::problems::TestGreensFns::setUp(void) {
+    _problem = new GreensFns();CPPUNIT_ASSERT(_problem);
+    _mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+    _solution = NULL;
+    _material = new pylith::materials::Elasticity();CPPUNIT_ASSERT(_material);
+    _rheology = new pylith::materials::IsotropicLinearElasticity();CPPUNIT_ASSERT(_rheology);
+    _bc = new pylith::bc::DirichletUserFn();CPPUNIT_ASSERT(_bc);
+    _fault = new pylith::faults::FaultCohesiveImpulses();CPPUNIT_ASSERT(_fault);
+    _observer = new _TestGreensFnsObserver();CPPUNIT_ASSERT(_observer);
+
+    _cs = new spatialdata::geocoords::CSCart();CPPUNIT_ASSERT(_cs);
+    _cs->setSpaceDim(2);
+
+    _normalizer = new spatialdata::units::Nondimensional();CPPUNIT_ASSERT(_normalizer);
+    _normalizer->setLengthScale(_TestGreensFns::lengthScale);
+    _normalizer->setTimeScale(2.0);
+    _normalizer->setPressureScale(2.25e+10);
+    _normalizer->computeDensityScale();
+
+    _matAuxDB = new spatialdata::spatialdb::UserFunctionDB();CPPUNIT_ASSERT(_matAuxDB);
+    _matAuxDB->setLabel("material auxiliary field spatial database");
+    _matAuxDB->addValue("density", _TestGreensFns::density, _TestGreensFns::density_units());
+    _matAuxDB->addValue("vp", _TestGreensFns::vp, _TestGreensFns::velocity_units());
+    _matAuxDB->addValue("vs", _TestGreensFns::vs, _TestGreensFns::velocity_units());
+    _matAuxDB->setCoordSys(*_cs);
+
+    _faultAuxDB = new spatialdata::spatialdb::UserFunctionDB();CPPUNIT_ASSERT(_faultAuxDB);
+    _faultAuxDB->setLabel("fault auxiliary field spatial database");
+    _faultAuxDB->addValue("impulse_amplitude", _TestGreensFns::impulse_amplitude, _TestGreensFns::amplitude_units());
+    _faultAuxDB->setCoordSys(*_cs);
+
+    // Exact solves, so that block and single right hand sides agree to roundoff.
+    PetscErrorCode err = 0;
+    err = PetscOptionsSetValue(NULL, "-ksp_type", "preonly");CPPUNIT_ASSERT(!err);
+    err = PetscOptionsSetValue(NULL, "-pc_type", "svd");CPPUNIT_ASSERT(!err);
+} // setUp
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::problems::TestGreensFns::tearDown(void) {
+    delete _problem;_problem = NULL;
+    delete _observer;_observer = NULL;
+    delete _fault;_fault = NULL;
+    delete _bc;_bc = NULL;
+    delete _material;_material = NULL;
+    delete _rheology;_rheology = NULL;
+    delete _solution;_solution = NULL;
+    delete _mesh;_mesh = NULL;
+
+    delete _cs;_cs = NULL;
+    delete _normalizer;_normalizer = NULL;
+    delete _matAuxDB;_matAuxDB = NULL;
+    delete _faultAuxDB;_faultAuxDB = NULL;
+
+    PetscErrorCode err = 0;
+    err = PetscOptionsClearValue(NULL, "-ksp_type");CPPUNIT_ASSERT(!err);
+    err = PetscOptionsClearValue(NULL, "-pc_type");CPPUNIT_ASSERT(!err);
+} // tearDown
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test setRHSBlockSize(), getRHSBlockSize().
+void
+pylith::problems::TestGreensFns::testAccessors(void) {
+    CPPUNIT_ASSERT(_problem);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(1), _problem->getRHSBlockSize());
+
+    _problem->setRHSBlockSize(8);
+    CPPUNIT_ASSERT_EQUAL(size_t(8), _problem->getRHSBlockSize());
+
+    CPPUNIT_ASSERT_THROW(_problem->setRHSBlockSize(0), std::runtime_error);
+    CPPUNIT_ASSERT_EQUAL(size_t(8), _problem->getRHSBlockSize());
+} // testAccessors
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test numbering of impulses across processes.
+void
+pylith::problems::TestGreensFns::testImpulseNumbering(void) {
+    _initialize();
+
+    CPPUNIT_ASSERT(_fault);
+    CPPUNIT_ASSERT_EQUAL(_TestGreensFns::numImpulses, _fault->getNumImpulses());
+
+    // Each process numbers its impulses contiguously starting at the sum of the impulses on lower ranks.
+    const pylith::topology::Field* auxField = _problem->_integratorImpulses->getAuxiliaryField();CPPUNIT_ASSERT(auxField);
+    pylith::topology::VecVisitorMesh amplitudeVisitor(*auxField, "impulse_amplitude");
+    const PylithScalar* amplitudeArray = amplitudeVisitor.localArray();
+    PetscSection globalSection = auxField->globalSection();CPPUNIT_ASSERT(globalSection);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(auxField->localSection(), &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    PetscInt numPointsLocal = 0;
+    for (PetscInt p = pStart; p < pEnd; ++p) {
+        PetscInt globalDof = 0;
+        err = PetscSectionGetDof(globalSection, p, &globalDof);CPPUNIT_ASSERT(!err);
+        if ((amplitudeVisitor.sectionDof(p) > 0) && (globalDof > 0) &&
+            (amplitudeArray[amplitudeVisitor.sectionOffset(p)] > 0.0)) {
+            ++numPointsLocal;
+        } // if
+    } // for
+    const PetscInt numImpulsesLocal = numPointsLocal * _fault->getNumImpulseDOF();
+
+    MPI_Comm comm = _mesh->comm();
+    PetscInt offsetE = 0;
+    PetscInt numImpulsesE = 0;
+    err = MPI_Exscan(&numImpulsesLocal, &offsetE, 1, MPIU_INT, MPI_SUM, comm);CPPUNIT_ASSERT(!err);
+    err = MPI_Allreduce(&numImpulsesLocal, &numImpulsesE, 1, MPIU_INT, MPI_SUM, comm);CPPUNIT_ASSERT(!err);
+    if (0 == _mesh->commRank()) {
+        offsetE = 0; // Result of MPI_Exscan is undefined on rank 0.
+    } // if
+
+    CPPUNIT_ASSERT_EQUAL(size_t(numImpulsesE), _fault->getNumImpulses());
+    CPPUNIT_ASSERT_EQUAL(size_t(numPointsLocal), _fault->_impulsePoints.size());
+    CPPUNIT_ASSERT_EQUAL(size_t(offsetE), _fault->_impulseOffset);
+} // testImpulseNumbering
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _setImpulse().
+void
+pylith::problems::TestGreensFns::testSetImpulse(void) {
+    _initialize();
+
+    CPPUNIT_ASSERT(_problem);
+    CPPUNIT_ASSERT(_problem->_integratorImpulses);
+    CPPUNIT_ASSERT(_normalizer);
+
+    const PylithReal tolerance = 1.0e-6;
+    const PylithReal amplitudeE = 1.0 / _normalizer->getLengthScale();
+    MPI_Comm comm = _mesh->comm();
+    for (size_t impulse = 0; impulse < _TestGreensFns::numImpulses; ++impulse) {
+        _problem->_setImpulse(impulse);
+
+        // Count nonzero slip values at points owned by this process.
+        const pylith::topology::Field* auxField = _problem->_integratorImpulses->getAuxiliaryField();CPPUNIT_ASSERT(auxField);
+        pylith::topology::VecVisitorMesh slipVisitor(*auxField, "slip");
+        const PylithScalar* slipArray = slipVisitor.localArray();
+        PetscSection globalSection = auxField->globalSection();CPPUNIT_ASSERT(globalSection);
+        PetscInt pStart = 0, pEnd = 0;
+        PetscErrorCode err = PetscSectionGetChart(auxField->localSection(), &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+        PetscInt numNonzeroLocal = 0;
+        for (PetscInt p = pStart; p < pEnd; ++p) {
+            PetscInt globalDof = 0;
+            err = PetscSectionGetDof(globalSection, p, &globalDof);CPPUNIT_ASSERT(!err);
+            if (globalDof <= 0) {
+                continue;
+            } // if
+            const PetscInt slipDof = slipVisitor.sectionDof(p);
+            const PetscInt slipOff = slipVisitor.sectionOffset(p);
+            for (PetscInt iDof = 0; iDof < slipDof; ++iDof) {
+                if (slipArray[slipOff+iDof] != 0.0) {
+                    ++numNonzeroLocal;
+                    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, slipArray[slipOff+iDof]/amplitudeE, tolerance);
+                } // if
+            } // for
+        } // for
+
+        PetscInt numNonzero = 0;
+        err = MPI_Allreduce(&numNonzeroLocal, &numNonzero, 1, MPIU_INT, MPI_SUM, comm);CPPUNIT_ASSERT(!err);
+        std::ostringstream msg;
+        msg << "Expected exactly one nonzero slip value over all processes for impulse " << impulse << ".";
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), PetscInt(1), numNonzero);
+    } // for
+} // testSetImpulse
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test _computeRHS().
+void
+pylith::problems::TestGreensFns::testComputeRHS(void) {
+    _initialize();
+
+    CPPUNIT_ASSERT(_problem);
+    CPPUNIT_ASSERT(_solution);
+
+    PetscErrorCode err = 0;
+    PetscVec rhsVec = NULL;
+    PetscVec solutionVec = NULL;
+    PetscVec residualVec = NULL;
+    err = VecDuplicate(_solution->globalVector(), &rhsVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &residualVec);CPPUNIT_ASSERT(!err);
+
+    const PylithReal tolerance = 1.0e-10;
+    for (size_t impulse = 0; impulse < _TestGreensFns::numImpulses; ++impulse) {
+        _problem->_computeRHS(rhsVec, impulse);
+        PylithReal rhsNorm = 0.0;
+        err = VecNorm(rhsVec, NORM_2, &rhsNorm);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_MESSAGE("Right hand side for slip impulse is zero.", rhsNorm > 0.0);
+
+        err = KSPSolve(_problem->getPetscKSP(), rhsVec, solutionVec);CPPUNIT_ASSERT(!err);
+
+        // Problem is linear, so F(s) = F(0) + J s = 0 if and only if the right hand side is -F(0).
+        _solution->scatterVectorToLocal(solutionVec);
+        for (size_t i = 0; i < _problem->_constraints.size(); ++i) {
+            _problem->_constraints[i]->setSolution(_solution, 0.0);
+        } // for
+        _problem->_residual->zeroLocal();
+        for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+            _problem->_integrators[i]->computeLHSResidual(_problem->_residual, 0.0, 1.0, *_solution,
+                                                          *_problem->_solutionDot);
+        } // for
+        err = VecSet(residualVec, 0.0);CPPUNIT_ASSERT(!err);
+        _problem->_residual->scatterLocalToVector(residualVec, ADD_VALUES);
+        PylithReal residualNorm = 0.0;
+        err = VecNorm(residualVec, NORM_2, &residualNorm);CPPUNIT_ASSERT(!err);
+
+        std::ostringstream msg;
+        msg << "Residual at solution for impulse " << impulse << " is not zero.";
+        CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), 0.0, residualNorm/rhsNorm, tolerance);
+    } // for
+
+    err = VecDestroy(&rhsVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&residualVec);CPPUNIT_ASSERT(!err);
+} // testComputeRHS
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test solve() with single and block right hand sides.
+void
+pylith::problems::TestGreensFns::testSolveBlocks(void) {
+    _initialize();
+
+    CPPUNIT_ASSERT(_problem);
+    CPPUNIT_ASSERT(_observer);
+
+    // One impulse at a time (KSPSolve).
+    _problem->setRHSBlockSize(1);
+    _problem->solve();
+    CPPUNIT_ASSERT_EQUAL(_TestGreensFns::numImpulses, _observer->solutions.size());
+    std::map<PylithInt, PetscVec> solutionsSingle;
+    solutionsSingle.swap(_observer->solutions);
+
+    // Blocks of 3 impulses (KSPMatSolve), so the last block is partial.
+    _problem->setRHSBlockSize(3);
+    _problem->solve();
+    CPPUNIT_ASSERT_EQUAL(_TestGreensFns::numImpulses, _observer->solutions.size());
+
+    PetscErrorCode err = 0;
+    const PylithReal tolerance = 1.0e-10;
+    MPI_Comm comm = _mesh->comm();
+    for (std::map<PylithInt, PetscVec>::iterator iter = solutionsSingle.begin(); iter != solutionsSingle.end(); ++iter) {
+        CPPUNIT_ASSERT(_observer->solutions.count(iter->first));
+        PetscVec solutionBlock = _observer->solutions[iter->first];
+
+        PylithReal normLocal[2] = { 0.0, 0.0 };
+        err = VecNorm(iter->second, NORM_INFINITY, &normLocal[0]);CPPUNIT_ASSERT(!err);
+        err = VecAXPY(iter->second, -1.0, solutionBlock);CPPUNIT_ASSERT(!err);
+        err = VecNorm(iter->second, NORM_INFINITY, &normLocal[1]);CPPUNIT_ASSERT(!err);
+        PylithReal norm[2] = { 0.0, 0.0 };
+        err = MPI_Allreduce(normLocal, norm, 2, MPIU_REAL, MPI_MAX, comm);CPPUNIT_ASSERT(!err);
+
+        std::ostringstream msg;
+        msg << "Solutions for impulse " << iter->first << " from single and block right hand sides differ.";
+        CPPUNIT_ASSERT_MESSAGE("Solution for slip impulse is zero.", norm[0] > 0.0);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), 0.0, norm[1]/norm[0], tolerance);
+
+        err = VecDestroy(&iter->second);CPPUNIT_ASSERT(!err);
+    } // for
+} // testSolveBlocks
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Initialize objects for test.
+void
+pylith::problems::TestGreensFns::_initialize(void) {
+    CPPUNIT_ASSERT(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.filename("data/tri_fault.mesh");
+    iohandler.read(_mesh);
+    CPPUNIT_ASSERT_MESSAGE("Test mesh does not contain any cells.", _mesh->numCells() > 0);
+
+    _mesh->setCoordSys(_cs);
+    pylith::topology::MeshOps::nondimensionalize(_mesh, *_normalizer);
+
+    // Material
+    _material->setFormulation(pylith::problems::Physics::QUASISTATIC);
+    _material->useBodyForce(false);
+    _material->setDescriptiveLabel("Isotropic Linear Elasticity Plane Strain");
+    _material->setMaterialId(24);
+    _material->setBulkRheology(_rheology);
+    _material->setAuxiliaryFieldDB(_matAuxDB);
+
+    // Boundary condition
+    static const PylithInt constrainedDOF[2] = {0, 1};
+    _bc->setConstrainedDOF(constrainedDOF, 2);
+    _bc->setMarkerLabel("boundary");
+    _bc->setSubfieldName("displacement");
+    _bc->setUserFn(_TestGreensFns::solnkernel_disp);
+
+    // Fault with slip impulses for both slip components.
+    static const int impulseDOF[2] = {0, 1};
+    _fault->setInterfaceId(100);
+    _fault->setSurfaceMarkerLabel("fault");
+    _fault->setImpulseDOF(impulseDOF, 2);
+    _fault->setThreshold(0.5);
+    _fault->setAuxiliaryFieldDB(_faultAuxDB);
+    _fault->adjustTopology(_mesh);
+
+    // Solution
+    CPPUNIT_ASSERT(!_solution);
+    _solution = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(_solution);
+    _solution->setLabel("solution");
+    pylith::problems::SolutionFactory factory(*_solution, *_normalizer);
+    factory.addDisplacement(pylith::topology::Field::Discretization(1, 1));
+    factory.addLagrangeMultiplierFault(pylith::topology::Field::Discretization(1, 1, 1));
+
+    // Problem
+    _problem->setFormulation(pylith::problems::Physics::QUASISTATIC);
+    _problem->setSolverType(pylith::problems::Problem::LINEAR);
+    _problem->setNormalizer(*_normalizer);
+    pylith::materials::Material* materials[1] = { _material };
+    _problem->setMaterials(materials, 1);
+    pylith::bc::BoundaryCondition* bcs[1] = { _bc };
+    _problem->setBoundaryConditions(bcs, 1);
+    pylith::faults::FaultCohesive* interfaces[1] = { _fault };
+    _problem->setInterfaces(interfaces, 1);
+    _problem->setFaultImpulses(_fault);
+    _problem->setSolution(_solution);
+    _problem->registerObserver(_observer);
+
+    _problem->preinitialize(*_mesh);
+    _problem->verifyConfiguration();
+    _problem->initialize();
+} // _initialize
+
+
+// End of file
@@ -0,0 +1,114 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/problems/TestGreensFns.hh
+ *
+ * @brief C++ TestGreensFns object.
+ *
+ * C++ unit testing for GreensFns with slip impulses on FaultCohesiveImpulses.
+ */
+
+#if !defined(pylith_problems_testgreensfns_hh)
+#define pylith_problems_testgreensfns_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/problems/problemsfwd.hh" // HOLDSA GreensFns
+#include "pylith/faults/faultsfwd.hh" // HOLDSA FaultCohesiveImpulses
+#include "pylith/materials/materialsfwd.hh" // HOLDSA Elasticity
+#include "pylith/bc/bcfwd.hh" // HOLDSA DirichletUserFn
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh, Field
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA UserFunctionDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CoordSys
+#include "spatialdata/units/unitsfwd.hh" // HOLDSA Nondimensional
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace problems {
+        class TestGreensFns;
+
+        class _TestGreensFnsObserver; // Observer recording solution for each impulse.
+    } // problems
+} // pylith
+
+class pylith::problems::TestGreensFns : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestGreensFns);
+
+    CPPUNIT_TEST(testAccessors);
+    CPPUNIT_TEST(testImpulseNumbering);
+    CPPUNIT_TEST(testSetImpulse);
+    CPPUNIT_TEST(testComputeRHS);
+    CPPUNIT_TEST(testSolveBlocks);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test setRHSBlockSize(), getRHSBlockSize().
+    void testAccessors(void);
+
+    /// Test numbering of impulses across processes.
+    void testImpulseNumbering(void);
+
+    /// Test _setImpulse() applies each impulse at exactly one point on exactly one process.
+    void testSetImpulse(void);
+
+    /// Test _computeRHS() gives -F(0), so the residual at the solution of the linear solve vanishes.
+    void testComputeRHS(void);
+
+    /// Test solving impulses one at a time (KSPSolve) and in blocks (KSPMatSolve) give the same solutions.
+    void testSolveBlocks(void);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /// Initialize objects for test.
+    void _initialize(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::problems::GreensFns* _problem; ///< Test subject.
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _solution; ///< Solution field.
+    pylith::materials::Elasticity* _material; ///< Elastic material.
+    pylith::materials::RheologyElasticity* _rheology; ///< Elastic rheology for material.
+    pylith::bc::DirichletUserFn* _bc; ///< Dirichlet boundary condition.
+    pylith::faults::FaultCohesiveImpulses* _fault; ///< Fault with slip impulses.
+    _TestGreensFnsObserver* _observer; ///< Observer recording solution for each impulse.
+
+    spatialdata::geocoords::CoordSys* _cs; ///< Coordinate system.
+    spatialdata::units::Nondimensional* _normalizer; ///< Scales for nondimensionalization.
+    spatialdata::spatialdb::UserFunctionDB* _matAuxDB; ///< Spatial database for material auxiliary field.
+    spatialdata::spatialdb::UserFunctionDB* _faultAuxDB; ///< Spatial database for fault auxiliary field.
+
+}; // class TestGreensFns
+
+#endif // pylith_problems_testgreensfns_hh
+
+// End of file
@@ -0,0 +1,1313 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestTimeDependent.hh" // Implementation of class methods
+
+#include "pylith/problems/TimeDependent.hh" // Test subject
+#include "pylith/problems/SolutionFactory.hh" // USES SolutionFactory
+#include "pylith/problems/ObserverSoln.hh" // ISA ObserverSoln
+#include "pylith/materials/Elasticity.hh" // USES Elasticity
+#include "pylith/materials/IsotropicLinearElasticity.hh" // USES IsotropicLinearElasticity
+#include "pylith/bc/DirichletUserFn.hh" // USES DirichletUserFn
+#include "pylith/bc/NeumannTimeDependent.hh" // USES NeumannTimeDependent
+#include "pylith/feassemble/IntegratorDomain.hh" // USES IntegratorDomain
+#include "pylith/feassemble/IntegratorBoundary.hh" // USES IntegratorBoundary
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::nondimensionalize()
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/utils/array.hh" // USES int_array
+
+#include "spatialdata/spatialdb/UserFunctionDB.hh" // USES UserFunctionDB
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <set> // USES std::set
+#include <map> // USES std::map
+#include <string> // USES std::string
+#include <vector> // USES std::vector
+#include <cstdio> // USES std::remove()
+#include <cmath> // USES sqrt()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ---------------------------------------------------------------------------------------------------------------------
+namespace pylith {
+    namespace problems {
+        class _TestTimeDependent {
+public:
+
+            static double density(const double x,
+                                  const double y) {
+                return 2500.0;
+            } // density
+
+            static const char* density_units(void) {
+                return "kg/m**3";
+            } // density_units
+
+            static double vs(const double x,
+                             const double y) {
+                return 3000.0;
+            } // vs
+
+            static double vp(const double x,
+                             const double y) {
+                return sqrt(3.0)*vs(x,y);
+            } // vp
+
+            static const char* velocity_units(void) {
+                return "m/s";
+            } // velocity_units
+
+            static double traction(const double x,
+                                   const double y) {
+                return -1.0e+6;
+            } // traction
+
+            static const char* traction_units(void) {
+                return "Pa";
+            } // traction_units
+
+            static PetscErrorCode solnkernel_disp(PetscInt spaceDim,
+                                                  PetscReal t,
+                                                  const PetscReal x[],
+                                                  PetscInt numComponents,
+                                                  PetscScalar* s,
+                                                  void* context) {
+                CPPUNIT_ASSERT(2 == numComponents);
+                CPPUNIT_ASSERT(s);
+
+                s[0] = 0.0;
+                s[1] = 0.0;
+
+                return 0;
+            } // solnkernel_disp
+
+            // Cells in the column with x <= +0.5 km have a stable time step of 0.096 s and all other cells have a
+            // stable time step of 0.385 s, so only the first column needs the fast rate with a 0.18 s time step. The
+            // default multirate method halves the time step at the fast rate, which is stable for the first column.
+            static const PylithReal dtSlow;
+            static const PylithReal xFast;
+            static const PylithReal lengthScale;
+            static const PylithReal timeScale;
+
+        }; // _TestTimeDependent
+        const PylithReal _TestTimeDependent::dtSlow = 0.18;
+        const PylithReal _TestTimeDependent::xFast = 0.5e+3;
+        const PylithReal _TestTimeDependent::lengthScale = 1.0e+3;
+        const PylithReal _TestTimeDependent::timeScale = 2.0;
+
+        // Observer that counts solution updates and saves the count in checkpoints.
+        class _TestTimeDependentObserver : public ObserverSoln {
+public:
+
+            _TestTimeDependentObserver(void) :
+                numUpdates(0) {}
+
+
+            void setTimeScale(const PylithReal value) {}
+
+            void verifyConfiguration(const pylith::topology::Field& solution) const {}
+
+            void update(const PylithReal t,
+                        const PylithInt tindex,
+                        const pylith::topology::Field& solution) {
+                ++numUpdates;
+            } // update
+
+            void getCheckpointState(std::map<std::string, PylithReal>* states,
+                                    const std::string& prefix) const {
+                CPPUNIT_ASSERT(states);
+                (*states)[prefix + "test_observer.num_updates"] = numUpdates;
+            } // getCheckpointState
+
+            void setCheckpointState(const std::map<std::string, PylithReal>& states,
+                                    const std::string& prefix) {
+                std::map<std::string, PylithReal>::const_iterator iter = states.find(prefix + "test_observer.num_updates");
+                if (iter != states.end()) {
+                    numUpdates = int(iter->second);
+                } // if
+            } // setCheckpointState
+
+            int numUpdates; ///< Number of solution updates.
+
+        }; // _TestTimeDependentObserver
+
+    } // problems
+} // pylith
+
+// ---------------------------------------------------------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION(pylith::problems::TestTimeDependent);
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::problems::TestTimeDependent::setUp(void) {
+    _problem = new TimeDependent();CPPUNIT_ASSERT(_problem);
+    _mesh = new pylith::topology::Mesh();CPPUNIT_ASSERT(_mesh);
+    _solution = NULL;
+    _material = new pylith::materials::Elasticity();CPPUNIT_ASSERT(_material);
+    _rheology = new pylith::materials::IsotropicLinearElasticity();CPPUNIT_ASSERT(_rheology);
+    _bc = new pylith::bc::DirichletUserFn();CPPUNIT_ASSERT(_bc);
+    _bcNeumann = NULL;
+    _observer = new _TestTimeDependentObserver();CPPUNIT_ASSERT(_observer);
+
+    _cs = new spatialdata::geocoords::CSCart();CPPUNIT_ASSERT(_cs);
+    _cs->setSpaceDim(2);
+
+    _normalizer = new spatialdata::units::Nondimensional();CPPUNIT_ASSERT(_normalizer);
+    _normalizer->setLengthScale(_TestTimeDependent::lengthScale);
+    _normalizer->setTimeScale(_TestTimeDependent::timeScale);
+    _normalizer->setPressureScale(2.25e+10);
+    _normalizer->computeDensityScale();
+
+    _matAuxDB = new spatialdata::spatialdb::UserFunctionDB();CPPUNIT_ASSERT(_matAuxDB);
+    _matAuxDB->setLabel("material auxiliary field spatial database");
+    _matAuxDB->addValue("density", _TestTimeDependent::density, _TestTimeDependent::density_units());
+    _matAuxDB->addValue("vp", _TestTimeDependent::vp, _TestTimeDependent::velocity_units());
+    _matAuxDB->addValue("vs", _TestTimeDependent::vs, _TestTimeDependent::velocity_units());
+    _matAuxDB->setCoordSys(*_cs);
+
+    _bcAuxDB = NULL;
+} // setUp
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::problems::TestTimeDependent::tearDown(void) {
+    delete _problem;_problem = NULL;
+    delete _observer;_observer = NULL;
+    delete _bc;_bc = NULL;
+    delete _bcNeumann;_bcNeumann = NULL;
+    delete _material;_material = NULL;
+    delete _rheology;_rheology = NULL;
+    delete _solution;_solution = NULL;
+    delete _mesh;_mesh = NULL;
+
+    delete _cs;_cs = NULL;
+    delete _normalizer;_normalizer = NULL;
+    delete _matAuxDB;_matAuxDB = NULL;
+    delete _bcAuxDB;_bcAuxDB = NULL;
+} // tearDown
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test binning of cells and degrees of freedom for multirate time stepping.
+void
+pylith::problems::TestTimeDependent::testMultirateBins(void) {
+    CPPUNIT_ASSERT(_problem);
+    _problem->setMultirate(true);
+    _problem->setInitialTimeStep(_TestTimeDependent::dtSlow);
+    _initialize(pylith::problems::Physics::DYNAMIC);
+
+    PetscErrorCode err = 0;
+    PetscTS ts = _problem->getPetscTS();CPPUNIT_ASSERT(ts);
+    PetscBool isMPRK = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject)ts, TSMPRK, &isMPRK);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_MESSAGE("Expected multirate time stepping (TSMPRK).", isMPRK);
+
+    // Cells in the first column are unstable with the slow time step, so cells with a vertex in the first column are
+    // in the fast bin and cells with a vertex outside the first column are in the slow bin.
+    const PylithReal xFast = _TestTimeDependent::xFast / _TestTimeDependent::lengthScale;
+    const PylithReal tolerance = 1.0e-6;
+    PetscDM dmSoln = _solution->dmMesh();CPPUNIT_ASSERT(dmSoln);
+    PetscVec coordsVec = NULL;
+    PetscSection coordsSection = NULL;
+    const PetscScalar* coordsArray = NULL;
+    err = DMGetCoordinatesLocal(dmSoln, &coordsVec);CPPUNIT_ASSERT(!err);
+    err = DMGetCoordinateSection(dmSoln, &coordsSection);CPPUNIT_ASSERT(!err);
+    err = VecGetArrayRead(coordsVec, &coordsArray);CPPUNIT_ASSERT(!err);
+
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmSoln, 0, &cStart, &cEnd);CPPUNIT_ASSERT(!err);
+    std::set<PetscInt> cellsSlowE;
+    std::set<PetscInt> cellsFastE;
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        err = DMPlexGetTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);CPPUNIT_ASSERT(!err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            PetscInt coordsDof = 0, coordsOff = 0;
+            err = PetscSectionGetDof(coordsSection, closure[2*iPoint], &coordsDof);CPPUNIT_ASSERT(!err);
+            if (!coordsDof) { continue; } // Not a vertex.
+            err = PetscSectionGetOffset(coordsSection, closure[2*iPoint], &coordsOff);CPPUNIT_ASSERT(!err);
+            if (PetscRealPart(coordsArray[coordsOff]) < xFast + tolerance) {
+                cellsFastE.insert(cell);
+            } else {
+                cellsSlowE.insert(cell);
+            } // if/else
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);CPPUNIT_ASSERT(!err);
+    } // for
+
+    pylith::feassemble::IntegratorDomain* integrator = _getIntegratorMaterial();CPPUNIT_ASSERT(integrator);
+    PetscIS cellsBinIS[2] = { integrator->_cellsSlowIS, integrator->_cellsFastIS };
+    const std::set<PetscInt>* cellsBinE[2] = { &cellsSlowE, &cellsFastE };
+    const char* binNames[2] = { "slow", "fast" };
+    for (int iBin = 0; iBin < 2; ++iBin) {
+        CPPUNIT_ASSERT(cellsBinIS[iBin]);
+        PetscInt numCells = 0;
+        const PetscInt* cells = NULL;
+        err = ISGetLocalSize(cellsBinIS[iBin], &numCells);CPPUNIT_ASSERT(!err);
+        err = ISGetIndices(cellsBinIS[iBin], &cells);CPPUNIT_ASSERT(!err);
+        const std::set<PetscInt> cellsBin(cells, cells+numCells);
+        err = ISRestoreIndices(cellsBinIS[iBin], &cells);CPPUNIT_ASSERT(!err);
+
+        std::ostringstream msg;
+        msg << "Mismatch in cells for " << binNames[iBin] << " bin.";
+        CPPUNIT_ASSERT_MESSAGE(msg.str(), *cellsBinE[iBin] == cellsBin);
+    } // for
+
+    // Degrees of freedom owned by this process are split into disjoint slow and fast bins by the vertex coordinates.
+    PetscSection globalSection = _solution->globalSection();CPPUNIT_ASSERT(globalSection);
+    PetscInt vStart = 0, vEnd = 0;
+    err = DMPlexGetDepthStratum(dmSoln, 0, &vStart, &vEnd);CPPUNIT_ASSERT(!err);
+    std::set<PetscInt> indicesSlowE;
+    std::set<PetscInt> indicesFastE;
+    for (PetscInt vertex = vStart; vertex < vEnd; ++vertex) {
+        PetscInt dof = 0, cdof = 0, off = 0, coordsOff = 0;
+        err = PetscSectionGetDof(globalSection, vertex, &dof);CPPUNIT_ASSERT(!err);
+        if (dof <= 0) { continue; } // Not owned by this process.
+        err = PetscSectionGetConstraintDof(globalSection, vertex, &cdof);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetOffset(globalSection, vertex, &off);CPPUNIT_ASSERT(!err);
+        err = PetscSectionGetOffset(coordsSection, vertex, &coordsOff);CPPUNIT_ASSERT(!err);
+        const bool isFast = PetscRealPart(coordsArray[coordsOff]) < xFast + tolerance;
+        for (PetscInt iDof = 0; iDof < dof-cdof; ++iDof) {
+            (isFast ? indicesFastE : indicesSlowE).insert(off+iDof);
+        } // for
+    } // for
+    err = VecRestoreArrayRead(coordsVec, &coordsArray);CPPUNIT_ASSERT(!err);
+
+    const std::set<PetscInt>* indicesBinE[2] = { &indicesSlowE, &indicesFastE };
+    PetscInt numIndices = 0;
+    for (int iBin = 0; iBin < 2; ++iBin) {
+        PetscIS binIS = NULL;
+        err = TSRHSSplitGetIS(ts, binNames[iBin], &binIS);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT(binIS);
+        PetscInt numIndicesBin = 0;
+        const PetscInt* indices = NULL;
+        err = ISGetLocalSize(binIS, &numIndicesBin);CPPUNIT_ASSERT(!err);
+        err = ISGetIndices(binIS, &indices);CPPUNIT_ASSERT(!err);
+        const std::set<PetscInt> indicesBin(indices, indices+numIndicesBin);
+        err = ISRestoreIndices(binIS, &indices);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("Duplicate indices in split.", size_t(numIndicesBin), indicesBin.size());
+        numIndices += numIndicesBin;
+
+        std::ostringstream msg;
+        msg << "Mismatch in degrees of freedom for " << binNames[iBin] << " split.";
+        CPPUNIT_ASSERT_MESSAGE(msg.str(), *indicesBinE[iBin] == indicesBin);
+    } // for
+    CPPUNIT_ASSERT_MESSAGE("Expected degrees of freedom in fast split.", indicesFastE.size() > 0);
+    CPPUNIT_ASSERT_MESSAGE("Expected degrees of freedom in slow split.", indicesSlowE.size() > 0);
+
+    // Splits cover all degrees of freedom owned by this process.
+    PetscInt numIndicesE = 0;
+    err = VecGetLocalSize(_solution->globalVector(), &numIndicesE);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(numIndicesE, numIndices);
+} // testMultirateBins
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test cached geometry for multirate bins stays within the memory budget.
+void
+pylith::problems::TestTimeDependent::testMultirateGeometryBudget(void) {
+    CPPUNIT_ASSERT(_problem);
+    _problem->setMultirate(true);
+    _problem->setInitialTimeStep(_TestTimeDependent::dtSlow);
+    _initialize(pylith::problems::Physics::DYNAMIC);
+
+    pylith::feassemble::IntegratorDomain* integrator = _getIntegratorMaterial();CPPUNIT_ASSERT(integrator);
+    CPPUNIT_ASSERT(integrator->_cellsIS);
+    CPPUNIT_ASSERT(integrator->_cellsSlowIS);
+    CPPUNIT_ASSERT(integrator->_cellsFastIS);
+
+    PetscErrorCode err = 0;
+    PetscInt numCells = 0, numCellsSlow = 0, numCellsFast = 0;
+    err = ISGetLocalSize(integrator->_cellsIS, &numCells);CPPUNIT_ASSERT(!err);
+    err = ISGetLocalSize(integrator->_cellsSlowIS, &numCellsSlow);CPPUNIT_ASSERT(!err);
+    err = ISGetLocalSize(integrator->_cellsFastIS, &numCellsFast);CPPUNIT_ASSERT(!err);
+    const size_t cellSize = integrator->_geometryCacheCellSize;
+    CPPUNIT_ASSERT(cellSize > 0);
+    const size_t cacheSize = numCells * cellSize;
+    const size_t cacheSizeMultirate = (numCellsSlow + numCellsFast) * cellSize;
+
+    // Default budget holds the geometry for all cells and both bins.
+    CPPUNIT_ASSERT(integrator->_cacheGeometry);
+    CPPUNIT_ASSERT(integrator->_cacheGeometryMultirate);
+    CPPUNIT_ASSERT_EQUAL(cacheSize + cacheSizeMultirate, integrator->getGeometryCacheSize());
+    const size_t budget = size_t(_problem->getGeometryCacheBudget() * 1024.0 * 1024.0);
+    CPPUNIT_ASSERT_EQUAL(budget - integrator->getGeometryCacheSize(), _problem->_getGeometryCacheAvailable());
+
+    // Rebin with the same fast points as the problem.
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(_solution->dmMesh(), &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    pylith::int_array fastPoints(PylithInt(0), pEnd - pStart);
+    const PylithReal dt = _TestTimeDependent::dtSlow / _TestTimeDependent::timeScale;
+    integrator->markMultirateFastPoints(&fastPoints, dt, *_solution);
+
+    // Budget holds only the geometry for all cells, so geometry for the bins is recomputed.
+    integrator->setGeometryCacheBudget(cacheSize + cacheSizeMultirate - 1);
+    integrator->setMultirateFastPoints(fastPoints, *_solution);
+    CPPUNIT_ASSERT(integrator->_cacheGeometry);
+    CPPUNIT_ASSERT(!integrator->_cacheGeometryMultirate);
+    CPPUNIT_ASSERT_EQUAL(cacheSize, integrator->getGeometryCacheSize());
+
+    // Budget holds the geometry for the bins again; rebinning does not charge the bins twice.
+    integrator->setGeometryCacheBudget(cacheSize + cacheSizeMultirate);
+    integrator->setMultirateFastPoints(fastPoints, *_solution);
+    integrator->setMultirateFastPoints(fastPoints, *_solution);
+    CPPUNIT_ASSERT(integrator->_cacheGeometryMultirate);
+    CPPUNIT_ASSERT_EQUAL(cacheSize + cacheSizeMultirate, integrator->getGeometryCacheSize());
+
+    // Problem with a budget that holds only the geometry for all cells recomputes geometry for the bins.
+    tearDown();
+    setUp();
+    _problem->setMultirate(true);
+    _problem->setInitialTimeStep(_TestTimeDependent::dtSlow);
+    _problem->setGeometryCacheBudget((PylithReal(cacheSize) + 0.5) / (1024.0 * 1024.0));
+    _initialize(pylith::problems::Physics::DYNAMIC);
+
+    integrator = _getIntegratorMaterial();CPPUNIT_ASSERT(integrator);
+    CPPUNIT_ASSERT(integrator->_cacheGeometry);
+    CPPUNIT_ASSERT(!integrator->_cacheGeometryMultirate);
+    CPPUNIT_ASSERT(integrator->getGeometryCacheSize() <= cacheSize);
+} // testMultirateGeometryBudget
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test multirate time stepping rejects a fast rate that is unstable for the fast cells.
+void
+pylith::problems::TestTimeDependent::testMultirateUnstable(void) {
+    CPPUNIT_ASSERT(_problem);
+    _problem->setMultirate(true);
+
+    // Same cells are in the fast bin, but half of the time step exceeds the stable time step of the first column.
+    const PylithReal dt = 0.25;
+    _problem->setInitialTimeStep(dt);
+    CPPUNIT_ASSERT_THROW(_initialize(pylith::problems::Physics::DYNAMIC), std::runtime_error);
+    CPPUNIT_ASSERT(_problem->_dtStableMultirate > 0.0);
+    CPPUNIT_ASSERT(0.5*dt/_TestTimeDependent::timeScale > _problem->_dtStableMultirate);
+    CPPUNIT_ASSERT(0.5*_TestTimeDependent::dtSlow/_TestTimeDependent::timeScale <= _problem->_dtStableMultirate);
+} // testMultirateUnstable
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test residual assembled with interior and halo cells split matches residual assembled from all cells.
+void
+pylith::problems::TestTimeDependent::testHaloOverlapResidual(void) {
+    CPPUNIT_ASSERT(_problem);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+    CPPUNIT_ASSERT(!_problem->_overlapHaloExchange);
+
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL;
+    PetscVec solutionDotVec = NULL;
+    PetscVec residualVec = NULL;
+    PetscVec residualOverlapVec = NULL;
+    PetscRandom random = NULL;
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &residualVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &residualOverlapVec);CPPUNIT_ASSERT(!err);
+    err = PetscRandomCreate(_mesh->comm(), &random);CPPUNIT_ASSERT(!err);
+    err = VecSetRandom(solutionVec, random);CPPUNIT_ASSERT(!err);
+    err = PetscRandomDestroy(&random);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionDotVec, 0.0);CPPUNIT_ASSERT(!err);
+
+    const PylithReal t = 0.0;
+    const PylithReal dt = 0.05;
+    _problem->computeLHSResidual(residualVec, t, dt, solutionVec, solutionDotVec);
+
+    // Treat points in the closure of cells with a vertex at x >= +4.5 km as shared with another process, so the
+    // split can be exercised on a single process.
+    const PylithReal xShared = 4.5e+3 / _TestTimeDependent::lengthScale;
+    const PylithReal tolerance = 1.0e-6;
+    PetscDM dmSoln = _solution->dmMesh();CPPUNIT_ASSERT(dmSoln);
+    PetscInt pStart = 0, pEnd = 0;
+    err = DMPlexGetChart(dmSoln, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+    PetscVec coordsVec = NULL;
+    PetscSection coordsSection = NULL;
+    const PetscScalar* coordsArray = NULL;
+    err = DMGetCoordinatesLocal(dmSoln, &coordsVec);CPPUNIT_ASSERT(!err);
+    err = DMGetCoordinateSection(dmSoln, &coordsSection);CPPUNIT_ASSERT(!err);
+    err = VecGetArrayRead(coordsVec, &coordsArray);CPPUNIT_ASSERT(!err);
+    pylith::int_array sharedPoints(PylithInt(0), pEnd - pStart);
+    PetscInt cStart = 0, cEnd = 0;
+    err = DMPlexGetHeightStratum(dmSoln, 0, &cStart, &cEnd);CPPUNIT_ASSERT(!err);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+        PetscInt* closure = NULL;
+        PetscInt closureSize = 0;
+        bool isShared = false;
+        err = DMPlexGetTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);CPPUNIT_ASSERT(!err);
+        for (PetscInt iPoint = 0; iPoint < closureSize; ++iPoint) {
+            PetscInt coordsDof = 0, coordsOff = 0;
+            err = PetscSectionGetDof(coordsSection, closure[2*iPoint], &coordsDof);CPPUNIT_ASSERT(!err);
+            if (!coordsDof) { continue; } // Not a vertex.
+            err = PetscSectionGetOffset(coordsSection, closure[2*iPoint], &coordsOff);CPPUNIT_ASSERT(!err);
+            isShared = isShared || PetscRealPart(coordsArray[coordsOff]) > xShared - tolerance;
+        } // for
+        for (PetscInt iPoint = 0; isShared && iPoint < closureSize; ++iPoint) {
+            sharedPoints[closure[2*iPoint]-pStart] = 1;
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmSoln, cell, PETSC_TRUE, &closureSize, &closure);CPPUNIT_ASSERT(!err);
+    } // for
+    err = VecRestoreArrayRead(coordsVec, &coordsArray);CPPUNIT_ASSERT(!err);
+
+    // Budget holds only the geometry for all cells, so geometry for the split is recomputed.
+    pylith::feassemble::IntegratorDomain* integrator = _getIntegratorMaterial();CPPUNIT_ASSERT(integrator);
+    const size_t cacheSize = integrator->getGeometryCacheSize();
+    CPPUNIT_ASSERT(integrator->_cacheGeometry);
+    _problem->setGeometryCacheBudget((PylithReal(cacheSize) + 0.5) / (1024.0 * 1024.0));
+    _problem->_setHaloSharedPoints(sharedPoints);
+    _problem->_overlapHaloExchange = true;
+    CPPUNIT_ASSERT(integrator->hasHaloInteriorCells());
+    CPPUNIT_ASSERT(!integrator->_cacheGeometryHalo);
+    CPPUNIT_ASSERT_EQUAL(cacheSize, integrator->getGeometryCacheSize());
+
+    PetscInt numCellsBoundary = 0, numCellsInterior = 0;
+    err = ISGetLocalSize(integrator->_cellsHaloBoundaryIS, &numCellsBoundary);CPPUNIT_ASSERT(!err);
+    err = ISGetLocalSize(integrator->_cellsHaloInteriorIS, &numCellsInterior);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_MESSAGE("Expected cells with shared points.", numCellsBoundary > 0);
+    CPPUNIT_ASSERT_MESSAGE("Expected cells without shared points.", numCellsInterior > 0);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(_mesh->numCells()), numCellsBoundary + numCellsInterior);
+
+    // Residual is the same whether or not the geometry for the split is cached.
+    PylithReal residualNorm = 0.0;
+    PylithReal differenceNorm = 0.0;
+    err = VecNorm(residualVec, NORM_2, &residualNorm);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_MESSAGE("Residual is zero.", residualNorm > 0.0);
+    const PylithReal toleranceResidual = 1.0e-10;
+    for (int iPass = 0; iPass < 2; ++iPass) {
+        if (1 == iPass) {
+            _problem->setGeometryCacheBudget(512.0);
+            _problem->_setHaloSharedPoints(sharedPoints);
+            CPPUNIT_ASSERT(integrator->_cacheGeometryHalo);
+            CPPUNIT_ASSERT(integrator->getGeometryCacheSize() > cacheSize);
+        } // if
+        _problem->computeLHSResidual(residualOverlapVec, t, dt, solutionVec, solutionDotVec);
+        err = VecAXPY(residualOverlapVec, -1.0, residualVec);CPPUNIT_ASSERT(!err);
+        err = VecNorm(residualOverlapVec, NORM_2, &differenceNorm);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Residual with overlapped halo exchange differs from residual.",
+                                             0.0, differenceNorm/residualNorm, toleranceResidual);
+    } // for
+
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&residualVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&residualOverlapVec);CPPUNIT_ASSERT(!err);
+} // testHaloOverlapResidual
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test restarting from checkpoint recovers solution, auxiliary field, time stepping, and observer state.
+void
+pylith::problems::TestTimeDependent::testCheckpointRestart(void) {
+    const char* filename = "timedependent_checkpoint.h5";
+
+    CPPUNIT_ASSERT(_problem);
+    _problem->setCheckpointFilename(filename);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+
+    // Move the problem away from its initial state.
+    PetscErrorCode err = 0;
+    const PylithReal timeE = 0.3;
+    const PylithReal dtE = 0.05;
+    const PylithInt stepE = 7;
+    const int numUpdatesE = 5;
+    PetscTS ts = _problem->getPetscTS();CPPUNIT_ASSERT(ts);
+    err = TSSetTime(ts, timeE);CPPUNIT_ASSERT(!err);
+    err = TSSetTimeStep(ts, dtE);CPPUNIT_ASSERT(!err);
+    err = TSSetStepNumber(ts, stepE);CPPUNIT_ASSERT(!err);
+
+    PetscVec solutionVec = NULL;
+    PetscRandom random = NULL;
+    err = TSGetSolution(ts, &solutionVec);CPPUNIT_ASSERT(!err);
+    err = PetscRandomCreate(_mesh->comm(), &random);CPPUNIT_ASSERT(!err);
+    err = VecSetRandom(solutionVec, random);CPPUNIT_ASSERT(!err);
+    err = PetscRandomDestroy(&random);CPPUNIT_ASSERT(!err);
+
+    // Auxiliary field holds the state variables, so changing it stands in for updating state variables.
+    pylith::feassemble::IntegratorDomain* integrator = _getIntegratorMaterial();CPPUNIT_ASSERT(integrator);
+    const pylith::topology::Field* auxField = integrator->getAuxiliaryField();CPPUNIT_ASSERT(auxField);
+    err = VecScale(auxField->localVector(), 1.5);CPPUNIT_ASSERT(!err);
+
+    _observer->numUpdates = numUpdatesE;
+
+    _problem->checkpoint();
+
+    PetscVec solutionE = NULL;
+    PetscVec auxiliaryE = NULL;
+    err = VecDuplicate(solutionVec, &solutionE);CPPUNIT_ASSERT(!err);
+    err = VecCopy(solutionVec, solutionE);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(auxField->localVector(), &auxiliaryE);CPPUNIT_ASSERT(!err);
+    err = VecCopy(auxField->localVector(), auxiliaryE);CPPUNIT_ASSERT(!err);
+
+    // Restart new problem from checkpoint. Without a material spatial database, querying it would throw.
+    tearDown();
+    setUp();
+    delete _matAuxDB;_matAuxDB = NULL;
+    _problem->setCheckpointFilename(filename);
+    _problem->setRestart(true);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+
+    ts = _problem->getPetscTS();CPPUNIT_ASSERT(ts);
+    PylithReal time = 0.0;
+    PylithReal dt = 0.0;
+    PylithInt step = 0;
+    err = TSGetTime(ts, &time);CPPUNIT_ASSERT(!err);
+    err = TSGetTimeStep(ts, &dt);CPPUNIT_ASSERT(!err);
+    err = TSGetStepNumber(ts, &step);CPPUNIT_ASSERT(!err);
+    const PylithReal tolerance = 1.0e-10;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Mismatch in time.", timeE, time, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Mismatch in time step.", dtE, dt, tolerance);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in time step number.", stepE, step);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Mismatch in observer state.", numUpdatesE, _observer->numUpdates);
+
+    PylithReal norm = 0.0;
+    PylithReal normE = 0.0;
+    err = TSGetSolution(ts, &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecNorm(solutionE, NORM_INFINITY, &normE);CPPUNIT_ASSERT(!err);
+    err = VecAXPY(solutionE, -1.0, solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecNorm(solutionE, NORM_INFINITY, &norm);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(normE > 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Mismatch in solution.", 0.0, norm/normE, tolerance);
+
+    integrator = _getIntegratorMaterial();CPPUNIT_ASSERT(integrator);
+    auxField = integrator->getAuxiliaryField();CPPUNIT_ASSERT(auxField);
+    err = VecNorm(auxiliaryE, NORM_INFINITY, &normE);CPPUNIT_ASSERT(!err);
+    err = VecAXPY(auxiliaryE, -1.0, auxField->localVector());CPPUNIT_ASSERT(!err);
+    err = VecNorm(auxiliaryE, NORM_INFINITY, &norm);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(normE > 0.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Mismatch in auxiliary field.", 0.0, norm/normE, tolerance);
+
+    err = VecDestroy(&solutionE);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&auxiliaryE);CPPUNIT_ASSERT(!err);
+
+    if (!_mesh->commRank()) {
+        std::remove(filename);
+    } // if
+} // testCheckpointRestart
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test LHS Jacobian combined from K and M matches LHS Jacobian assembled from all integrators.
+void
+pylith::problems::TestTimeDependent::testJacobianSplit(void) {
+    CPPUNIT_ASSERT(_problem);
+    _initialize(pylith::problems::Physics::DYNAMIC_IMEX);
+    CPPUNIT_ASSERT_MESSAGE("Expected LHS Jacobian split into K and M.", _problem->_useJacobianSplit);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = _solution->dmMesh();CPPUNIT_ASSERT(dmSoln);
+    PetscVec solutionVec = NULL;
+    PetscVec solutionDotVec = NULL;
+    PetscRandom random = NULL;
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = PetscRandomCreate(_mesh->comm(), &random);CPPUNIT_ASSERT(!err);
+    err = VecSetRandom(solutionVec, random);CPPUNIT_ASSERT(!err);
+    err = PetscRandomDestroy(&random);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionDotVec, 0.0);CPPUNIT_ASSERT(!err);
+
+    PetscMat jacobianMat = NULL;
+    PetscMat jacobianE = NULL;
+    err = DMCreateMatrix(dmSoln, &jacobianMat);CPPUNIT_ASSERT(!err);
+    err = DMCreateMatrix(dmSoln, &jacobianE);CPPUNIT_ASSERT(!err);
+
+    // First time step assembles K and M; second time step only changes s_tshift, so J is combined from K and M.
+    const PylithReal t = 0.0;
+    const PylithReal dt[2] = { 0.1, 0.04 };
+    const PylithReal tolerance = 1.0e-10;
+    for (int iStep = 0; iStep < 2; ++iStep) {
+        const PylithReal s_tshift = 1.0 / dt[iStep];
+        _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dt[iStep], s_tshift, solutionVec, solutionDotVec);
+        err = MatAssemblyBegin(jacobianMat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+        err = MatAssemblyEnd(jacobianMat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(1 == iStep, _problem->_haveShiftOnlyLHSJacobian);
+
+        err = MatZeroEntries(jacobianE);CPPUNIT_ASSERT(!err);
+        for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+            _problem->_integrators[i]->computeLHSJacobian(jacobianE, jacobianE, t, dt[iStep], s_tshift, *_solution,
+                                                          *_problem->_solutionDot);
+        } // for
+        err = MatAssemblyBegin(jacobianE, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+        err = MatAssemblyEnd(jacobianE, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+        PylithReal normE = 0.0;
+        PylithReal norm = 0.0;
+        err = MatNorm(jacobianE, NORM_FROBENIUS, &normE);CPPUNIT_ASSERT(!err);
+        err = MatAXPY(jacobianE, -1.0, jacobianMat, DIFFERENT_NONZERO_PATTERN);CPPUNIT_ASSERT(!err);
+        err = MatNorm(jacobianE, NORM_FROBENIUS, &norm);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT(normE > 0.0);
+
+        std::ostringstream msg;
+        msg << "LHS Jacobian combined from K and M does not match assembled LHS Jacobian for dt=" << dt[iStep] << ".";
+        CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE(msg.str(), 0.0, norm/normE, tolerance);
+    } // for
+
+    err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+    err = MatDestroy(&jacobianE);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionDotVec);CPPUNIT_ASSERT(!err);
+} // testJacobianSplit
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test linear quasistatic elasticity declares Jacobian linear in s_tshift without turning on the split.
+void
+pylith::problems::TestTimeDependent::testJacobianSplitQuasistatic(void) {
+    CPPUNIT_ASSERT(_problem);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+
+    pylith::feassemble::IntegratorDomain* integrator = _getIntegratorMaterial();CPPUNIT_ASSERT(integrator);
+    CPPUNIT_ASSERT(integrator->isLHSJacobianLinearInShift());
+    CPPUNIT_ASSERT(!(integrator->getLHSJacobianTriggers() & pylith::feassemble::Integrator::NEW_JACOBIAN_TIME_STEP_CHANGE));
+    CPPUNIT_ASSERT_MESSAGE("LHS Jacobian independent of time step should not be split into K and M.",
+                           !_problem->_useJacobianSplit);
+} // testJacobianSplitQuasistatic
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test blocked sparse matrices are used when every point holds one unconstrained or fully constrained block.
+void
+pylith::problems::TestTimeDependent::testMatrixTypeBlocked(void) {
+    CPPUNIT_ASSERT(_problem);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+
+    // Displacement only; boundary vertices have both components constrained.
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = _solution->dmMesh();CPPUNIT_ASSERT(dmSoln);
+    MatType matType = NULL;
+    err = DMGetMatType(dmSoln, &matType);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(matType);
+    CPPUNIT_ASSERT_EQUAL(std::string(MATBAIJ), std::string(matType));
+
+    PetscMat jacobianMat = NULL;
+    PetscInt blockSize = 0;
+    err = DMCreateMatrix(dmSoln, &jacobianMat);CPPUNIT_ASSERT(!err);
+    err = MatGetBlockSize(jacobianMat, &blockSize);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(2), blockSize);
+    err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+} // testMatrixTypeBlocked
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test default sparse matrices are used when points hold more than one block.
+void
+pylith::problems::TestTimeDependent::testMatrixTypeFallback(void) {
+    CPPUNIT_ASSERT(_problem);
+    _initialize(pylith::problems::Physics::DYNAMIC_IMEX);
+
+    // Displacement and velocity at each vertex, so each vertex holds two blocks.
+    PetscErrorCode err = 0;
+    MatType matType = NULL;
+    err = DMGetMatType(_solution->dmMesh(), &matType);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(matType);
+    CPPUNIT_ASSERT(std::string(MATBAIJ) != std::string(matType));
+    CPPUNIT_ASSERT_EQUAL(std::string(MATAIJ), std::string(matType));
+} // testMatrixTypeFallback
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test matrix type set by the user is not overridden.
+void
+pylith::problems::TestTimeDependent::testMatrixTypeUser(void) {
+    CPPUNIT_ASSERT(_problem);
+
+    PetscErrorCode err = 0;
+    err = PetscOptionsSetValue(NULL, "-dm_mat_type", MATAIJ);CPPUNIT_ASSERT(!err);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+    err = PetscOptionsClearValue(NULL, "-dm_mat_type");CPPUNIT_ASSERT(!err);
+
+    MatType matType = NULL;
+    err = DMGetMatType(_solution->dmMesh(), &matType);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(matType);
+    CPPUNIT_ASSERT_EQUAL(std::string(MATAIJ), std::string(matType));
+} // testMatrixTypeUser
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test registration and counts of events for domain, boundary, and constraint implementations of physics.
+void
+pylith::problems::TestTimeDependent::testPhysicsEvents(void) {
+    CPPUNIT_ASSERT(_problem);
+
+    _bcAuxDB = new spatialdata::spatialdb::UserFunctionDB();CPPUNIT_ASSERT(_bcAuxDB);
+    _bcAuxDB->setLabel("Neumann auxiliary field spatial database");
+    _bcAuxDB->addValue("initial_amplitude_tangential", _TestTimeDependent::traction, _TestTimeDependent::traction_units());
+    _bcAuxDB->addValue("initial_amplitude_normal", _TestTimeDependent::traction, _TestTimeDependent::traction_units());
+    _bcAuxDB->setCoordSys(*_cs);
+
+    _bcNeumann = new pylith::bc::NeumannTimeDependent();CPPUNIT_ASSERT(_bcNeumann);
+    _bcNeumann->setMarkerLabel("boundary");
+    _bcNeumann->setSubfieldName("displacement");
+    _bcNeumann->setScaleName("pressure");
+    _bcNeumann->useInitial(true);
+    _bcNeumann->setAuxiliaryFieldDB(_bcAuxDB);
+
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL;
+    PetscVec solutionDotVec = NULL;
+    PetscVec residualVec = NULL;
+    PetscMat jacobianMat = NULL;
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &residualVec);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionVec, 0.0);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionDotVec, 0.0);CPPUNIT_ASSERT(!err);
+    err = DMCreateMatrix(_solution->dmMesh(), &jacobianMat);CPPUNIT_ASSERT(!err);
+
+    const PylithReal t = 0.0;
+    const PylithReal dt = _TestTimeDependent::dtSlow / _TestTimeDependent::timeScale;
+    _problem->computeRHSResidual(residualVec, t, dt, solutionVec);
+    _problem->computeLHSResidual(residualVec, t, dt, solutionVec, solutionDotVec);
+    _problem->computeLHSJacobian(jacobianMat, jacobianMat, t, dt, 1.0/dt, solutionVec, solutionDotVec);
+
+    typedef pylith::feassemble::PhysicsImplementation PhysicsImplementation;
+    std::vector<const PhysicsImplementation*> implementations(_problem->_integrators.begin(), _problem->_integrators.end());
+    implementations.insert(implementations.end(), _problem->_constraints.begin(), _problem->_constraints.end());
+    for (size_t i = 0; i < implementations.size(); ++i) {
+        CPPUNIT_ASSERT(implementations[i]);
+        for (int iEvent = 0; iEvent < PhysicsImplementation::NUM_EVENTS; ++iEvent) {
+            const PhysicsImplementation::EventEnum event = PhysicsImplementation::EventEnum(iEvent);
+            const std::string eventName = std::string("Py-") + implementations[i]->getPhysicsIdentifier() + "-" +
+                                          PhysicsImplementation::getEventName(event);
+            PetscLogEvent eventId = -1;
+            err = PetscLogEventGetId(eventName.c_str(), &eventId);CPPUNIT_ASSERT(!err);
+            CPPUNIT_ASSERT_MESSAGE("Event '" + eventName + "' not registered.", eventId >= 0);
+            CPPUNIT_ASSERT(implementations[i]->getEventTime(event) >= 0.0);
+        } // for
+    } // for
+
+    size_t numDomain = 0;
+    size_t numBoundary = 0;
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        const pylith::feassemble::Integrator* integrator = _problem->_integrators[i];
+        size_t numLHSJacobianE = 0;
+        if (dynamic_cast<const pylith::feassemble::IntegratorDomain*>(integrator)) {
+            ++numDomain;
+            numLHSJacobianE = 1;
+        } else if (dynamic_cast<const pylith::feassemble::IntegratorBoundary*>(integrator)) {
+            ++numBoundary;
+            numLHSJacobianE = 0; // Boundary integrators have no Jacobian kernels.
+        } // if/else
+
+        // Each residual has kernels in either the RHS or LHS.
+        const size_t numRHSResidual = integrator->getEventCount(PhysicsImplementation::EVENT_COMPUTE_RHS_RESIDUAL);
+        const size_t numLHSResidual = integrator->getEventCount(PhysicsImplementation::EVENT_COMPUTE_LHS_RESIDUAL);
+        CPPUNIT_ASSERT(numRHSResidual <= 1);
+        CPPUNIT_ASSERT(numLHSResidual <= 1);
+        CPPUNIT_ASSERT_EQUAL(size_t(1), numRHSResidual + numLHSResidual);
+        CPPUNIT_ASSERT_EQUAL(numLHSJacobianE, integrator->getEventCount(PhysicsImplementation::EVENT_COMPUTE_LHS_JACOBIAN));
+    } // for
+    CPPUNIT_ASSERT_EQUAL(size_t(1), numDomain);
+    CPPUNIT_ASSERT_EQUAL(size_t(1), numBoundary);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(1), _problem->_constraints.size());
+    CPPUNIT_ASSERT(_problem->_constraints[0]->getEventCount(PhysicsImplementation::EVENT_SET_SOLUTION) >= 1);
+
+    _problem->logPerformanceSummary();
+
+    err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&residualVec);CPPUNIT_ASSERT(!err);
+} // testPhysicsEvents
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test quadratic predictor extrapolates previous solutions exactly for a quadratic polynomial.
+void
+pylith::problems::TestTimeDependent::testPredictorQuadratic(void) {
+    CPPUNIT_ASSERT(_problem);
+    _problem->setPredictor(TimeDependent::PREDICTOR_QUADRATIC);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+    CPPUNIT_ASSERT_EQUAL(TimeDependent::PREDICTOR_QUADRATIC, _problem->getPredictor());
+
+    // Initial solution is saved by initialize().
+    CPPUNIT_ASSERT_EQUAL(size_t(1), _problem->_predictorSolutions.size());
+
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL;
+    PetscVec predictedVec = NULL;
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &predictedVec);CPPUNIT_ASSERT(!err);
+
+    // Solution values follow u(t) = 1 + 2*t - 0.5*t**2.
+    const int numSteps = 3;
+    const PylithReal times[numSteps] = { 1.0, 2.0, 3.0 };
+    const PylithReal dt = 0.5;
+    const PylithReal tPredict = times[numSteps-1] + dt;
+    const PylithReal tolerance = 1.0e-10;
+    for (int i = 0; i < numSteps; ++i) {
+        const PylithReal t = times[i];
+        err = VecSet(solutionVec, 1.0 + 2.0*t - 0.5*t*t);CPPUNIT_ASSERT(!err);
+        _problem->_savePredictorSolution(t, solutionVec);
+    } // for
+
+    // Saving a solution at a time already in the history does nothing.
+    err = VecSet(solutionVec, 1.0e+6);CPPUNIT_ASSERT(!err);
+    _problem->_savePredictorSolution(times[numSteps-1], solutionVec);
+
+    // Quadratic predictor keeps 3 most recent solutions, reusing the vector of the dropped initial solution.
+    CPPUNIT_ASSERT_EQUAL(size_t(3), _problem->_predictorSolutions.size());
+    CPPUNIT_ASSERT_EQUAL(size_t(3), _problem->_predictorTimes.size());
+    for (int i = 0; i < numSteps; ++i) {
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(times[i], _problem->_predictorTimes[i], tolerance);
+    } // for
+
+    err = TSSetTime(_problem->_ts, times[numSteps-1]);CPPUNIT_ASSERT(!err);
+    err = TSSetTimeStep(_problem->_ts, dt);CPPUNIT_ASSERT(!err);
+
+    _problem->_predictSolution(predictedVec);
+    const PylithReal valueE = 1.0 + 2.0*tPredict - 0.5*tPredict*tPredict;
+    PylithReal valueMin = 0.0, valueMax = 0.0;
+    err = VecMin(predictedVec, NULL, &valueMin);CPPUNIT_ASSERT(!err);
+    err = VecMax(predictedVec, NULL, &valueMax);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, valueMin, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, valueMax, tolerance);
+
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&predictedVec);CPPUNIT_ASSERT(!err);
+} // testPredictorQuadratic
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test linear predictor extrapolates the two most recent solutions.
+void
+pylith::problems::TestTimeDependent::testPredictorLinear(void) {
+    CPPUNIT_ASSERT(_problem);
+    _problem->setPredictor(TimeDependent::PREDICTOR_LINEAR);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+    CPPUNIT_ASSERT_EQUAL(TimeDependent::PREDICTOR_LINEAR, _problem->getPredictor());
+
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL;
+    PetscVec predictedVec = NULL;
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &predictedVec);CPPUNIT_ASSERT(!err);
+
+    // Solution at t=1 is far off the line u(t) = 1 + 2*t; linear predictor keeps only the 2 most recent solutions.
+    const int numSteps = 3;
+    const PylithReal times[numSteps] = { 1.0, 2.0, 3.0 };
+    const PylithReal values[numSteps] = { -100.0, 5.0, 7.0 };
+    const PylithReal dt = 0.5;
+    const PylithReal tolerance = 1.0e-10;
+    for (int i = 0; i < numSteps; ++i) {
+        err = VecSet(solutionVec, values[i]);CPPUNIT_ASSERT(!err);
+        _problem->_savePredictorSolution(times[i], solutionVec);
+    } // for
+    CPPUNIT_ASSERT_EQUAL(size_t(2), _problem->_predictorSolutions.size());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(times[1], _problem->_predictorTimes.front(), tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(times[2], _problem->_predictorTimes.back(), tolerance);
+
+    err = TSSetTime(_problem->_ts, times[numSteps-1]);CPPUNIT_ASSERT(!err);
+    err = TSSetTimeStep(_problem->_ts, dt);CPPUNIT_ASSERT(!err);
+    _problem->_predictSolution(predictedVec);
+
+    const PylithReal valueE = 1.0 + 2.0*(times[numSteps-1] + dt);
+    PylithReal valueMin = 0.0, valueMax = 0.0;
+    err = VecMin(predictedVec, NULL, &valueMin);CPPUNIT_ASSERT(!err);
+    err = VecMax(predictedVec, NULL, &valueMax);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, valueMin, tolerance);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, valueMax, tolerance);
+
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&predictedVec);CPPUNIT_ASSERT(!err);
+} // testPredictorLinear
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test predictor is disabled for formulations other than quasistatic.
+void
+pylith::problems::TestTimeDependent::testPredictorGuard(void) {
+    CPPUNIT_ASSERT(_problem);
+    _problem->setPredictor(TimeDependent::PREDICTOR_LINEAR);
+    _initialize(pylith::problems::Physics::DYNAMIC);
+
+    CPPUNIT_ASSERT_EQUAL(TimeDependent::PREDICTOR_NONE, _problem->getPredictor());
+    CPPUNIT_ASSERT_EQUAL(size_t(0), _problem->_predictorSolutions.size());
+
+    // Without history the initial guess is left unchanged.
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL;
+    PylithReal norm = 0.0;
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionVec, 2.0);CPPUNIT_ASSERT(!err);
+    _problem->_predictSolution(solutionVec);
+    err = VecNorm(solutionVec, NORM_INFINITY, &norm);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, norm, 1.0e-10);
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+} // testPredictorGuard
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test preconditioner is rebuilt only for a reformed LHS Jacobian or when requested by the iteration check.
+void
+pylith::problems::TestTimeDependent::testPreconditionerReuse(void) {
+    CPPUNIT_ASSERT(_problem);
+    _problem->setReusePreconditioner(true);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+    CPPUNIT_ASSERT(_problem->getReusePreconditioner());
+
+    PetscErrorCode err = 0;
+    PetscSNES snes = NULL;
+    PetscKSP ksp = NULL;
+    err = TSGetSNES(_problem->_ts, &snes);CPPUNIT_ASSERT(!err);
+    err = SNESGetKSP(snes, &ksp);CPPUNIT_ASSERT(!err);
+
+    PetscMat precondMat = NULL;
+    err = DMCreateMatrix(_solution->dmMesh(), &precondMat);CPPUNIT_ASSERT(!err);
+
+    const struct {
+        bool haveNewLHSJacobian;
+        bool haveShiftOnlyLHSJacobian;
+        bool needRebuild;
+        bool rebuildE;
+        const char* description;
+    } cases[4] = {
+        { true, false, false, true, "reformed LHS Jacobian" },
+        { true, true, false, false, "LHS Jacobian recombined from K and M" },
+        { false, false, false, false, "unchanged LHS Jacobian" },
+        { false, false, true, true, "unchanged LHS Jacobian with rebuild requested" },
+    };
+    for (int iCase = 0; iCase < 4; ++iCase) {
+        _problem->_haveNewLHSJacobian = cases[iCase].haveNewLHSJacobian;
+        _problem->_haveShiftOnlyLHSJacobian = cases[iCase].haveShiftOnlyLHSJacobian;
+        _problem->_pcNeedRebuild = cases[iCase].needRebuild;
+        _problem->_pcRebuilt = false;
+
+        PetscObjectState stateOrig = 0, state = 0;
+        err = PetscObjectStateGet((PetscObject)precondMat, &stateOrig);CPPUNIT_ASSERT(!err);
+        _problem->_setPreconditionerReuse(precondMat);
+        err = PetscObjectStateGet((PetscObject)precondMat, &state);CPPUNIT_ASSERT(!err);
+
+        PetscBool reuse = PETSC_FALSE;
+        err = KSPGetReusePreconditioner(ksp, &reuse);CPPUNIT_ASSERT(!err);
+
+        const bool rebuildE = cases[iCase].rebuildE;
+        std::ostringstream msg;
+        msg << "Mismatch in preconditioner reuse for " << cases[iCase].description << ".";
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), !rebuildE, bool(reuse));
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), rebuildE, _problem->_pcRebuilt);
+        CPPUNIT_ASSERT_MESSAGE(msg.str(), !_problem->_pcNeedRebuild);
+
+        // Rebuilding with an unchanged matrix requires bumping the matrix state so PCSetUp() does not skip it.
+        const bool stateIncreaseE = rebuildE && !cases[iCase].haveNewLHSJacobian;
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(msg.str(), stateIncreaseE, state > stateOrig);
+    } // for
+
+    err = MatDestroy(&precondMat);CPPUNIT_ASSERT(!err);
+} // testPreconditionerReuse
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test growth in linear iterations beyond the rebuild factor requests rebuilding the preconditioner.
+void
+pylith::problems::TestTimeDependent::testPreconditionerRebuild(void) {
+    CPPUNIT_ASSERT(_problem);
+    CPPUNIT_ASSERT_THROW(_problem->setPreconditionerRebuildFactor(0.5), std::runtime_error);
+    _problem->setPreconditionerRebuildFactor(2.0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, _problem->getPreconditionerRebuildFactor(), 1.0e-10);
+    _problem->setReusePreconditioner(true);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+
+    // No linear solves have been done, so offset the running total to emulate the iterations in each time step.
+    PetscErrorCode err = 0;
+    PetscInt numIterations = 0;
+    err = TSGetKSPIterations(_problem->_ts, &numIterations);CPPUNIT_ASSERT(!err);
+
+    // Time step with new preconditioner sets the reference iteration count.
+    _problem->_pcRebuilt = true;
+    _problem->_pcLinearIterations = numIterations - 10;
+    _problem->_monitorPreconditioner(1);
+    CPPUNIT_ASSERT_EQUAL(PylithInt(10), _problem->_pcRebuildIterations);
+    CPPUNIT_ASSERT(!_problem->_pcRebuilt);
+    CPPUNIT_ASSERT(!_problem->_pcNeedRebuild);
+
+    // Iterations at the threshold keep the preconditioner.
+    _problem->_pcLinearIterations = numIterations - 20;
+    _problem->_monitorPreconditioner(2);
+    CPPUNIT_ASSERT(!_problem->_pcNeedRebuild);
+    CPPUNIT_ASSERT_EQUAL(PylithInt(10), _problem->_pcRebuildIterations);
+
+    // Iterations above the threshold request a rebuild at the next LHS Jacobian evaluation.
+    _problem->_pcLinearIterations = numIterations - 21;
+    _problem->_monitorPreconditioner(3);
+    CPPUNIT_ASSERT(_problem->_pcNeedRebuild);
+    CPPUNIT_ASSERT_EQUAL(numIterations, _problem->_pcLinearIterations);
+} // testPreconditionerRebuild
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test setSolutionLocal() skips scattering and setting constraints only when nothing has changed.
+void
+pylith::problems::TestTimeDependent::testSetSolutionLocalSkip(void) {
+    CPPUNIT_ASSERT(_problem);
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+    CPPUNIT_ASSERT(!_problem->_solutionLocalState.isValid);
+
+    CPPUNIT_ASSERT_EQUAL(size_t(1), _problem->_constraints.size());
+    const pylith::feassemble::Constraint* constraint = _problem->_constraints[0];CPPUNIT_ASSERT(constraint);
+    const pylith::feassemble::PhysicsImplementation::EventEnum eventSetSolution =
+        pylith::feassemble::PhysicsImplementation::EVENT_SET_SOLUTION;
+
+    PetscErrorCode err = 0;
+    PetscVec solutionVec = NULL;
+    PetscVec solutionDotVec = NULL;
+    PetscVec solutionOtherVec = NULL;
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &solutionOtherVec);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionVec, 1.0);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionDotVec, 0.0);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionOtherVec, 1.0);CPPUNIT_ASSERT(!err);
+
+    const PylithReal t = 0.0;
+    const PylithReal dt = _TestTimeDependent::dtSlow / _TestTimeDependent::timeScale;
+    size_t numSetSolution = constraint->getEventCount(eventSetSolution);
+
+    _problem->setSolutionLocal(t, solutionVec, solutionDotVec);
+    CPPUNIT_ASSERT(_problem->_solutionLocalState.isValid);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("First call must set local solution.", ++numSetSolution,
+                                 constraint->getEventCount(eventSetSolution));
+
+    // Same time and unchanged vectors.
+    _problem->setSolutionLocal(t, solutionVec, solutionDotVec);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Call with unchanged vectors must be skipped.", numSetSolution,
+                                 constraint->getEventCount(eventSetSolution));
+
+    // New time.
+    _problem->setSolutionLocal(t+dt, solutionVec, solutionDotVec);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Call with new time must set local solution.", ++numSetSolution,
+                                 constraint->getEventCount(eventSetSolution));
+
+    // Global solution vector modified.
+    err = VecSet(solutionVec, 2.0);CPPUNIT_ASSERT(!err);
+    _problem->setSolutionLocal(t+dt, solutionVec, solutionDotVec);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Call with modified solution must set local solution.", ++numSetSolution,
+                                 constraint->getEventCount(eventSetSolution));
+
+    // Global time derivative of solution vector modified.
+    err = VecSet(solutionDotVec, 3.0);CPPUNIT_ASSERT(!err);
+    _problem->setSolutionLocal(t+dt, solutionVec, solutionDotVec);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Call with modified solution_dot must set local solution.", ++numSetSolution,
+                                 constraint->getEventCount(eventSetSolution));
+
+    // Different global solution vector.
+    _problem->setSolutionLocal(t+dt, solutionOtherVec, solutionDotVec);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Call with different solution vector must set local solution.", ++numSetSolution,
+                                 constraint->getEventCount(eventSetSolution));
+
+    // Local solution vector modified by other code.
+    err = VecSet(_solution->localVector(), 5.0);CPPUNIT_ASSERT(!err);
+    _problem->setSolutionLocal(t+dt, solutionOtherVec, solutionDotVec);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Call with modified local solution must set local solution.", ++numSetSolution,
+                                 constraint->getEventCount(eventSetSolution));
+
+    // Local solution holds the global solution (1.0) and constrained values (0.0), not the value written directly to it.
+    PylithReal valueMax = 0.0;
+    err = VecMax(_solution->localVector(), NULL, &valueMax);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, valueMax, 1.0e-10);
+
+    // Same time and unchanged vectors again after the local solution has been reset.
+    _problem->setSolutionLocal(t+dt, solutionOtherVec, solutionDotVec);
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("Repeated call must be skipped.", numSetSolution,
+                                 constraint->getEventCount(eventSetSolution));
+
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionOtherVec);CPPUNIT_ASSERT(!err);
+} // testSetSolutionLocalSkip
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Test action of matrix-free LHS Jacobian matches assembled LHS Jacobian and preconditioner holds its diagonal blocks.
+void
+pylith::problems::TestTimeDependent::testJacobianMatrixFree(void) {
+    CPPUNIT_ASSERT(_problem);
+    _problem->setJacobianType(TimeDependent::JACOBIAN_MATRIX_FREE);
+    CPPUNIT_ASSERT(_problem->getAssemblePreconditioner());
+    _initialize(pylith::problems::Physics::QUASISTATIC);
+    CPPUNIT_ASSERT(_problem->_jacobianMatrixFree);
+    CPPUNIT_ASSERT(_problem->_precondMat);
+
+    PetscErrorCode err = 0;
+    PetscDM dmSoln = _solution->dmMesh();CPPUNIT_ASSERT(dmSoln);
+    PetscVec solutionVec = NULL;
+    PetscVec solutionDotVec = NULL;
+    PetscVec inputVec = NULL;
+    PetscVec actionVec = NULL;
+    PetscVec actionE = NULL;
+    PetscRandom random = NULL;
+    err = VecDuplicate(_solution->globalVector(), &solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &inputVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &actionVec);CPPUNIT_ASSERT(!err);
+    err = VecDuplicate(_solution->globalVector(), &actionE);CPPUNIT_ASSERT(!err);
+    err = PetscRandomCreate(_mesh->comm(), &random);CPPUNIT_ASSERT(!err);
+    err = VecSetRandom(solutionVec, random);CPPUNIT_ASSERT(!err);
+    err = VecSetRandom(inputVec, random);CPPUNIT_ASSERT(!err);
+    err = PetscRandomDestroy(&random);CPPUNIT_ASSERT(!err);
+    err = VecSet(solutionDotVec, 0.0);CPPUNIT_ASSERT(!err);
+
+    const PylithReal t = 0.0;
+    const PylithReal dt = _TestTimeDependent::dtSlow / _TestTimeDependent::timeScale;
+    const PylithReal s_tshift = 1.0 / dt;
+    PetscMat jacobianMat = _problem->_jacobianMatrixFree;
+    PetscMat precondMat = _problem->_precondMat;
+    _problem->computeLHSJacobian(jacobianMat, precondMat, t, dt, s_tshift, solutionVec, solutionDotVec);
+    err = MatAssemblyBegin(precondMat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+    err = MatAssemblyEnd(precondMat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+    // Assemble full LHS Jacobian at the same trial solution.
+    PetscMat jacobianE = NULL;
+    err = DMCreateMatrix(dmSoln, &jacobianE);CPPUNIT_ASSERT(!err);
+    err = MatZeroEntries(jacobianE);CPPUNIT_ASSERT(!err);
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        _problem->_integrators[i]->computeLHSJacobian(jacobianE, jacobianE, t, dt, s_tshift, *_solution,
+                                                      *_problem->_solutionDot);
+    } // for
+    err = MatAssemblyBegin(jacobianE, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+    err = MatAssemblyEnd(jacobianE, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+    // Apply MatShell through PETSc to exercise the callback.
+    err = MatMult(jacobianMat, inputVec, actionVec);CPPUNIT_ASSERT(!err);
+    err = MatMult(jacobianE, inputVec, actionE);CPPUNIT_ASSERT(!err);
+
+    PylithReal normE = 0.0;
+    PylithReal norm = 0.0;
+    err = VecNorm(actionE, NORM_2, &normE);CPPUNIT_ASSERT(!err);
+    err = VecAXPY(actionE, -1.0, actionVec);CPPUNIT_ASSERT(!err);
+    err = VecNorm(actionE, NORM_2, &norm);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(normE > 0.0);
+    const PylithReal tolerance = 1.0e-10;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL_MESSAGE("Action of matrix-free LHS Jacobian does not match assembled LHS Jacobian.",
+                                         0.0, norm/normE, tolerance);
+
+    // Preconditioner holds the diagonal blocks of the assembled Jacobian and nothing else.
+    MatInfo infoPrecond, infoJacobian;
+    err = MatGetInfo(precondMat, MAT_GLOBAL_SUM, &infoPrecond);CPPUNIT_ASSERT(!err);
+    err = MatGetInfo(jacobianE, MAT_GLOBAL_SUM, &infoJacobian);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT(infoPrecond.nz_used < infoJacobian.nz_used);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(infoJacobian.nz_used, _problem->_countJacobianNonzeros(), 0.5);
+
+    PetscInt rowStart = 0, rowEnd = 0;
+    err = MatGetOwnershipRange(precondMat, &rowStart, &rowEnd);CPPUNIT_ASSERT(!err);
+    for (PetscInt row = rowStart; row < rowEnd; ++row) {
+        PetscInt numCols = 0;
+        const PetscInt* cols = NULL;
+        const PetscScalar* values = NULL;
+        err = MatGetRow(precondMat, row, &numCols, &cols, &values);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT(numCols > 0);
+        for (PetscInt iCol = 0; iCol < numCols; ++iCol) {
+            PetscScalar valueE = 0.0;
+            err = MatGetValues(jacobianE, 1, &row, 1, &cols[iCol], &valueE);CPPUNIT_ASSERT(!err);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, (valueE != 0.0) ? values[iCol]/valueE : 1.0+values[iCol], tolerance);
+        } // for
+        err = MatRestoreRow(precondMat, row, &numCols, &cols, &values);CPPUNIT_ASSERT(!err);
+    } // for
+
+    err = MatDestroy(&jacobianE);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&solutionDotVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&inputVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&actionVec);CPPUNIT_ASSERT(!err);
+    err = VecDestroy(&actionE);CPPUNIT_ASSERT(!err);
+} // testJacobianMatrixFree
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Initialize objects for test.
+void
+pylith::problems::TestTimeDependent::_initialize(const pylith::problems::Physics::FormulationEnum formulation) {
+    CPPUNIT_ASSERT(_mesh);
+    pylith::meshio::MeshIOAscii iohandler;
+    iohandler.filename("data/tri_strip.mesh");
+    iohandler.read(_mesh);
+    CPPUNIT_ASSERT_MESSAGE("Test mesh does not contain any cells.", _mesh->numCells() > 0);
+
+    _mesh->setCoordSys(_cs);
+    pylith::topology::MeshOps::nondimensionalize(_mesh, *_normalizer);
+
+    // Material
+    _material->setFormulation(formulation);
+    _material->useBodyForce(false);
+    _material->setDescriptiveLabel("Isotropic Linear Elasticity Plane Strain");
+    _material->setMaterialId(24);
+    _material->setBulkRheology(_rheology);
+    _material->setAuxiliaryFieldDB(_matAuxDB);
+
+    // Boundary condition
+    static const PylithInt constrainedDOF[2] = {0, 1};
+    _bc->setConstrainedDOF(constrainedDOF, 2);
+    _bc->setMarkerLabel("boundary");
+    _bc->setSubfieldName("displacement");
+    _bc->setUserFn(_TestTimeDependent::solnkernel_disp);
+
+    // Solution
+    CPPUNIT_ASSERT(!_solution);
+    _solution = new pylith::topology::Field(*_mesh);CPPUNIT_ASSERT(_solution);
+    _solution->setLabel("solution");
+    pylith::problems::SolutionFactory factory(*_solution, *_normalizer);
+    factory.addDisplacement(pylith::topology::Field::Discretization(1, 1));
+    if (pylith::problems::Physics::QUASISTATIC != formulation) {
+        factory.addVelocity(pylith::topology::Field::Discretization(1, 1));
+    } // if
+
+    // Problem
+    _problem->setFormulation(formulation);
+    _problem->setSolverType(pylith::problems::Problem::LINEAR);
+    _problem->setNormalizer(*_normalizer);
+    pylith::materials::Material* materials[1] = { _material };
+    _problem->setMaterials(materials, 1);
+    std::vector<pylith::bc::BoundaryCondition*> bcs(1, _bc);
+    if (_bcNeumann) {
+        bcs.push_back(_bcNeumann);
+    } // if
+    _problem->setBoundaryConditions(&bcs[0], bcs.size());
+    _problem->setSolution(_solution);
+    _problem->registerObserver(_observer);
+
+    _problem->preinitialize(*_mesh);
+    _problem->verifyConfiguration();
+    _problem->initialize();
+} // _initialize
+
+
+// ---------------------------------------------------------------------------------------------------------------------
+// Get integrator for the material.
+pylith::feassemble::IntegratorDomain*
+pylith::problems::TestTimeDependent::_getIntegratorMaterial(void) {
+    CPPUNIT_ASSERT(_problem);
+
+    pylith::feassemble::IntegratorDomain* integrator = NULL;
+    for (size_t i = 0; i < _problem->_integrators.size(); ++i) {
+        integrator = dynamic_cast<pylith::feassemble::IntegratorDomain*>(_problem->_integrators[i]);
+        if (integrator) { break; }
+    } // for
+
+    return integrator;
+} // _getIntegratorMaterial
+
+
+// End of file
@@ -0,0 +1,177 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/problems/TestTimeDependent.hh
+ *
+ * @brief C++ TestTimeDependent object.
+ *
+ * C++ unit testing for TimeDependent with an elastic strip with one column of small cells.
+ */
+
+#if !defined(pylith_problems_testtimedependent_hh)
+#define pylith_problems_testtimedependent_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/problems/problemsfwd.hh" // HOLDSA TimeDependent
+#include "pylith/materials/materialsfwd.hh" // HOLDSA Elasticity
+#include "pylith/bc/bcfwd.hh" // HOLDSA DirichletUserFn, NeumannTimeDependent
+#include "pylith/feassemble/feassemblefwd.hh" // USES IntegratorDomain
+#include "pylith/topology/topologyfwd.hh" // HOLDSA Mesh, Field
+
+#include "pylith/problems/Physics.hh" // USES FormulationEnum
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // HOLDSA UserFunctionDB
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CoordSys
+#include "spatialdata/units/unitsfwd.hh" // HOLDSA Nondimensional
+
+/// Namespace for pylith package
+namespace pylith {
+    namespace problems {
+        class TestTimeDependent;
+
+        class _TestTimeDependentObserver; // Observer with checkpoint state.
+    } // problems
+} // pylith
+
+class pylith::problems::TestTimeDependent : public CppUnit::TestFixture {
+    // CPPUNIT TEST SUITE //////////////////////////////////////////////////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE(TestTimeDependent);
+
+    CPPUNIT_TEST(testMultirateBins);
+    CPPUNIT_TEST(testMultirateGeometryBudget);
+    CPPUNIT_TEST(testMultirateUnstable);
+    CPPUNIT_TEST(testHaloOverlapResidual);
+    CPPUNIT_TEST(testCheckpointRestart);
+    CPPUNIT_TEST(testJacobianSplit);
+    CPPUNIT_TEST(testJacobianSplitQuasistatic);
+    CPPUNIT_TEST(testMatrixTypeBlocked);
+    CPPUNIT_TEST(testMatrixTypeFallback);
+    CPPUNIT_TEST(testMatrixTypeUser);
+    CPPUNIT_TEST(testPhysicsEvents);
+    CPPUNIT_TEST(testPredictorQuadratic);
+    CPPUNIT_TEST(testPredictorLinear);
+    CPPUNIT_TEST(testPredictorGuard);
+    CPPUNIT_TEST(testPreconditionerReuse);
+    CPPUNIT_TEST(testPreconditionerRebuild);
+    CPPUNIT_TEST(testSetSolutionLocalSkip);
+    CPPUNIT_TEST(testJacobianMatrixFree);
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS //////////////////////////////////////////////////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Tear down testing data.
+    void tearDown(void);
+
+    /// Test binning of cells and degrees of freedom for multirate time stepping.
+    void testMultirateBins(void);
+
+    /// Test cached geometry for multirate bins stays within the memory budget.
+    void testMultirateGeometryBudget(void);
+
+    /// Test multirate time stepping rejects a fast rate that is unstable for the fast cells.
+    void testMultirateUnstable(void);
+
+    /// Test residual assembled with interior and halo cells split matches residual assembled from all cells.
+    void testHaloOverlapResidual(void);
+
+    /// Test restarting from checkpoint recovers solution, auxiliary field, time stepping, and observer state.
+    void testCheckpointRestart(void);
+
+    /// Test LHS Jacobian combined from K and M matches LHS Jacobian assembled from all integrators.
+    void testJacobianSplit(void);
+
+    /// Test linear quasistatic elasticity declares Jacobian linear in s_tshift without turning on the split.
+    void testJacobianSplitQuasistatic(void);
+
+    /// Test blocked sparse matrices are used when every point holds one unconstrained or fully constrained block.
+    void testMatrixTypeBlocked(void);
+
+    /// Test default sparse matrices are used when points hold more than one block.
+    void testMatrixTypeFallback(void);
+
+    /// Test matrix type set by the user is not overridden.
+    void testMatrixTypeUser(void);
+
+    /// Test registration and counts of events for domain, boundary, and constraint implementations of physics.
+    void testPhysicsEvents(void);
+
+    /// Test quadratic predictor extrapolates previous solutions exactly for a quadratic polynomial.
+    void testPredictorQuadratic(void);
+
+    /// Test linear predictor extrapolates the two most recent solutions.
+    void testPredictorLinear(void);
+
+    /// Test predictor is disabled for formulations other than quasistatic.
+    void testPredictorGuard(void);
+
+    /// Test preconditioner is rebuilt only for a reformed LHS Jacobian or when requested by the iteration check.
+    void testPreconditionerReuse(void);
+
+    /// Test growth in linear iterations beyond the rebuild factor requests rebuilding the preconditioner.
+    void testPreconditionerRebuild(void);
+
+    /// Test setSolutionLocal() skips scattering and setting constraints only when nothing has changed.
+    void testSetSolutionLocalSkip(void);
+
+    /// Test action of matrix-free LHS Jacobian matches assembled LHS Jacobian and preconditioner holds its diagonal blocks.
+    void testJacobianMatrixFree(void);
+
+    // PRIVATE METHODS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    /** Initialize objects for test.
+     *
+     * @param[in] formulation Time stepping formulation.
+     */
+    void _initialize(const pylith::problems::Physics::FormulationEnum formulation);
+
+    /** Get integrator for the material.
+     *
+     * @returns Integrator for the material.
+     */
+    pylith::feassemble::IntegratorDomain* _getIntegratorMaterial(void);
+
+    // PRIVATE MEMBERS /////////////////////////////////////////////////////////////////////////////////////////////////
+private:
+
+    pylith::problems::TimeDependent* _problem; ///< Test subject.
+    pylith::topology::Mesh* _mesh; ///< Finite-element mesh.
+    pylith::topology::Field* _solution; ///< Solution field.
+    pylith::materials::Elasticity* _material; ///< Elastic material.
+    pylith::materials::RheologyElasticity* _rheology; ///< Elastic rheology for material.
+    pylith::bc::DirichletUserFn* _bc; ///< Dirichlet boundary condition.
+    pylith::bc::NeumannTimeDependent* _bcNeumann; ///< Optional Neumann boundary condition.
+    _TestTimeDependentObserver* _observer; ///< Observer with checkpoint state.
+
+    spatialdata::geocoords::CoordSys* _cs; ///< Coordinate system.
+    spatialdata::units::Nondimensional* _normalizer; ///< Scales for nondimensionalization.
+    spatialdata::spatialdb::UserFunctionDB* _matAuxDB; ///< Spatial database for material auxiliary field.
+    spatialdata::spatialdb::UserFunctionDB* _bcAuxDB; ///< Spatial database for Neumann auxiliary field.
+
+}; // class TestTimeDependent
+
+#endif // pylith_problems_testtimedependent_hh
+
+// End of file
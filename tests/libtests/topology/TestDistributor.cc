@@ -0,0 +1,306 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDistributor.hh" // Implementation of class methods
+
+#include "pylith/topology/Distributor.hh" // USES Distributor
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/MeshOps.hh" // USES MeshOps
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/meshio/DataWriterHDF5.hh" // USES DataWriterHDF5
+#include "pylith/meshio/HDF5.hh" // USES HDF5
+#include "pylith/testing/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+#include "pylith/utils/array.hh" // USES int_array
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <string> // USES std::string
+#include <cstdio> // USES std::remove()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestDistributor );
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::topology::TestDistributor::setUp(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _mesh = NULL;
+    _cs = new spatialdata::geocoords::CSCart;CPPUNIT_ASSERT(_cs);
+    _cs->setSpaceDim(2);
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::topology::TestDistributor::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _mesh;_mesh = NULL;
+    delete _cs;_cs = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test _computePartitionStats().
+void
+pylith::topology::TestDistributor::testComputePartitionStats(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+
+    pylith::int_array stats;
+    Distributor::_computePartitionStats(&stats, *_mesh);
+    CPPUNIT_ASSERT_EQUAL(size_t(Distributor::NUM_STATS), stats.size());
+
+    pylith::int_array statsTotal(Distributor::NUM_STATS);
+    PetscErrorCode err = 0;
+    int commSize = 1;
+    err = MPI_Comm_size(_mesh->comm(), &commSize);CPPUNIT_ASSERT(!err);
+    err = MPI_Allreduce(&stats[0], &statsTotal[0], Distributor::NUM_STATS, MPI_INT, MPI_SUM,
+                        _mesh->comm());CPPUNIT_ASSERT(!err);
+
+    // Every cell lives on one process and every vertex is owned by one process.
+    const int numCellsE = 4;
+    const int numVerticesE = 5;
+    CPPUNIT_ASSERT_EQUAL(numCellsE, statsTotal[Distributor::STAT_CELLS]);
+    CPPUNIT_ASSERT_EQUAL(numVerticesE, statsTotal[Distributor::STAT_OWNED_VERTICES]);
+
+    // Ghost vertices are a subset of shared vertices, and each cut face is shared by exactly two processes.
+    CPPUNIT_ASSERT(stats[Distributor::STAT_GHOST_VERTICES] <= stats[Distributor::STAT_SHARED_VERTICES]);
+    CPPUNIT_ASSERT_EQUAL(0, statsTotal[Distributor::STAT_CUT_FACES] % 2);
+    CPPUNIT_ASSERT(stats[Distributor::STAT_NEIGHBORS] < commSize);
+
+    if (1 == commSize) {
+        CPPUNIT_ASSERT_EQUAL(numCellsE, stats[Distributor::STAT_CELLS]);
+        CPPUNIT_ASSERT_EQUAL(numVerticesE, stats[Distributor::STAT_OWNED_VERTICES]);
+        CPPUNIT_ASSERT_EQUAL(0, stats[Distributor::STAT_GHOST_VERTICES]);
+        CPPUNIT_ASSERT_EQUAL(0, stats[Distributor::STAT_SHARED_VERTICES]);
+        CPPUNIT_ASSERT_EQUAL(0, stats[Distributor::STAT_CUT_FACES]);
+        CPPUNIT_ASSERT_EQUAL(0, stats[Distributor::STAT_NEIGHBORS]);
+    } else {
+        // Cells of a connected mesh split among processes must share vertices with a neighboring process.
+        if (stats[Distributor::STAT_CELLS] > 0) {
+            CPPUNIT_ASSERT(stats[Distributor::STAT_SHARED_VERTICES] > 0);
+            CPPUNIT_ASSERT(stats[Distributor::STAT_NEIGHBORS] > 0);
+        } // if
+    } // if/else
+
+    PYLITH_METHOD_END;
+} // testComputePartitionStats
+
+
+// ----------------------------------------------------------------------
+// Test _computeImbalance().
+void
+pylith::topology::TestDistributor::testComputeImbalance(void) {
+    PYLITH_METHOD_BEGIN;
+
+    PetscErrorCode err = 0;
+    int commSize = 1;
+    int commRank = 0;
+    err = MPI_Comm_size(PETSC_COMM_WORLD, &commSize);CPPUNIT_ASSERT(!err);
+    err = MPI_Comm_rank(PETSC_COMM_WORLD, &commRank);CPPUNIT_ASSERT(!err);
+    const PylithReal tolerance = 1.0e-12;
+
+    { // Value on process n is n+1.
+        PylithReal valueMax = 0.0, valueMean = 0.0, imbalance = 0.0;
+        Distributor::_computeImbalance(&valueMax, &valueMean, &imbalance, PylithReal(commRank+1), PETSC_COMM_WORLD);
+
+        const PylithReal valueMaxE = commSize;
+        const PylithReal valueMeanE = 0.5*(commSize+1);
+        const PylithReal imbalanceE = 2.0*commSize / (commSize+1);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(valueMaxE, valueMax, tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(valueMeanE, valueMean, tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(imbalanceE, imbalance, tolerance);
+    } // Value on process n is n+1.
+
+    { // Value is the same on all processes.
+        PylithReal valueMax = 0.0, valueMean = 0.0, imbalance = 0.0;
+        Distributor::_computeImbalance(&valueMax, &valueMean, &imbalance, 3.0, PETSC_COMM_WORLD);
+
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, valueMax, tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, valueMean, tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, imbalance, tolerance);
+    } // Value is the same on all processes.
+
+    { // Value is zero on all processes.
+        PylithReal valueMax = 1.0, valueMean = 1.0, imbalance = 0.0;
+        Distributor::_computeImbalance(&valueMax, &valueMean, &imbalance, 0.0, PETSC_COMM_WORLD);
+
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, valueMax, tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, valueMean, tolerance);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, imbalance, tolerance);
+    } // Value is zero on all processes.
+
+    PYLITH_METHOD_END;
+} // testComputeImbalance
+
+
+// ----------------------------------------------------------------------
+// Test _computeCellWeights() with material weights and weights for cells adjacent to a fault.
+void
+pylith::topology::TestDistributor::testComputeCellWeights(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Mesh mesh;
+    meshio::MeshIOAscii iohandler;
+    iohandler.filename("data/fourtri3.mesh");
+    iohandler.read(&mesh);
+
+    PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+    const size_t numCells = Stratum(dmMesh, Stratum::HEIGHT, 0).size();
+    CPPUNIT_ASSERT(0 == numCells || 4 == numCells); // Mesh is read on process 0.
+    pylith::int_array cellWeights;
+
+    { // No weights gives uniform weights.
+        Distributor::_computeCellWeights(&cellWeights, mesh, NULL, NULL, 0, 1.0);
+        CPPUNIT_ASSERT_EQUAL(numCells, cellWeights.size());
+        for (size_t i = 0; i < numCells; ++i) {
+            CPPUNIT_ASSERT_EQUAL(PylithInt(10), cellWeights[i]);
+        } // for
+    } // No weights gives uniform weights.
+
+    { // Material weights; cells 0-1 are material 1 and cells 2-3 are material 2.
+        const int weightIds[3] = { 1, 2, 8 };
+        const PylithReal weights[3] = { 0.01, 2.0, 4.0 };
+        Distributor::_computeCellWeights(&cellWeights, mesh, weightIds, weights, 3, 1.0);
+        CPPUNIT_ASSERT_EQUAL(numCells, cellWeights.size());
+
+        // Weights are clipped to a minimum of 1.
+        const PylithInt cellWeightsE[4] = { 1, 1, 20, 20 };
+        for (size_t i = 0; i < numCells; ++i) {
+            CPPUNIT_ASSERT_EQUAL(cellWeightsE[i], cellWeights[i]);
+        } // for
+    } // Material weights
+
+    // Insert cohesive cells along the fault; every cell in the mesh has an edge on the fault.
+    const int interfaceId = 100;
+    pylith::faults::FaultCohesiveStub fault;
+    fault.setInterfaceId(interfaceId);
+    fault.setSurfaceMarkerLabel("fault");
+    fault.adjustTopology(&mesh);
+
+    dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    if (numCells > 0) {
+        CPPUNIT_ASSERT_EQUAL(PetscInt(numCells+2), cellsStratum.size());
+    } // if
+
+    { // Material and interface weights with weight for cells adjacent to the fault.
+        const int weightIds[2] = { 2, interfaceId };
+        const PylithReal weights[2] = { 2.0, 3.0 };
+        const PylithReal faultAdjacentWeight = 1.5;
+        Distributor::_computeCellWeights(&cellWeights, mesh, weightIds, weights, 2, faultAdjacentWeight);
+        CPPUNIT_ASSERT_EQUAL(size_t(cEnd-cStart), cellWeights.size());
+
+        PetscErrorCode err = 0;
+        for (PetscInt c = cStart; c < cEnd; ++c) {
+            PylithInt cellWeightE = 0;
+            if (MeshOps::isCohesiveCell(dmMesh, c)) {
+                cellWeightE = 30; // Interface weight; cohesive cells are not adjacent to themselves.
+            } else {
+                PetscInt materialId = 0;
+                err = DMGetLabelValue(dmMesh, Mesh::getCellsLabelName(), c, &materialId);CPPUNIT_ASSERT(!err);
+                cellWeightE = (1 == materialId) ? 15 : 30; // Material weight times fault adjacent weight.
+            } // if/else
+            CPPUNIT_ASSERT_EQUAL(cellWeightE, cellWeights[c-cStart]);
+        } // for
+    } // Material and interface weights
+
+    PYLITH_METHOD_END;
+} // testComputeCellWeights
+
+
+// ----------------------------------------------------------------------
+// Test write().
+void
+pylith::topology::TestDistributor::testWrite(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+
+    const char* filename = "distributor_partition.h5";
+    pylith::meshio::DataWriterHDF5 writer;
+    writer.filename(filename);
+    Distributor::write(&writer, *_mesh);
+
+    PetscErrorCode err = MPI_Barrier(_mesh->comm());CPPUNIT_ASSERT(!err);
+    if (0 == _mesh->commRank()) {
+        pylith::meshio::HDF5 h5(filename, H5F_ACC_RDONLY);
+        const int numFields = 1 + Distributor::NUM_STATS;
+        for (int iField = 0; iField < numFields; ++iField) {
+            const std::string fieldName = (0 == iField) ? std::string("partition") :
+                                          std::string("partition_") +
+                                          Distributor::_getPartitionStatName(Distributor::PartitionStatEnum(iField-1));
+            const std::string datasetName = std::string("/cell_fields/") + fieldName;
+            CPPUNIT_ASSERT_MESSAGE("Missing dataset '" + datasetName + "'.", h5.hasDataset(datasetName.c_str()));
+
+            hsize_t* dims = NULL;
+            int ndims = 0;
+            h5.getDatasetDims(&dims, &ndims, "/cell_fields", fieldName.c_str());
+            CPPUNIT_ASSERT_EQUAL(3, ndims);
+            CPPUNIT_ASSERT_EQUAL(hsize_t(1), dims[0]); // One time step
+            CPPUNIT_ASSERT_EQUAL(hsize_t(4), dims[1]); // Cells in mesh
+            CPPUNIT_ASSERT_EQUAL(hsize_t(1), dims[2]); // Scalar field
+            delete[] dims;dims = NULL;
+        } // for
+        h5.close();
+        std::remove(filename);
+    } // if
+
+    PYLITH_METHOD_END;
+} // testWrite
+
+
+// ----------------------------------------------------------------------
+// Read and distribute mesh.
+void
+pylith::topology::TestDistributor::_initialize(void) {
+    PYLITH_METHOD_BEGIN;
+
+    Mesh meshOrig;
+    meshio::MeshIOAscii iohandler;
+    iohandler.filename("data/fourtri3.mesh");
+    iohandler.read(&meshOrig);
+    CPPUNIT_ASSERT(meshOrig.numCells() > 0);
+    meshOrig.setCoordSys(_cs);
+
+    delete _mesh;_mesh = new Mesh;CPPUNIT_ASSERT(_mesh);
+    Distributor::distribute(_mesh, meshOrig, "simple", NULL, 0, NULL, 0, 1.0);
+    _mesh->setCoordSys(_cs);
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// End of file
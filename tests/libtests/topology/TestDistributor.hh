@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file tests/libtests/topology/TestDistributor.hh
+ *
+ * @brief C++ TestDistributor object
+ *
+ * C++ unit testing for Distributor.
+ */
+
+#if !defined(pylith_topology_testdistributor_hh)
+#define pylith_topology_testdistributor_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh
+
+#include "spatialdata/geocoords/geocoordsfwd.hh" // HOLDSA CoordSys
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+    namespace topology {
+        class TestDistributor;
+    } // topology
+} // pylith
+
+// Distributor ---------------------------------------------------------------
+class pylith::topology::TestDistributor : public CppUnit::TestFixture
+{ // class TestDistributor
+
+    // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+    CPPUNIT_TEST_SUITE( TestDistributor );
+
+    CPPUNIT_TEST( testComputePartitionStats );
+    CPPUNIT_TEST( testComputeImbalance );
+    CPPUNIT_TEST( testComputeCellWeights );
+    CPPUNIT_TEST( testWrite );
+
+    CPPUNIT_TEST_SUITE_END();
+
+    // PUBLIC METHODS /////////////////////////////////////////////////////
+public:
+
+    /// Setup testing data.
+    void setUp(void);
+
+    /// Deallocate testing data.
+    void tearDown(void);
+
+    /// Test _computePartitionStats().
+    void testComputePartitionStats(void);
+
+    /// Test _computeImbalance().
+    void testComputeImbalance(void);
+
+    /// Test _computeCellWeights() with material weights and weights for cells adjacent to a fault.
+    void testComputeCellWeights(void);
+
+    /// Test write().
+    void testWrite(void);
+
+    // PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+    /// Read and distribute mesh.
+    void _initialize(void);
+
+    // PRIVATE MEMBERS //////////////////////////////////////////////////////
+private:
+
+    Mesh* _mesh; ///< Distributed finite-element mesh.
+    spatialdata::geocoords::CoordSys* _cs; ///< Coordinate system.
+
+}; // class TestDistributor
+
+#endif // pylith_topology_testdistributor_hh
+
+
+// End of file
@@ -0,0 +1,254 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/testing/FaultCohesiveStub.hh" // USES FaultCohesiveStub
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+
+#include <vector> // USES std::vector
+#include <cstdlib> // USES abs()
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::topology::TestSpaceFillingCurve::setUp(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _data = new TestSpaceFillingCurve_Data;CPPUNIT_ASSERT(_data);
+    _mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // setUp
+
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::topology::TestSpaceFillingCurve::tearDown(void) {
+    PYLITH_METHOD_BEGIN;
+
+    delete _data;_data = NULL;
+    delete _mesh;_mesh = NULL;
+
+    PYLITH_METHOD_END;
+} // tearDown
+
+
+// ----------------------------------------------------------------------
+// Test reorder().
+void
+pylith::topology::TestSpaceFillingCurve::testReorder(void) {
+    PYLITH_METHOD_BEGIN;
+
+    _initialize();
+    CPPUNIT_ASSERT(_mesh);
+
+    // Get original DM and create Mesh for it
+    const PetscDM dmOrig = _mesh->dmMesh();
+    PetscObjectReference((PetscObject) dmOrig);
+    Mesh meshOrig;
+    meshOrig.dmMesh(dmOrig);
+
+    SpaceFillingCurve::reorder(_mesh, SpaceFillingCurve::CurveEnum(_data->curve));
+
+    const PetscDM& dmMesh = _mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+
+    // Check vertices (size only)
+    topology::Stratum verticesStratumE(dmOrig, topology::Stratum::DEPTH, 0);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    CPPUNIT_ASSERT_EQUAL(verticesStratumE.size(), verticesStratum.size());
+
+    // Check cells (size only)
+    topology::Stratum cellsStratumE(dmOrig, topology::Stratum::HEIGHT, 0);
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    CPPUNIT_ASSERT_EQUAL(cellsStratumE.size(), cellsStratum.size());
+
+    // Check groups
+    PetscInt numGroupsE, numGroups;
+    PetscErrorCode err;
+    err = DMGetNumLabels(dmOrig, &numGroupsE);CPPUNIT_ASSERT(!err);
+    err = DMGetNumLabels(dmMesh, &numGroups);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(numGroupsE, numGroups);
+
+    for (PetscInt iGroup = 0; iGroup < numGroups; ++iGroup) {
+        const char *name = NULL;
+        err = DMGetLabelName(dmMesh, iGroup, &name);CPPUNIT_ASSERT(!err);
+
+        PetscInt numPointsE, numPoints;
+        err = DMGetStratumSize(dmOrig, name, 1, &numPointsE);CPPUNIT_ASSERT(!err);
+        err = DMGetStratumSize(dmMesh, name, 1, &numPoints);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(numPointsE, numPoints);
+    } // for
+
+    // Check cell types (cohesive cells remain at end of cells)
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+        DMPolytopeType cellTypeE, cellType;
+        err = DMPlexGetCellType(dmOrig, cell, &cellTypeE);CPPUNIT_ASSERT(!err);
+        err = DMPlexGetCellType(dmMesh, cell, &cellType);CPPUNIT_ASSERT(!err);
+        CPPUNIT_ASSERT_EQUAL(cellTypeE, cellType);
+    } // for
+
+    // Check element centroids
+    PylithScalar coordsCheckOrig = 0.0;
+    PylithInt totalClosureSizeOrig = 0;
+    { // original
+        pylith::topology::CoordsVisitor coordsVisitor(dmOrig);
+        for (PetscInt cell = cellsStratumE.begin(); cell < cellsStratumE.end(); ++cell) {
+            PetscScalar* coordsCell = NULL;
+            PetscInt coordsSize = 0;
+            PylithScalar value = 0.0;
+            coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+            totalClosureSizeOrig += coordsSize;
+            for (int i = 0; i < coordsSize; ++i) {
+                value += coordsCell[i];
+            } // for
+            coordsCheckOrig += value*value;
+            coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+        } // for
+    } // original
+    PylithScalar coordsCheckReorder = 0.0;
+    PylithInt totalClosureSizeReorder = 0;
+    { // reordered
+        pylith::topology::CoordsVisitor coordsVisitor(dmMesh);
+        for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+            PetscScalar* coordsCell = NULL;
+            PetscInt coordsSize = 0;
+            PylithScalar value = 0.0;
+            coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+            totalClosureSizeReorder += coordsSize;
+            for (int i = 0; i < coordsSize; ++i) {
+                value += coordsCell[i];
+            } // for
+            coordsCheckReorder += value*value;
+            coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+        } // for
+    } // reordered
+    CPPUNIT_ASSERT_EQUAL(totalClosureSizeOrig, totalClosureSizeReorder);
+    const PylithScalar tolerance = 1.0e-6;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(coordsCheckOrig, coordsCheckReorder, tolerance*coordsCheckOrig);
+
+    PYLITH_METHOD_END;
+} // testReorder
+
+
+// ----------------------------------------------------------------------
+// Test _hilbertIndex().
+void
+pylith::topology::TestSpaceFillingCurve::testHilbertIndex(void) {
+    PYLITH_METHOD_BEGIN;
+
+    // Consecutive points along the curve must be neighbors on the grid.
+    const int numBits = 3;
+    const unsigned int numPointsDim = 1u << numBits;
+    for (int dim = 2; dim <= 3; ++dim) {
+        const size_t numPoints = (2 == dim) ? numPointsDim*numPointsDim : numPointsDim*numPointsDim*numPointsDim;
+        std::vector<int> pointCoords(numPoints*dim, -1);
+        for (size_t iPoint = 0; iPoint < numPoints; ++iPoint) {
+            unsigned int coords[3];
+            coords[0] = iPoint % numPointsDim;
+            coords[1] = (iPoint / numPointsDim) % numPointsDim;
+            coords[2] = iPoint / (numPointsDim*numPointsDim);
+            const uint64_t index = SpaceFillingCurve::_hilbertIndex(coords, dim, numBits);
+            CPPUNIT_ASSERT(index < numPoints);
+            CPPUNIT_ASSERT_EQUAL(-1, pointCoords[index*dim]);
+            for (int iDim = 0; iDim < dim; ++iDim) {
+                pointCoords[index*dim+iDim] = coords[iDim];
+            } // for
+        } // for
+
+        for (size_t index = 1; index < numPoints; ++index) {
+            int distance = 0;
+            for (int iDim = 0; iDim < dim; ++iDim) {
+                distance += abs(pointCoords[index*dim+iDim] - pointCoords[(index-1)*dim+iDim]);
+            } // for
+            CPPUNIT_ASSERT_EQUAL(1, distance);
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // testHilbertIndex
+
+
+// ----------------------------------------------------------------------
+// Test _mortonIndex().
+void
+pylith::topology::TestSpaceFillingCurve::testMortonIndex(void) {
+    PYLITH_METHOD_BEGIN;
+
+    const int numBits = 2;
+    { // 2-D
+        const unsigned int coords[2] = { 2, 3 }; // 10, 11 -> 1101
+        CPPUNIT_ASSERT_EQUAL(uint64_t(13), SpaceFillingCurve::_mortonIndex(coords, 2, numBits));
+    } // 2-D
+    { // 3-D
+        const unsigned int coords[3] = { 1, 2, 3 }; // 01, 10, 11 -> 011101
+        CPPUNIT_ASSERT_EQUAL(uint64_t(29), SpaceFillingCurve::_mortonIndex(coords, 3, numBits));
+    } // 3-D
+
+    PYLITH_METHOD_END;
+} // testMortonIndex
+
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestSpaceFillingCurve::_initialize() {
+    PYLITH_METHOD_BEGIN;
+    CPPUNIT_ASSERT(_data);
+
+    delete _mesh;_mesh = new Mesh;CPPUNIT_ASSERT(_mesh);
+
+    meshio::MeshIOAscii iohandler;
+    iohandler.filename(_data->filename);
+    iohandler.read(_mesh);
+    CPPUNIT_ASSERT(_mesh->numCells() > 0);
+    CPPUNIT_ASSERT(_mesh->numVertices() > 0);
+
+    // Adjust topology if necessary.
+    if (_data->faultLabel) {
+        pylith::faults::FaultCohesiveStub fault;
+        fault.setInterfaceId(100);
+        fault.setSurfaceMarkerLabel(_data->faultLabel);
+        fault.adjustTopology(_mesh);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _initialize
+
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::topology::TestSpaceFillingCurve_Data::TestSpaceFillingCurve_Data(void) :
+    filename(NULL),
+    faultLabel(NULL),
+    curve(SpaceFillingCurve::HILBERT) {} // constructor
+
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::topology::TestSpaceFillingCurve_Data::~TestSpaceFillingCurve_Data(void) {} // destructor
+
+
+// End of file
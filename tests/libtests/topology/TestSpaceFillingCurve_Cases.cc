@@ -0,0 +1,213 @@
+// -*- C++ -*-
+//
+// -----------------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// -----------------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+
+// -----------------------------------------------------------------------------
+namespace pylith {
+    namespace topology {
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Tri_Nofault : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Tri_Nofault, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_tri3.mesh";
+                _data->faultLabel = NULL;
+                _data->curve = SpaceFillingCurve::HILBERT;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Tri_Nofault
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Tri_Nofault );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Tri_Fault : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Tri_Fault, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_tri3.mesh";
+                _data->faultLabel = "fault";
+                _data->curve = SpaceFillingCurve::HILBERT;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Tri_Fault
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Tri_Fault );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Quad_Nofault : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Quad_Nofault, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_quad4.mesh";
+                _data->faultLabel = NULL;
+                _data->curve = SpaceFillingCurve::HILBERT;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Quad_Nofault
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Quad_Nofault );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Quad_Fault : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Quad_Fault, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_quad4.mesh";
+                _data->faultLabel = "fault";
+                _data->curve = SpaceFillingCurve::HILBERT;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Quad_Fault
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Quad_Fault );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Tet_Nofault : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Tet_Nofault, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_tet4.mesh";
+                _data->faultLabel = NULL;
+                _data->curve = SpaceFillingCurve::HILBERT;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Tet_Nofault
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Tet_Nofault );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Tet_Fault : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Tet_Fault, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_tet4.mesh";
+                _data->faultLabel = "fault";
+                _data->curve = SpaceFillingCurve::HILBERT;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Tet_Fault
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Tet_Fault );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Hex_Nofault : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Hex_Nofault, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_hex8.mesh";
+                _data->faultLabel = NULL;
+                _data->curve = SpaceFillingCurve::HILBERT;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Hex_Nofault
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Hex_Nofault );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Hex_Fault : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Hex_Fault, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_hex8.mesh";
+                _data->faultLabel = "fault";
+                _data->curve = SpaceFillingCurve::HILBERT;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Hex_Fault
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Hex_Fault );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Tri_Morton : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Tri_Morton, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_tri3.mesh";
+                _data->faultLabel = "fault";
+                _data->curve = SpaceFillingCurve::MORTON;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Tri_Morton
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Tri_Morton );
+
+        // ---------------------------------------------------------------------
+        class TestSpaceFillingCurve_Hex_Morton : public TestSpaceFillingCurve {
+
+            CPPUNIT_TEST_SUB_SUITE( TestSpaceFillingCurve_Hex_Morton, TestSpaceFillingCurve );
+            CPPUNIT_TEST_SUITE_END();
+
+            void setUp(void) {
+                TestSpaceFillingCurve::setUp();
+
+                _data->filename = "data/reorder_hex8.mesh";
+                _data->faultLabel = "fault";
+                _data->curve = SpaceFillingCurve::MORTON;
+            }   // setUp
+
+
+        };  // TestSpaceFillingCurve_Hex_Morton
+        CPPUNIT_TEST_SUITE_REGISTRATION( TestSpaceFillingCurve_Hex_Morton );
+
+    }   // topology
+}   // pylith
+
+
+// End of file
@@ -0,0 +1,49 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/problems/TestGreensFns.py
+#
+# @brief Unit testing of Python GreensFns object.
+
+import unittest
+
+from pylith.testing.UnitTestApp import TestComponent
+from pylith.problems.GreensFns import (GreensFns, problem)
+
+
+class TestGreensFns(TestComponent):
+    """Unit testing of GreensFns object.
+    """
+    _class = GreensFns
+    _factory = problem
+
+    def test_rhs_block_size(self):
+        obj = GreensFns()
+        self.assertEqual(1, obj.getRHSBlockSize())
+        obj.setRHSBlockSize(4)
+        self.assertEqual(4, obj.getRHSBlockSize())
+        with self.assertRaises(RuntimeError):
+            obj.setRHSBlockSize(0)
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestGreensFns))
+    unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -4,6 +4,7 @@ from .TestInitialConditionPatch import TestInitialConditionPatch
 from .TestPhysics import TestPhysics
 from .TestProblem import TestProblem
 from .TestTimeDependent import TestTimeDependent
+from .TestGreensFns import TestGreensFns
 from .TestProblemDefaults import TestProblemDefaults
 from .TestProgressMonitor import TestProgressMonitor
 from .TestProgressMonitorTime import TestProgressMonitorTime
@@ -33,6 +34,7 @@ def test_classes():
         TestPhysics,
         TestProblem,
         TestTimeDependent,
+        TestGreensFns,
         TestProblemDefaults,
         TestProgressMonitorTime,
         TestProgressMonitorTime,
@@ -0,0 +1,49 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+# @file tests/pytests/topology/TestSpaceFillingCurve.py
+#
+# @brief Unit testing of Python SpaceFillingCurve object.
+
+import unittest
+
+from pylith.topology.SpaceFillingCurve import SpaceFillingCurve
+
+
+class TestSpaceFillingCurve(unittest.TestCase):
+    """Unit testing of SpaceFillingCurve object.
+    """
+
+    def test_constructor(self):
+        ordering = SpaceFillingCurve()
+        self.assertTrue(not ordering is None)
+
+
+if __name__ == "__main__":
+    suite = unittest.TestSuite()
+    suite.addTest(unittest.makeSuite(TestSpaceFillingCurve))
+
+    from pylith.utils.PetscManager import PetscManager
+    petsc = PetscManager()
+    petsc.initialize()
+
+    success = unittest.TextTestRunner(verbosity=2).run(suite).wasSuccessful()
+
+    petsc.finalize()
+
+
+# End of file